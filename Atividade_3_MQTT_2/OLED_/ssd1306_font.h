@@ -1,126 +0,0 @@
-/**
- * @file ssd1306_font.h
- * @brief Tabela de caracteres bitmap para exibição em displays OLED com controlador SSD1306.
- *
- * Este arquivo define um vetor estático `font[]` que contém a representação gráfica (bitmap) 
- * de caracteres alfanuméricos e símbolos, organizados em blocos de 8 bytes por caractere.
- *
- * Cada caractere é codificado em uma matriz de 8x8 pixels, onde cada byte representa uma coluna
- * da imagem do caractere, com o bit menos significativo no topo.
- *
- * A tabela inclui:
- * - Letras maiúsculas e minúsculas com acentuação comum (como Á, Ã, Ç, É, etc.)
- * - Algarismos de 0 a 9
- * - Símbolos pontuais como dois-pontos, vírgula, ponto, hífen, espaço, entre outros.
- *
- * Esta fonte é utilizada por funções gráficas que desenham caracteres e strings no display,
- * como `ssd1306_draw_char()` e `ssd1306_draw_string()`, possibilitando a exibição de textos
- * de forma simples e compacta em sistemas embarcados.
- *
- * Ideal para aplicações que requerem exibição básica de mensagens em telas pequenas, como no 
- * Raspberry Pi Pico com displays I²C SSD1306.
- */
-
-
-#ifndef SSD1306_FONT_H
-#define SSD1306_FONT_H
-
-static uint8_t font[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //0: Nothing
-    0x78, 0x14, 0x12, 0x11, 0x12, 0x14, 0x78, 0x00, //1: A
-    0x7f, 0x49, 0x49, 0x49, 0x49, 0x49, 0x7f, 0x00, //2: B
-    0x7e, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x00, //3: C
-    0x7f, 0x41, 0x41, 0x41, 0x41, 0x41, 0x7e, 0x00, //4: D
-    0x7f, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x00, //5: E
-    0x7f, 0x09, 0x09, 0x09, 0x09, 0x01, 0x01, 0x00, //6: F
-    0x7f, 0x41, 0x41, 0x41, 0x51, 0x51, 0x73, 0x00, //7: G
-    0x7f, 0x08, 0x08, 0x08, 0x08, 0x08, 0x7f, 0x00, //8: H
-    0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, //9: I
-    0x21, 0x41, 0x41, 0x3f, 0x01, 0x01, 0x01, 0x00, //10: J
-    0x00, 0x7f, 0x08, 0x08, 0x14, 0x22, 0x41, 0x00, //11: K
-    0x7f, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, //12: L
-    0x7f, 0x02, 0x04, 0x08, 0x04, 0x02, 0x7f, 0x00, //13: M
-    0x7f, 0x02, 0x04, 0x08, 0x10, 0x20, 0x7f, 0x00, //14: N
-    0x3e, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3e, 0x00, //15: O
-    0x7f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, //16: P
-    0x3e, 0x41, 0x41, 0x49, 0x51, 0x61, 0x7e, 0x00, //17: Q
-    0x7f, 0x11, 0x11, 0x11, 0x31, 0x51, 0x0e, 0x00, //18: R
-    0x46, 0x49, 0x49, 0x49, 0x49, 0x30, 0x00, 0x00, //19: S
-    0x01, 0x01, 0x01, 0x7f, 0x01, 0x01, 0x01, 0x00, //20: T
-    0x3f, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3f, 0x00, //21: U
-    0x0f, 0x10, 0x20, 0x40, 0x20, 0x10, 0x0f, 0x00, //22: V
-    0x7f, 0x20, 0x10, 0x08, 0x10, 0x20, 0x7f, 0x00, //23: W
-    0x00, 0x41, 0x22, 0x14, 0x14, 0x22, 0x41, 0x00, //24: X
-    0x01, 0x02, 0x04, 0x78, 0x04, 0x02, 0x01, 0x00, //25: Y
-    0x41, 0x61, 0x59, 0x45, 0x43, 0x41, 0x00, 0x00, //26: Z
-    0x3e, 0x41, 0x41, 0x49, 0x41, 0x41, 0x3e, 0x00, //27: 0
-    0x00, 0x00, 0x42, 0x7f, 0x40, 0x00, 0x00, 0x00, //28: 1
-    0x30, 0x49, 0x49, 0x49, 0x49, 0x46, 0x00, 0x00, //29: 2
-    0x00, 0x00, 0x49, 0x49, 0x49, 0x49, 0x36, 0x00, //30: 3
-    0x00, 0x3f, 0x20, 0x20, 0x78, 0x20, 0x20, 0x00, //31: 4
-    0x4f, 0x49, 0x49, 0x49, 0x49, 0x30, 0x00, 0x00, //32: 5
-    0x3f, 0x48, 0x48, 0x48, 0x48, 0x48, 0x30, 0x00, //33: 6
-    0x01, 0x01, 0x01, 0x61, 0x31, 0x0d, 0x03, 0x00, //34: 7
-    0x36, 0x49, 0x49, 0x49, 0x49, 0x49, 0x36, 0x00, //35: 8
-    0x06, 0x09, 0x09, 0x09, 0x09, 0x09, 0x7f, 0x00, //36: 9
-    0x00, 0x20, 0x54, 0x54, 0x54, 0x78, 0x00, 0x00,//37: a
-    0x00, 0x7f, 0x48, 0x44, 0x44, 0x38, 0x00, 0x00, //38: b
-    0x00, 0x38, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, //39: c
-    0x00, 0x38, 0x44, 0x44, 0x48, 0x7f, 0x00, 0x00, //40: d
-    0x00, 0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x00, //41: e
-    0x08, 0x7e, 0x09, 0x01, 0x02, 0x00, 0x00, 0x00, //42: f
-    0x00, 0x0c, 0x52, 0x52, 0x52, 0x3e, 0x00, 0x00, //43: g
-    0x00, 0x7f, 0x08, 0x04, 0x04, 0x78, 0x00, 0x00, //44: h
-    0x00, 0x44, 0x7d, 0x40, 0x00, 0x00, 0x00, 0x00, //45: i
-    0x00, 0x20, 0x20, 0x40, 0x44, 0x3d, 0x00, 0x00, //46: j
-    0x00, 0x7f, 0x10, 0x28, 0x44, 0x00, 0x00, 0x00,  //47: k
-    0x00, 0x41, 0x7f, 0x40, 0x00, 0x00, 0x00, 0x00, //48: l
-    0x00, 0x7c, 0x04, 0x18, 0x04, 0x78, 0x00, 0x00,  //49: m
-    0x00, 0x7c, 0x08, 0x04, 0x04, 0x78, 0x00, 0x00,  //50: n
-    0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00, 0x00, //51: o
-    0x00, 0x7c, 0x14, 0x14, 0x14, 0x08, 0x00, 0x00, //52: p
-    0x00, 0x08, 0x14, 0x14, 0x18, 0x7c, 0x00, 0x00, //53: q
-    0x00, 0x7c, 0x08, 0x04, 0x04, 0x08, 0x00, 0x00, //54: r
-    0x00, 0x48, 0x54, 0x54, 0x54, 0x24, 0x00, 0x00,  //55: s
-    0x00, 0x04, 0x3f, 0x44, 0x40, 0x20, 0x00, 0x00,  //56: t
-    0x00, 0x3c, 0x40, 0x40, 0x40, 0x3c, 0x40, 0x00, //57: u
-    0x00, 0x1c, 0x20, 0x40, 0x20, 0x1c, 0x00, 0x00,  //58: v
-    0x00, 0x3c, 0x40, 0x30, 0x40, 0x3c, 0x00, 0x00,  //59: w
-    0x00, 0x44, 0x28, 0x10, 0x28, 0x44, 0x00, 0x00,  //60: x
-    0x00, 0x0c, 0x50, 0x50, 0x50, 0x3c, 0x00, 0x00,  //61: y
-    0x00, 0x44, 0x64, 0x54, 0x4c, 0x44, 0x00, 0x00,  //62: z
-    0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00, //63: .
-    0x00, 0x00, 0x00, 0x6C, 0x6C, 0x00, 0x00, 0x00, //64: :
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, //65: #
-    0x00, 0x00, 0x00, 0x5F, 0x5F, 0x00, 0x00, 0x00, //66: !
-    0x00, 0x06, 0x01, 0x01, 0x71, 0x09, 0x06, 0x00, //67: ?
-    0x00, 0x79, 0x15, 0x15, 0x15, 0x15, 0x79, 0x00, //68: Ã
-    0x00, 0x78, 0x26, 0x25, 0x25, 0x26, 0x78, 0x00, //69: Â
-    0x00, 0x78, 0x14, 0x14, 0x16, 0x15, 0x78, 0x00, //70: Á
-    0x00, 0x78, 0x15, 0x16, 0x14, 0x14, 0x78, 0x00, //71: À
-    0x00, 0x7C, 0x54, 0x54, 0x56, 0x55, 0x44, 0x00, //72: É
-    0x00, 0x7C, 0x56, 0x55, 0x55, 0x56, 0x44, 0x00, //73: Ê
-    0x00, 0x00, 0x00, 0x7d, 0x01, 0x00, 0x00, 0x00, //74: Í
-    0x00, 0x38, 0x44, 0x44, 0x44, 0x46, 0x39, 0x00, //75: Ó
-    0x00, 0x38, 0x46, 0x45, 0x45, 0x46, 0x38, 0x00, //76: Ô
-    0x00, 0x38, 0x45, 0x45, 0x45, 0x45, 0x38, 0x00, //77: Õ
-    0x00, 0x3E, 0x40, 0x42, 0x41, 0x40, 0x3E, 0x00, //78: Ú
-    0x00, 0x1E, 0x21, 0x61, 0x61, 0x21, 0x21, 0x00, //79: Ç
-    0x00, 0x1C, 0x22, 0x62, 0x62, 0x22, 0x22, 0x00, //80: ç
-    0x00, 0x00, 0x20, 0x55, 0x55, 0x55, 0x79, 0x00, //81: ã
-    0x00, 0x00, 0x20, 0x54, 0x56, 0x55, 0x78, 0x00, //82: á
-    0x00, 0x00, 0x20, 0x55, 0x56, 0x54, 0x78, 0x00, //83: à
-    0x00, 0x00, 0x20, 0x56, 0x55, 0x55, 0x7A, 0x00, //84: â
-    0x00, 0x38, 0x54, 0x56, 0x55, 0x18, 0x00, 0x00, //85: é
-    0x00, 0x3A, 0x55, 0x55, 0x55, 0x1A, 0x00, 0x00, //86: ê
-    0x00, 0x44, 0x7e, 0x41, 0x00, 0x00, 0x00, 0x00, //87: í
-    0x00, 0x38, 0x44, 0x46, 0x45, 0x38, 0x00, 0x00, //88: ó
-    0x00, 0x3A, 0x45, 0x45, 0x45, 0x3A, 0x00, 0x00, //89: ô
-    0x00, 0x3c, 0x40, 0x42, 0x41, 0x3c, 0x40, 0x00, //90: ú
-    0x00, 0x40, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, //91: , (vírgula)
-    0x00, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, //92: - (vírgula)
-
-};
-
-#endif
-
@@ -9,7 +9,7 @@ extern uint32_t ultimo_ip_bin;
 extern bool mqtt_iniciado;
 
 // Buffer OLED e área global
-extern uint8_t buffer_oled[];
+extern uint8_t *const buffer_oled;
 extern struct render_area area;
 
 //Variável de controle do ping
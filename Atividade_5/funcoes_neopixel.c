@@ -1,32 +1,27 @@
 #include "funcoes_neopixel.h"
-#include "ws2818b.pio.h"
+#include "neopixel_tx.h"
 #include "pico/stdlib.h"
-#include "hardware/clocks.h"
-
-uint ordem[] = {
-    4, 5, 14, 15, 24,
-    3, 6, 13, 16, 23,
-    2, 7, 12, 17, 22,
-    1, 8, 11, 18, 21,
-    0, 9, 10, 19, 20
-};
 
 npLED_t leds[LED_COUNT];
 
 PIO np_pio;
 uint sm;
 
-void npInit(uint pin) {
-    uint offset = pio_add_program(pio0, &ws2818b_program);
-    np_pio = pio0;
+// Quadro empacotado (uma palavra GRB por LED) lido pelo DMA durante a transmissão
+static uint32_t quadro[LED_COUNT];
+static np_tx_t np_tx;
 
-    sm = pio_claim_unused_sm(np_pio, false);
-    if (sm < 0) {
-        np_pio = pio1;
-        sm = pio_claim_unused_sm(np_pio, true);
-    }
+// Índice na fita de cada posição (y * NUM_COLUNAS + x) da matriz, com y = 0 na linha de cima
+static uint8_t mapa[LED_COUNT];
 
-    ws2818b_program_init(np_pio, sm, offset, pin, 800000.f);
+void npInit(uint pin) {
+    // Máquina de estados livre em pio0 ou pio1 e um canal DMA
+    if (!np_tx_init(&np_tx, pin, quadro, LED_COUNT)) {
+        panic("NeoPixel: sem máquina PIO ou canal DMA livre");
+    }
+    np_pio = np_tx.pio;
+    sm = np_tx.sm;
+    np_matriz_mapear(mapa, NUM_COLUNAS, NUM_LINHAS, MATRIZ_SERPENTINA, MATRIZ_ROTACAO);
 
     for (uint i = 0; i < LED_COUNT; ++i) {
         leds[i].R = 0;
@@ -52,22 +47,19 @@ void npSetAll(uint8_t r, uint8_t g, uint8_t b) {
 }
 
 
+// Acende as primeiras `colunas` posições da linha (da esquerda para a direita)
 void acenderFileira(uint linha, uint8_t r, uint8_t g, uint8_t b, uint colunas) {
-    uint inicio = linha * colunas;
+    if (linha >= NUM_LINHAS) return;
+    if (colunas > NUM_COLUNAS) colunas = NUM_COLUNAS;
     for (uint i = 0; i < colunas; ++i) {
-        uint index = inicio + i;
-        if (index < LED_COUNT) {
-            npSetLED(index, r, g, b);
-        }
+        npSetLED(mapa[linha * NUM_COLUNAS + i], r, g, b);
     }
 }
 
 void acender_coluna(uint8_t coluna, uint8_t r, uint8_t g, uint8_t b) {
+    if (coluna >= NUM_COLUNAS) return;
     for (int linha = 0; linha < NUM_LINHAS; linha++) {
-        uint index = linha * NUM_COLUNAS + coluna;
-        leds[index].R = r;
-        leds[index].G = g;
-        leds[index].B = b;
+        npSetLED(mapa[linha * NUM_COLUNAS + coluna], r, g, b);
     }
     npWrite();
 }
@@ -78,15 +70,24 @@ void npClear() {
         npSetLED(i, 0, 0, 0);
 }
 
+// Copia leds[] para o quadro e dispara o DMA sem esperar o fim da transmissão;
+// o reset de 100 us entre quadros é respeitado pelo próximo envio
 void npWrite() {
+    np_tx_wait(&np_tx);
     for (uint i = 0; i < LED_COUNT; ++i) {
-        pio_sm_put_blocking(np_pio, sm, leds[i].G);
-        pio_sm_put_blocking(np_pio, sm, leds[i].R);
-        pio_sm_put_blocking(np_pio, sm, leds[i].B);
+        quadro[i] = np_tx_word(leds[i].R, leds[i].G, leds[i].B);
     }
-    sleep_us(100);
+    np_tx_start(&np_tx);
 }  
 
+bool npBusy() {
+    return np_tx_busy(&np_tx);
+}
+
+void npWait() {
+    np_tx_wait(&np_tx);
+}
+
 void npAcendeLED(uint index, uint8_t r, uint8_t g, uint8_t b) {
     if (index < LED_COUNT) {
         npSetLED(index, r, g, b);
@@ -1,23 +1,26 @@
 #ifndef FUNCOES_NEOPIXEL_H
 #define FUNCOES_NEOPIXEL_H
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "hardware/pio.h"
 #include <time.h>
 #include <stdlib.h>
 #include "hardware/adc.h"
 #include "pico/types.h"
+#include "np_matriz.h"
 
 #define LED_COUNT 25
 #define LED_PIN 7
 #define NUM_COLUNAS 5
 #define NUM_LINHAS 5
+#define MATRIZ_SERPENTINA true              // fita em zigue-zague
+#define MATRIZ_ROTACAO NP_MATRIZ_ROT_180    // LED 0 no canto inferior direito
 
 typedef struct {
     uint8_t G, R, B;
 } npLED_t;
 
-extern uint ordem[];
 extern npLED_t leds[];
 
 extern PIO np_pio;
@@ -31,6 +34,8 @@ void acenderFileira(uint linha, uint8_t r, uint8_t g, uint8_t b, uint colunas);
 void acender_coluna(uint8_t coluna, uint8_t r, uint8_t g, uint8_t b);
 void npClear();
 void npWrite();
+bool npBusy();
+void npWait();
 void npAcendeLED(uint index, uint8_t r, uint8_t g, uint8_t b);
 void inicializar_aleatorio();
 int numero_aleatorio(int min, int max);
@@ -78,6 +78,7 @@ void oled_clear(uint8_t *ssd, struct render_area *area)
 {
     // Preenche o buffer com zeros (todos os pixels apagados)
     memset(ssd, 0, ssd1306_buffer_length);
+    ssd1306_mark_dirty(0, 0, ssd1306_width - 1, ssd1306_height - 1);
 
     // Envia o buffer atualizado para o display
     render_on_display(ssd, area);
@@ -45,8 +45,12 @@ bool mqtt_iniciado = false;
  * Este buffer contém os dados de pixels que serão renderizados na tela.
  * Seu tamanho é definido pela função `ssd1306_buffer_length`, de acordo com
  * a resolução do display (tipicamente 128x64).
+ *
+ * O armazenamento reserva `ssd1306_buffer_prefix` byte antes dos pixels para o
+ * byte de controle I²C; `buffer_oled` aponta para o primeiro pixel.
  */
-uint8_t buffer_oled[ssd1306_buffer_length];
+static uint8_t framebuffer_oled[ssd1306_framebuffer_length];
+uint8_t *const buffer_oled = &framebuffer_oled[ssd1306_buffer_prefix];
 
 /**
  * @brief Estrutura que define a área da tela a ser desenhada.
@@ -52,7 +52,7 @@ void tratar_mensagem(MensagemWiFi msg) {
             ssd1306_draw_utf8_multiline(buffer_oled, 0, 32, "ACK do PING FALHOU");
             set_rgb_pwm(65535, 0, 0); // vermelho
         }
-        render_on_display(buffer_oled, &area);
+        render_dirty_on_display(buffer_oled);
         return;
     }
 
@@ -119,9 +119,10 @@ void tratar_ip_binario(uint32_t ip_bin) {
  * Atualiza a linha 16 do display com a palavra "MQTT: <status>".
  */
 void exibir_status_mqtt(const char *texto) {
+    ssd1306_clear_rect(buffer_oled, 40, 16, ssd1306_width - 40, 8);  // apaga o status anterior
     ssd1306_draw_utf8_string(buffer_oled, 0, 16, "MQTT: ");
     ssd1306_draw_utf8_string(buffer_oled, 40, 16, texto);
-    render_on_display(buffer_oled, &area);
+    render_dirty_on_display(buffer_oled);  // envia só a linha alterada
 
     printf("[MQTT] %s\n", texto);
 }
@@ -144,7 +145,7 @@ void set_novo_intervalo_ping(uint32_t novo_intervalo) {
         // Exibe abaixo da linha do ACK (linha 32 → y = 42 px)
         ssd1306_clear_area(buffer_oled, 0, 40, 127, 50);
         ssd1306_draw_utf8_multiline(buffer_oled, 0, 42, buffer_msg);
-        render_on_display(buffer_oled, &area);
+        render_dirty_on_display(buffer_oled);
 
         printf("[INFO] Intervalo atualizado para %u ms\n", novo_intervalo);
     } else {
@@ -187,8 +188,8 @@ void mostrar_cor_rgb(uint8_t codigo) {
     // Atualiza a linha inferior do OLED
     ssd1306_clear_area(buffer_oled, 0, 54, 127, 63);  // limpa linha inferior
     ssd1306_draw_utf8_multiline(buffer_oled, 0, 56, nome_cor);
-    render_on_display(buffer_oled, &area);
+    render_dirty_on_display(buffer_oled);
     sleep_ms(3500);
     ssd1306_clear_area(buffer_oled, 0, 54, 127, 63);  // limpa linha inferior
-    render_on_display(buffer_oled, &area);
+    render_dirty_on_display(buffer_oled);
 }
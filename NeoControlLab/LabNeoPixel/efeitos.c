@@ -1,15 +1,38 @@
 #include "LabNeoPixel/neopixel_driver.h"
 #include "LabNeoPixel/efeitos.h"
+#include "np_efeitos.h"
 #include "pico/stdlib.h"
-#include "testes_cores.h"
-#include <stdlib.h> 
 
 
+// Cada efeito é um passo de np_efeitos.h que desenha um quadro inteiro e devolve o prazo do
+// próximo. As versões bloqueantes abaixo só tocam esses passos em leds[] com npWrite() e sleep
+// entre os quadros.
+
+_Static_assert(LED_COUNT == NP_EFEITO_LEDS && NUM_COLUNAS == NP_EFEITO_LADO, "os efeitos são para a matriz 5x5");
+
+// Toca um efeito do início ao fim em leds[], bloqueando até o último quadro
+static void tocarComDados(np_efeito_passo_t passo, const void *dados, uint8_t r, uint8_t g, uint8_t b,
+                          uint16_t delay_ms) {
+    np_efeito_t e;
+    np_efeito_iniciar(&e, passo, r, g, b, delay_ms);
+    e.tela = leds;
+    e.dados = dados;
+
+    uint64_t prazo;
+    while ((prazo = e.passo(&e, time_us_64())) != NP_EFEITO_FIM) {
+        npWrite();
+        sleep_until(from_us_since_boot(prazo));
+    }
+}
+
+static void tocar(np_efeito_passo_t passo, uint8_t r, uint8_t g, uint8_t b, uint16_t delay_ms) {
+    tocarComDados(passo, NULL, r, g, b, delay_ms);
+}
+
 // Acende todos os LEDs de uma linha
 void acenderFileira(uint8_t y, uint8_t r, uint8_t g, uint8_t b) {
     for (uint x = 0; x < NUM_COLUNAS; x++) {
-        uint index = getLEDIndex(x, y);
-        npSetLED(index, r, g, b);
+        npSetXY(x, y, r, g, b);
     }
     npWrite();
 }
@@ -17,149 +40,47 @@ void acenderFileira(uint8_t y, uint8_t r, uint8_t g, uint8_t b) {
 // Acende todos os LEDs de uma coluna
 void acenderColuna(uint8_t x, uint8_t r, uint8_t g, uint8_t b) {
     for (uint y = 0; y < NUM_LINHAS; y++) {
-        uint index = getLEDIndex(x, y);
-        npSetLED(index, r, g, b);
+        npSetXY(x, y, r, g, b);
     }
     npWrite();
 }
 
-// Preenche a matriz em espiral do canto superior esquerdo ao centro
 void efeitoEspiral(uint8_t r, uint8_t g, uint8_t b, uint16_t delay_ms) {
-    const uint8_t ordem_espiral[25][2] = {
-        {0,0},{1,0},{2,0},{3,0},{4,0},
-        {4,1},{4,2},{4,3},{4,4},
-        {3,4},{2,4},{1,4},{0,4},
-        {0,3},{0,2},{0,1},
-        {1,1},{2,1},{3,1},
-        {3,2},{3,3},
-        {2,3},{1,3},
-        {1,2},{2,2}
-    };
-
-    npClear();
-    for (uint i = 0; i < 25; ++i) {
-        uint x = ordem_espiral[i][0];
-        uint y = ordem_espiral[i][1];
-        uint index = getLEDIndex(x, y);
-        npSetLED(index, r, g, b);
-        npWrite();
-        sleep_ms(delay_ms);
-    }
+    tocar(np_efeito_espiral, r, g, b, delay_ms);
 }
 
-// Efeito de onda vertical com brilho suavizado por linha
 void efeitoOndaVertical(uint8_t r, uint8_t g, uint8_t b, uint16_t delay_ms) {
-    for (int fase = 0; fase < NUM_LINHAS + 3; ++fase) {
-        npClear();
-        for (int y = 0; y < NUM_LINHAS; ++y) {
-            float intensidade = 1.0f - 0.25f * abs(fase - y);
-            if (intensidade < 0) intensidade = 0;
-
-            for (int x = 0; x < NUM_COLUNAS; ++x) {
-                uint index = getLEDIndex(x, y);
-                npSetLED(index, r * intensidade, g * intensidade, b * intensidade);
-            }
-        }
-        npWrite();
-        sleep_ms(delay_ms);
-    }
+    tocar(np_efeito_onda_vertical, r, g, b, delay_ms);
 }
 
-// Preenche a matriz em espiral do canto superior esquerdo ao centro, inversa.
 void efeitoEspiralInversa(uint8_t r, uint8_t g, uint8_t b, uint16_t delay_ms) {
-    const uint8_t ordem_espiral[25][2] = {
-        {2,2},{1,2},{1,3},{2,3},{3,3},
-        {3,2},{3,1},{2,1},{1,1},
-        {0,1},{0,2},{0,3},{0,4},
-        {1,4},{2,4},{3,4},
-        {4,4},{4,3},{4,2},
-        {4,1},{4,0},
-        {3,0},{2,0},
-        {1,0},{0,0}
-    };
-
-    npClear();
-    for (uint i = 0; i < 25; ++i) {
-        uint x = ordem_espiral[i][0];
-        uint y = ordem_espiral[i][1];
-        uint index = getLEDIndex(x, y);
-        npSetLED(index, r, g, b);
-        npWrite();
-        sleep_ms(delay_ms);
-    }
+    tocar(np_efeito_espiral_inversa, r, g, b, delay_ms);
 }
 
-
-//Onda com efeito vertical brilho
 void efeitoOndaVerticalBrilho(uint8_t r, uint8_t g, uint8_t b, uint16_t delay_ms) {
-    for (uint8_t passo = 0; passo < NUM_LINHAS; ++passo) {
-        npClear();
-
-        for (uint8_t y = 0; y <= passo; ++y) {
-            // Brilho progressivo proporcional à linha atual
-            float brilho = ((float)(y + 1)) / NUM_LINHAS;
-
-            for (uint8_t x = 0; x < NUM_COLUNAS; ++x) {
-                uint index = getLEDIndex(x, y);
-                npSetLED(index, r * brilho, g * brilho, b * brilho);
-            }
-        }
-
-        npWrite();
-        sleep_ms(delay_ms);
-    }
+    tocar(np_efeito_onda_vertical_brilho, r, g, b, delay_ms);
 }
 
-
 void efeitoFileirasColoridas(uint8_t r, uint8_t g, uint8_t b, uint16_t delay_ms) {
-    for (uint8_t y = 0; y < NUM_LINHAS; ++y) {
-        npClear();
-
-        float brilho = ((float)(y + 1)) / NUM_LINHAS;
-
-        acenderFileira(y, r * brilho, g * brilho, b * brilho);
-
-        npWrite();
-        sleep_ms(delay_ms);
-    }
+    tocar(np_efeito_fileiras, r, g, b, delay_ms);
 }
 
 void efeitoFileirasColoridasReverso(uint8_t r, uint8_t g, uint8_t b, uint16_t delay_ms) {
-    for (int8_t y = NUM_LINHAS - 1; y >= 0; --y) {
-        npClear();
-
-        float brilho = ((float)(NUM_LINHAS - y)) / NUM_LINHAS;
-
-        acenderFileira(y, r * brilho, g * brilho, b * brilho);
-
-        npWrite();
-        sleep_ms(delay_ms);
-    }
+    tocar(np_efeito_fileiras_reverso, r, g, b, delay_ms);
 }
 
-
 void efeitoColunasColoridas(uint8_t r, uint8_t g, uint8_t b, uint16_t delay_ms) {
-    for (uint8_t x = 0; x < NUM_COLUNAS; ++x) {
-        npClear();
-
-        float brilho = ((float)(x + 1)) / NUM_COLUNAS;
-
-        acenderColuna(x, r * brilho, g * brilho, b * brilho);
-
-        npWrite();
-        sleep_ms(delay_ms);
-    }
+    tocar(np_efeito_colunas, r, g, b, delay_ms);
 }
 
 void efeitoColunasColoridasReverso(uint8_t r, uint8_t g, uint8_t b, uint16_t delay_ms) {
-    for (int8_t x = NUM_COLUNAS - 1; x >= 0; --x) {
-        npClear();
-
-        float brilho = ((float)(NUM_COLUNAS - x)) / NUM_COLUNAS;
-
-        acenderColuna(x, r * brilho, g * brilho, b * brilho);
+    tocar(np_efeito_colunas_reverso, r, g, b, delay_ms);
+}
 
-        npWrite();
-        sleep_ms(delay_ms);
-    }
+void efeitoTextoRolante(const char *texto, uint8_t r, uint8_t g, uint8_t b, uint16_t delay_ms) {
+    tocarComDados(np_efeito_texto_rolante, texto, r, g, b, delay_ms);
 }
+
+void efeitoPaleta(const np_paleta_t *paleta, uint16_t delay_ms) {
+    tocarComDados(np_efeito_paleta, paleta, 0, 0, 0, delay_ms);
+}
\ No newline at end of file
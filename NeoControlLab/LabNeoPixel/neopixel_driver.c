@@ -1,35 +1,165 @@
+#include <string.h>
 #include "neopixel_driver.h"
-#include "ws2818b.pio.h"
+#include "neopixel_tx.h"
+#include "np_brilho.h"
+#include "np_glifos.h"
+
+_Static_assert(LED_COUNT == NP_GLIFO_LEDS, "os glifos de np_glifos.h são 5x5");
 
 npLED_t leds[LED_COUNT];
+npFita_t npMatriz;
 PIO np_pio;
 int sm;
 
+// Quadros empacotados da matriz (uma palavra GRB por LED): enquanto um está no fio, o outro
+// recebe o próximo quadro. leds[] é o buffer de desenho dos efeitos e só é lido no present.
+static uint32_t quadros[2][LED_COUNT];
+
+// Índice na fita de cada posição de leds[], calculado uma vez no npInit()
+static uint8_t mapa[LED_COUNT];
+
+// Brilho global (8.8) e gama aplicados no present de todas as fitas, por tabela; com o
+// pontilhado ativo, a fração de cada canal que não coube no byte é carregada para o quadro
+// seguinte (só nas fitas com restos, hoje a matriz)
+static np_brilho_t brilho_global;
+static bool pontilhado;
+static uint8_t restos[LED_COUNT][3];
+
 void npInit(uint pin) {
-    uint offset = pio_add_program(pio0, &ws2818b_program);
-    np_pio = pio0;
-    sm = 0; // Usar SM 0 fixamente
-    pio_sm_claim(np_pio, sm);
-    ws2818b_program_init(np_pio, sm, offset, pin, 800000.f);
+    np_brilho_init(&brilho_global, false);
+    np_matriz_mapear(mapa, NUM_COLUNAS, NUM_LINHAS, MATRIZ_SERPENTINA, MATRIZ_ROTACAO);
+    if (!npFitaInit(&npMatriz, pin, leds, quadros[0], LED_COUNT)) {
+        panic("NeoPixel: sem máquina PIO ou canal DMA livre");
+    }
+    npMatriz.mapa = mapa;
+    npMatriz.restos = restos;
+    np_pio = npMatriz.tx.pio;
+    sm = (int)npMatriz.tx.sm;
     npClear();
 }
 
-void npWrite(void) {
-    for (uint i = 0; i < LED_COUNT; ++i) {
-        pio_sm_put_blocking(np_pio, sm, leds[i].G);
-        pio_sm_put_blocking(np_pio, sm, leds[i].R);
-        pio_sm_put_blocking(np_pio, sm, leds[i].B);
+// Prepara uma fita de n_leds LEDs no pino indicado. leds_fita é a imagem a enviar e quadros
+// precisa de 2 * n_leds palavras (buffer duplo); os dois ficam com o chamador, que os mantém
+// vivos enquanto a fita existir. Retorna false se não houver máquina de estados ou canal DMA
+// livre.
+bool npFitaInit(npFita_t *fita, uint pin, npLED_t *leds_fita, uint32_t *quadros_fita, uint n_leds) {
+    fita->leds = leds_fita;
+    fita->n_leds = n_leds;
+    fita->mapa = NULL;
+    fita->restos = NULL;
+    fita->tx.dma_chan = -1;
+    if (!np_tx_init(&fita->tx, pin, quadros_fita, n_leds)) {
+        return false;
+    }
+    np_tx_set_double_buffer(&fita->tx, quadros_fita + n_leds);
+    return true;
+}
+
+// Monta no quadro livre da fita os canais de sua imagem escalados por escala (8.8) e passados
+// pela tabela de brilho global. Não dispara o envio.
+static void empacotar(npFita_t *fita, uint16_t escala) {
+    uint32_t *quadro = np_tx_back_buffer(&fita->tx);
+    bool pontilhar = pontilhado && fita->restos != NULL;
+
+    for (uint i = 0; i < fita->n_leds; ++i) {
+        uint8_t r = np_escalar(fita->leds[i].R, escala);
+        uint8_t g = np_escalar(fita->leds[i].G, escala);
+        uint8_t b = np_escalar(fita->leds[i].B, escala);
+        if (pontilhar) {
+            r = np_brilho_pontilhar(&brilho_global, r, &fita->restos[i][0]);
+            g = np_brilho_pontilhar(&brilho_global, g, &fita->restos[i][1]);
+            b = np_brilho_pontilhar(&brilho_global, b, &fita->restos[i][2]);
+        }
+        else {
+            r = np_brilho_aplicar(&brilho_global, r);
+            g = np_brilho_aplicar(&brilho_global, g);
+            b = np_brilho_aplicar(&brilho_global, b);
+        }
+        quadro[fita->mapa ? fita->mapa[i] : i] = np_tx_word(r, g, b);
+    }
+}
+
+// Present de uma fita: copia a imagem para o quadro livre e o entrega ao transmissor, sem
+// esperar. Se o quadro anterior ainda estiver no fio, este sai logo depois (vale o present mais
+// recente); a imagem pode ser alterada assim que a função retorna.
+void npFitaShow(npFita_t *fita) {
+    empacotar(fita, NP_BRILHO_MAX);
+    np_tx_present(&fita->tx);
+}
+
+// Present de várias fitas (até oito, uma por máquina de estados): todas são empacotadas primeiro
+// e os canais DMA disparam juntos, então as transmissões se sobrepõem e a atualização leva o
+// tempo da fita mais longa, e não a soma de todas
+void npFitaShowVarias(npFita_t *const *fitas, uint n) {
+    np_tx_t *txs[NUM_PIO_STATE_MACHINES * 2];
+
+    if (n > NUM_PIO_STATE_MACHINES * 2) n = NUM_PIO_STATE_MACHINES * 2;
+    for (uint i = 0; i < n; ++i) {
+        empacotar(fitas[i], NP_BRILHO_MAX);
+        txs[i] = &fitas[i]->tx;
+    }
+    np_tx_present_grupo(txs, n);
+}
+
+bool npFitaBusy(npFita_t *fita) {
+    return np_tx_busy(&fita->tx);
+}
+
+void npFitaWait(npFita_t *fita) {
+    np_tx_wait(&fita->tx);
+}
+
+// Libera a máquina de estados e o canal DMA da fita (aguarda a transmissão em andamento)
+void npFitaRelease(npFita_t *fita) {
+    if (fita->tx.dma_chan >= 0) {
+        np_tx_release(&fita->tx);
     }
 }
 
+// Present da matriz (leds[])
+void npShow(void) {
+    npFitaShow(&npMatriz);
+}
+
+bool npBusy(void) {
+    return npFitaBusy(&npMatriz);
+}
+
+void npWait(void) {
+    npFitaWait(&npMatriz);
+}
+
+void npWrite(void) {
+    npShow();
+}
+
+// Envia o quadro com brilho de 0.0 a 1.0 sobre o brilho global; o float é convertido para
+// 8.8 uma vez por chamada, e não multiplicado em cada canal
 void npWriteComBrilho(float brilho) {
+    uint16_t escala = NP_BRILHO_MAX;
+    if (brilho <= 0.0f) {
+        escala = 0;
+    }
+    else if (brilho < 1.0f) {
+        escala = (uint16_t)(brilho * NP_BRILHO_MAX);
+    }
+    empacotar(&npMatriz, escala);
+    np_tx_present(&npMatriz.tx);
+}
+
+// Brilho global em 8.8 (NP_BRILHO_MAX = 100 %), aplicado a todos os quadros seguintes
+void npSetBrilho(uint16_t escala) {
+    np_brilho_set(&brilho_global, escala);
+}
+
+void npSetGama(bool ativa) {
+    np_brilho_set_gama(&brilho_global, ativa);
+}
+
+void npSetPontilhado(bool ativo) {
+    pontilhado = ativo;
     for (uint i = 0; i < LED_COUNT; ++i) {
-        uint8_t r = leds[i].R * brilho;
-        uint8_t g = leds[i].G * brilho;
-        uint8_t b = leds[i].B * brilho;
-        pio_sm_put_blocking(np_pio, sm, g);
-        pio_sm_put_blocking(np_pio, sm, r);
-        pio_sm_put_blocking(np_pio, sm, b);
+        restos[i][0] = restos[i][1] = restos[i][2] = 0;
     }
 }
 
@@ -52,15 +182,82 @@ void npClear(void) {
 }
 
 void liberar_maquina_pio(PIO pio, uint sm_id) {
-    if (sm_id < 4) {
+    if (pio == npMatriz.tx.pio && sm_id == npMatriz.tx.sm && npMatriz.tx.dma_chan >= 0) {
+        npFitaRelease(&npMatriz);
+    }
+    else if (sm_id < 4) {
         pio_sm_set_enabled(pio, sm_id, false);
         pio_sm_unclaim(pio, sm_id);
     }
 }
 
+// Posição de (x, y) em leds[]; fora da matriz devolve 0, como antes
 uint getLEDIndex(uint x, uint y) {
     if (x >= NUM_COLUNAS || y >= NUM_LINHAS) return 0;
-    uint linha_fisica = NUM_LINHAS - 1 - y;
-    uint base = linha_fisica * NUM_COLUNAS;
-    return (linha_fisica % 2 == 0) ? base + (NUM_COLUNAS - 1 - x) : base + x;
+    return y * NUM_COLUNAS + x;
+}
+
+void npSetXY(uint x, uint y, uint8_t r, uint8_t g, uint8_t b) {
+    if (x < NUM_COLUNAS && y < NUM_LINHAS) {
+        npSetLED(y * NUM_COLUNAS + x, r, g, b);
+    }
+}
+
+// Copia NUM_COLUNAS LEDs de origem para a linha y (uma cópia contígua)
+void npBlitLinha(uint y, const npLED_t *origem) {
+    if (y < NUM_LINHAS) {
+        memcpy(&leds[y * NUM_COLUNAS], origem, NUM_COLUNAS * sizeof(npLED_t));
+    }
+}
+
+// Copia NUM_LINHAS LEDs de origem (de cima para baixo) para a coluna x
+void npBlitColuna(uint x, const npLED_t *origem) {
+    if (x < NUM_COLUNAS) {
+        for (uint y = 0; y < NUM_LINHAS; ++y) {
+            leds[y * NUM_COLUNAS + x] = origem[y];
+        }
+    }
+}
+
+// Rolagens: deslocam a imagem n posições e apagam o que entra pela borda. Cada linha é um
+// bloco contíguo de leds[], então as horizontais movem linha por linha e as verticais movem
+// todas as linhas de uma vez.
+void npRolarEsquerda(uint n) {
+    if (n > NUM_COLUNAS) n = NUM_COLUNAS;
+    for (uint y = 0; y < NUM_LINHAS; ++y) {
+        npLED_t *linha = &leds[y * NUM_COLUNAS];
+        memmove(linha, linha + n, (NUM_COLUNAS - n) * sizeof(npLED_t));
+        memset(linha + NUM_COLUNAS - n, 0, n * sizeof(npLED_t));
+    }
+}
+
+void npRolarDireita(uint n) {
+    if (n > NUM_COLUNAS) n = NUM_COLUNAS;
+    for (uint y = 0; y < NUM_LINHAS; ++y) {
+        npLED_t *linha = &leds[y * NUM_COLUNAS];
+        memmove(linha + n, linha, (NUM_COLUNAS - n) * sizeof(npLED_t));
+        memset(linha, 0, n * sizeof(npLED_t));
+    }
+}
+
+void npRolarCima(uint n) {
+    if (n > NUM_LINHAS) n = NUM_LINHAS;
+    memmove(leds, &leds[n * NUM_COLUNAS], (NUM_LINHAS - n) * NUM_COLUNAS * sizeof(npLED_t));
+    memset(&leds[(NUM_LINHAS - n) * NUM_COLUNAS], 0, n * NUM_COLUNAS * sizeof(npLED_t));
+}
+
+void npRolarBaixo(uint n) {
+    if (n > NUM_LINHAS) n = NUM_LINHAS;
+    memmove(&leds[n * NUM_COLUNAS], leds, (NUM_LINHAS - n) * NUM_COLUNAS * sizeof(npLED_t));
+    memset(leds, 0, n * NUM_COLUNAS * sizeof(npLED_t));
+}
+
+// Pinta os LEDs acesos do glifo (np_glifos.h), deslocado dx colunas e dy linhas; os apagados
+// ficam como estão, então glifos podem ser sobrepostos
+void npDesenharGlifo(uint32_t glifo, int dx, int dy, uint8_t r, uint8_t g, uint8_t b) {
+    uint32_t restante = np_glifo_deslocar(glifo, dx, dy);
+    int bit;
+    while ((bit = np_glifo_proximo(&restante)) >= 0) {
+        npSetLED((uint8_t)(LED_COUNT - 1 - bit), r, g, b);
+    }
 }
@@ -1,34 +1,73 @@
 #ifndef NEOPIXEL_DRIVER_H
 #define NEOPIXEL_DRIVER_H
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "hardware/pio.h"
+#include "neopixel_tx.h"
+#include "np_cor.h"
+#include "np_matriz.h"
 
 #define LED_COUNT 25
 #define LED_PIN 7
 #define NUM_COLUNAS 5
 #define NUM_LINHAS 5
+#define MATRIZ_SERPENTINA true              // fita em zigue-zague
+#define MATRIZ_ROTACAO NP_MATRIZ_ROT_180    // BitDogLab: LED 0 no canto inferior direito
 #define COR_APAGA   0
 #define COR_MIN     64
 #define COR_INTER   128
 #define COR_ALTA    192
 #define COR_MAX     255
 
+// Mesmo layout de np_cor_t (G, R, B): quadros de LEDs servem direto às funções de np_cor.h
+typedef np_cor_t npLED_t;
+
+// Uma fita NeoPixel com máquina de estados (a primeira livre em pio0 ou pio1), canal DMA e
+// buffers próprios. A matriz da placa é a fita npMatriz, desenhada em leds[]; fitas externas
+// são criadas com npFitaInit() sobre buffers do chamador.
 typedef struct {
-    uint8_t G, R, B;
-} npLED_t;
+    npLED_t *leds;              // imagem a enviar, n_leds LEDs
+    uint n_leds;
+    const uint8_t *mapa;        // índice na fita de cada LED de leds[], ou NULL (mesma ordem)
+    uint8_t (*restos)[3];       // frações do pontilhado por LED, ou NULL (fita sem pontilhado)
+    np_tx_t tx;
+} npFita_t;
 
+// Imagem da matriz em ordem lógica: linha a linha, de cima para baixo, com x crescendo para a
+// direita (leds[y * NUM_COLUNAS + x]). A ordem física da fita só é aplicada no envio.
 extern npLED_t leds[LED_COUNT];
+extern npFita_t npMatriz;
 extern PIO np_pio;
 extern int sm;
 
 void npInit(uint pin);
+bool npFitaInit(npFita_t *fita, uint pin, npLED_t *leds_fita, uint32_t *quadros, uint n_leds);
+void npFitaShow(npFita_t *fita);
+void npFitaShowVarias(npFita_t *const *fitas, uint n);
+bool npFitaBusy(npFita_t *fita);
+void npFitaWait(npFita_t *fita);
+void npFitaRelease(npFita_t *fita);
 void npWrite(void);
+void npShow(void);
+bool npBusy(void);
+void npWait(void);
 void npWriteComBrilho(float brilho);
+void npSetBrilho(uint16_t escala);
+void npSetGama(bool ativa);
+void npSetPontilhado(bool ativo);
 void npSetLED(uint8_t index, uint8_t r, uint8_t g, uint8_t b);
 void npSetAll(uint8_t r, uint8_t g, uint8_t b);
 void npClear(void);
 void liberar_maquina_pio(PIO pio, uint sm);
 uint getLEDIndex(uint x, uint y);
+void npSetXY(uint x, uint y, uint8_t r, uint8_t g, uint8_t b);
+void npBlitLinha(uint y, const npLED_t *origem);
+void npBlitColuna(uint x, const npLED_t *origem);
+void npRolarEsquerda(uint n);
+void npRolarDireita(uint n);
+void npRolarCima(uint n);
+void npRolarBaixo(uint n);
+void npDesenharGlifo(uint32_t glifo, int dx, int dy, uint8_t r, uint8_t g, uint8_t b);
 
 #endif
\ No newline at end of file
@@ -40,27 +40,7 @@ int sorteia_entre(int min, int max)
 // Exibe o número sorteado de 1 a 6
 void mostrar_numero_sorteado(int numero)
 {
-    switch (numero)
-    {
-    case 1:
-        mostrar_numero_1();
-        break;
-    case 2:
-        mostrar_numero_2();
-        break;
-    case 3:
-        mostrar_numero_3();
-        break;
-    case 4:
-        mostrar_numero_4();
-        break;
-    case 5:
-        mostrar_numero_5();
-        break;
-    case 6:
-        mostrar_numero_6();
-        break;
-    }
+    mostrar_numero(numero);
 }
 
 // Callback para debounce do botão
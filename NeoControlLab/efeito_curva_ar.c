@@ -1,59 +1,41 @@
-#include <stdlib.h>             // rand() e RAND_MAX
 #include "pico/stdlib.h"
 #include "LabNeoPixel/neopixel_driver.h"
 #include "efeito_curva_ar.h"
+#include "sinal_ar.h"
 
 #define TAM 5
-static float coef[TAM] = {0.4, -0.2, 0.15, 0.1, 0.05};
-static float estados[TAM] = {0.0};
-static int coluna_atual = 0;
-
-extern npLED_t leds[LED_COUNT];  
-
-
-// Gera ruído aleatório entre -amp e +amp
-static float ruido_aleatorio(float amp) {
-    return ((float)rand() / RAND_MAX) * 2 * amp - amp;
-}
-
-// Gera próximo valor da série AR(5)
-static float proximo_valor_ar() {
-    float valor = 0.0;
-    for (int i = 0; i < TAM; i++) {
-        valor += coef[i] * estados[i];
-    }
-    valor += ruido_aleatorio(1.0f);
-
-    for (int i = TAM - 1; i > 0; i--) {
-        estados[i] = estados[i - 1];
-    }
-    estados[0] = valor;
-
-    return valor;
+#define SEMENTE_PADRAO 0x2545F491u
+
+// AR(5) em Q15: 0.4, -0.2, 0.15, 0.1, 0.05, com ruído uniforme em [-1, 1]
+static const int32_t coef[TAM] = {
+    SINAL_AR_Q15(0.4), SINAL_AR_Q15(-0.2), SINAL_AR_Q15(0.15), SINAL_AR_Q15(0.1), SINAL_AR_Q15(0.05)
+};
+static sinal_ar_t serie;
+static bool serie_iniciada = false;
+
+// Reinicia a curva com uma semente (a mesma semente repete a mesma curva)
+void efeitoCurvaSemear(uint32_t semente) {
+    sinal_ar_init(&serie, coef, TAM, SINAL_AR_Q15_UM, semente);
+    serie_iniciada = true;
 }
 
 // Efeito gráfico com barras verticais, partindo da linha central (2)
 void efeitoCurvaNeoPixel(uint8_t r, uint8_t g, uint8_t b, uint16_t delay_ms) {
-    float valor = proximo_valor_ar();
+    if (!serie_iniciada) efeitoCurvaSemear(SEMENTE_PADRAO);
+    int32_t valor = sinal_ar_proximo(&serie);   // Q15
 
     int linha_ref = 2;
-    int deslocamento = (int)(valor * 1.5f);
+    int deslocamento = (valor * 3) / (2 * SINAL_AR_Q15_UM);    // valor * 1,5 truncado
     int linha_destino = linha_ref - deslocamento;
 
     if (linha_destino < 0) linha_destino = 0;
     if (linha_destino > NUM_LINHAS - 1) linha_destino = NUM_LINHAS - 1;
 
-    // --- Etapa 1: desloca toda a matriz uma coluna à esquerda
-    for (int linha = 0; linha < NUM_LINHAS; linha++) {
-        for (int coluna = 0; coluna < NUM_COLUNAS - 1; coluna++) {
-            int idx_atual = linha * NUM_COLUNAS + coluna;
-            int idx_prox  = linha * NUM_COLUNAS + coluna + 1;
-            leds[idx_atual] = leds[idx_prox];  // desloca o conteúdo da direita para a esquerda
-        }
-    }
+    // --- Etapa 1: desloca toda a matriz uma coluna à esquerda (leds[] está em ordem lógica,
+    // então cada linha é um bloco contíguo e a rolagem é um memmove por linha)
+    npRolarEsquerda(1);
 
     // --- Etapa 2: escreve nova barra na coluna final (coluna 4)
-    int nova_coluna = NUM_COLUNAS - 1;
     int inicio = linha_ref;
     int fim = linha_destino;
     if (inicio > fim) {
@@ -62,14 +44,13 @@ void efeitoCurvaNeoPixel(uint8_t r, uint8_t g, uint8_t b, uint16_t delay_ms) {
         fim = temp;
     }
 
-    for (int linha = 0; linha < NUM_LINHAS; linha++) {
-        int index = linha * NUM_COLUNAS + nova_coluna;
-        if (linha >= inicio && linha <= fim) {
-            npSetLED(index, r, g, b);
-        } else {
-            npSetLED(index, 0, 0, 0); // apaga o restante da coluna
-        }
+    npLED_t coluna[NUM_LINHAS] = {0};
+    for (int linha = inicio; linha <= fim; linha++) {
+        coluna[linha].R = r;
+        coluna[linha].G = g;
+        coluna[linha].B = b;
     }
+    npBlitColuna(NUM_COLUNAS - 1, coluna);
 
     // Atualiza os LEDs
     npWrite();
@@ -3,6 +3,7 @@
 
 #include <stdint.h>
 
+void efeitoCurvaSemear(uint32_t semente);
 void efeitoCurvaNeoPixel(uint8_t r, uint8_t g, uint8_t b, uint16_t delay_ms);
 
 #endif
\ No newline at end of file
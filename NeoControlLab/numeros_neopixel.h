@@ -28,11 +28,6 @@
 #define COR_6_G 0
 #define COR_6_B 80
 
-void mostrar_numero_1();
-void mostrar_numero_2();
-void mostrar_numero_3();
-void mostrar_numero_4();
-void mostrar_numero_5();
-void mostrar_numero_6();
+void mostrar_numero(int n);
 
 #endif
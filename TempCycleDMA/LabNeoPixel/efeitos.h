@@ -2,9 +2,12 @@
 #define EFEITOS_H
 
 #include <stdint.h>
-#include "LabNeoPixel/efeitos.h"
-
+#include "LabNeoPixel/neopixel_driver.h"
+#include "np_efeitos.h"
 
+// Os passos dos efeitos (np_efeito_*) e o agendador que os toca sem bloquear ficam na biblioteca
+// neopixel (np_efeitos.h e np_agendador.h). Estas são as versões bloqueantes: tocam o efeito
+// inteiro em leds[], com sleep entre os quadros.
 void acenderFileira(uint8_t y, uint8_t r, uint8_t g, uint8_t b);
 void acenderColuna(uint8_t y, uint8_t r, uint8_t g, uint8_t b);
 void efeitoEspiral(uint8_t r, uint8_t g, uint8_t b, uint16_t delay_ms);
@@ -15,5 +18,7 @@ void efeitoFileirasColoridas(uint8_t r, uint8_t g, uint8_t b, uint16_t delay_ms)
 void efeitoFileirasColoridasReverso(uint8_t r, uint8_t g, uint8_t b, uint16_t delay_ms);
 void efeitoColunasColoridas(uint8_t r, uint8_t g, uint8_t b, uint16_t delay_ms);
 void efeitoColunasColoridasReverso(uint8_t r, uint8_t g, uint8_t b, uint16_t delay_ms);
+void efeitoTextoRolante(const char *texto, uint8_t r, uint8_t g, uint8_t b, uint16_t delay_ms);
+void efeitoPaleta(const np_paleta_t *paleta, uint16_t delay_ms);
 
 #endif
\ No newline at end of file
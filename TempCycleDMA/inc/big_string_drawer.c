@@ -1,6 +1,11 @@
 #include "font_big_logo.h"
-#include "draw_big_char.h"
+#include "big_string_drawer.h"
+#include "ssd1306.h"
+#include <stdbool.h>
 #include <stddef.h>
+#include <string.h>
+
+#define BIG_CHAR_HEIGHT 32
 
 const uint8_t* get_big_bitmap(char c) {
     switch (c) {
@@ -42,15 +47,133 @@ int calc_string_width(const char *str) {
     return width;
 }
 
+// Escreve a célula de um caractere grande (width x 32 px) direto nas páginas do framebuffer:
+// cada coluna do bitmap (2 bytes por linha, MSB à esquerda) vira uma palavra de 32 bits que
+// é deslocada para a posição y e aplicada, com máscara, nas até 5 páginas que ela cobre.
+// Colunas da célula sem pixel aceso são apagadas; bitmap NULL apaga a célula inteira.
+static void draw_big_cell(uint8_t *ssd, int x, int y, int width, const uint8_t *bitmap) {
+    int shift = y & 7;
+    int page_0 = y >> 3;
+    uint64_t mask = (uint64_t)0xFFFFFFFFu << shift;
+
+    for (int col = 0; col < width; col++) {
+        int px = x + col;
+        if (px < 0 || px >= ssd1306_width) {
+            continue;
+        }
+
+        uint32_t bits = 0;
+        if (bitmap) {
+            int byte = col >> 3;
+            uint8_t bit = 0x80 >> (col & 7);
+            for (int row = 0; row < BIG_CHAR_HEIGHT; row++) {
+                if (bitmap[row * 2 + byte] & bit) {
+                    bits |= 1u << row;
+                }
+            }
+        }
+
+        uint64_t column = (uint64_t)bits << shift;
+        for (int p = 0; p < 5; p++) {
+            int page = page_0 + p;
+            uint8_t m = (uint8_t)(mask >> (p * 8));
+            if (m == 0 || page < 0 || page >= (int)ssd1306_n_pages) {
+                continue;
+            }
+            uint8_t *dst = &ssd[page * ssd1306_width + px];
+            *dst = (uint8_t)((*dst & ~m) | (uint8_t)(column >> (p * 8)));
+        }
+    }
+
+    ssd1306_mark_dirty(x, y, x + width - 1, y + BIG_CHAR_HEIGHT - 1);
+}
+
 void draw_big_string_aligned_right(uint8_t *ssd, int y, const char *str) {
     int width = calc_string_width(str);
     int x = 128 - width;
     while (*str) {
         const uint8_t *bitmap = get_big_bitmap(*str);
         if (bitmap) {
-            draw_big_char(ssd, x, y, bitmap);
+            draw_big_cell(ssd, x, y, get_char_width(*str), bitmap);
         }
         x += get_char_width(*str);
         str++;
     }
 }
+
+void big_string_cache_init(big_string_cache_t *cache, int y) {
+    cache->y = y;
+    cache->x_inicio = ssd1306_width;
+    cache->texto[0] = '\0';
+}
+
+// Desenha str alinhada à direita redesenhando só as células cujo caractere ou posição mudou
+// desde a última chamada, e apaga a faixa à esquerda que o texto anterior ocupava a mais.
+// Retorna quantas células foram redesenhadas ou apagadas (0 = nada mudou, nada marcado como sujo).
+int draw_big_string_cached(uint8_t *ssd, big_string_cache_t *cache, const char *str) {
+    size_t len = strlen(str);
+    if (len > BIG_STRING_MAX_CHARS) {
+        str += len - BIG_STRING_MAX_CHARS;  // mantém o fim (unidade) visível
+        len = BIG_STRING_MAX_CHARS;
+    }
+
+    // Percorre as duas strings a partir da direita: as posições coincidem enquanto
+    // as larguras já percorridas forem iguais
+    int redesenhadas = 0;
+    int old_len = (int)strlen(cache->texto);
+    int x_novo = ssd1306_width;
+    int x_velho = ssd1306_width;
+    int j = old_len - 1;
+
+    for (int i = (int)len - 1; i >= 0; i--) {
+        int w = get_char_width(str[i]);
+        x_novo -= w;
+
+        while (j >= 0 && x_velho - get_char_width(cache->texto[j]) > x_novo) {
+            x_velho -= get_char_width(cache->texto[j--]);
+        }
+        bool igual = j >= 0 && x_velho - get_char_width(cache->texto[j]) == x_novo &&
+                     cache->texto[j] == str[i];
+
+        if (!igual) {
+            draw_big_cell(ssd, x_novo, cache->y, w, get_big_bitmap(str[i]));
+            redesenhadas++;
+        }
+    }
+
+    if (cache->x_inicio < x_novo) {
+        draw_big_cell(ssd, cache->x_inicio, cache->y, x_novo - cache->x_inicio, NULL);
+        redesenhadas++;
+    }
+
+    memcpy(cache->texto, str, len + 1);
+    cache->x_inicio = x_novo;
+    return redesenhadas;
+}
+
+// Formata um valor em décimos como "+25.3oC" / "-4.0oC" só com aritmética inteira.
+// Retorna o comprimento da string (buffer precisa de pelo menos 15 bytes).
+int format_big_decimos(char *buffer, int32_t decimos) {
+    char digitos[10];
+    int n = 0;
+    int k = 0;
+    uint32_t valor = decimos < 0 ? (uint32_t)0 - (uint32_t)decimos : (uint32_t)decimos;
+
+    buffer[k++] = decimos < 0 ? '-' : '+';
+
+    uint32_t inteiro = valor / 10;
+    do {
+        digitos[n++] = (char)('0' + inteiro % 10);
+        inteiro /= 10;
+    } while (inteiro);
+    while (n) {
+        buffer[k++] = digitos[--n];
+    }
+
+    buffer[k++] = '.';
+    buffer[k++] = (char)('0' + valor % 10);
+    buffer[k++] = 'o';
+    buffer[k++] = 'C';
+    buffer[k] = '\0';
+    return k;
+}
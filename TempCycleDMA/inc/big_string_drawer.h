@@ -3,6 +3,20 @@
 
 #include <stdint.h>
 
+#define BIG_STRING_MAX_CHARS 12
+
+// Cache de um valor em fonte grande alinhado à direita: guarda a string desenhada
+// por último para redesenhar apenas as células (caracteres) que mudaram.
+typedef struct {
+    int y;
+    int x_inicio;                           // x do primeiro caractere na tela (128 = nada desenhado)
+    char texto[BIG_STRING_MAX_CHARS + 1];   // string atualmente no framebuffer
+} big_string_cache_t;
+
 void draw_big_string_aligned_right(uint8_t *ssd, int y, const char *str);
 
-#endif
\ No newline at end of file
+void big_string_cache_init(big_string_cache_t *cache, int y);
+int draw_big_string_cached(uint8_t *ssd, big_string_cache_t *cache, const char *str);
+int format_big_decimos(char *buffer, int32_t decimos);
+
+#endif
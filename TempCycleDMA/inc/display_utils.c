@@ -1,10 +1,23 @@
-#include <stdio.h>
 #include <stdint.h>
 #include "display_utils.h"
 #include "big_string_drawer.h"
 
-void mostrar_valor_grande(uint8_t *ssd, float valor, int y) {
+static big_string_cache_t valor_grande = { .y = -1 };
+
+// Exibe o valor (em décimos inteiros) em fonte grande; só as células que mudaram desde a última
+// chamada são redesenhadas e marcadas como sujas (enviar com render_dirty_on_display).
+// Retorna quantas células foram redesenhadas (0 = tela inalterada).
+int mostrar_valor_grande(uint8_t *ssd, int32_t decimos, int y) {
     char buffer[16];
-    snprintf(buffer, sizeof(buffer), "%+.1foC", valor);
-    draw_big_string_aligned_right(ssd, y, buffer);
-}
\ No newline at end of file
+
+    if (valor_grande.y != y) {
+        big_string_cache_init(&valor_grande, y);
+    }
+    format_big_decimos(buffer, decimos);
+    return draw_big_string_cached(ssd, &valor_grande, buffer);
+}
+
+// Esquece o que está na tela (chamar depois de limpar o framebuffer)
+void mostrar_valor_grande_invalidar(void) {
+    valor_grande.y = -1;
+}
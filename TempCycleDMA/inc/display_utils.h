@@ -3,6 +3,7 @@
 
 #include <stdint.h>
 
-void mostrar_valor_grande(uint8_t *ssd, float valor, int y);
+int mostrar_valor_grande(uint8_t *ssd, int32_t decimos, int y);
+void mostrar_valor_grande_invalidar(void);
 
-#endif
\ No newline at end of file
+#endif
@@ -4,42 +4,42 @@
  *  Projeto: TempCycleDMA
  * ------------------------------------------------------------
  *  Descrição:
- *      Este arquivo implementa o handler de interrupção do
- *      canal DMA 0, utilizado para leitura do sensor interno
- *      de temperatura via ADC do Raspberry Pi Pico W.
+ *      Este arquivo implementa o evento de "bloco pronto" da
+ *      captura contínua do sensor interno de temperatura via
+ *      ADC + DMA do Raspberry Pi Pico W.
  *
- *      A função 'dma_handler_temp()' é responsável por
- *      capturar a interrupção do DMA, limpar o status e
- *      sinalizar a finalização da transferência de dados
- *      via flag global 'dma_temp_done'.
+ *      A função 'dma_handler_temp()' é chamada pela interrupção
+ *      do DMA (handler compartilhado de lib/adc_anel, que já
+ *      limpa o status) a cada bloco de amostras completado, e
+ *      sinaliza a chegada de dados novos via flag global
+ *      'dma_temp_done'.
  *
  *  Relacionamento:
- *      - Este handler é registrado em 'setup.c' usando:
- *            irq_set_exclusive_handler(DMA_IRQ_0, dma_handler_temp);
- *      - A flag 'dma_temp_done' é usada em 'tarefa1_temp.c'
- *        para controlar o fluxo da aquisição via DMA.
+ *      - Este evento é registrado em 'tarefa1_temp.c' usando:
+ *            adc_anel_iniciar_blocos(..., dma_handler_temp);
+ *      - A flag 'dma_temp_done' é limpa em 'tarefa1_temp.c'
+ *        quando os blocos prontos são consumidos.
  *
  *  
  *  Data: 11/05/2025
  * ------------------------------------------------------------
  */
 
-#include "hardware/dma.h"
 #include "irq_handlers.h"
 
-// Flag global que sinaliza a conclusão da transferência DMA
+// Flag global que sinaliza a chegada de um bloco novo de amostras
 volatile bool dma_temp_done = false;
 
 /**
- * @brief Handler de interrupção do canal DMA 0.
+ * @brief Evento de bloco pronto da captura de temperatura.
  *
- * Esta função é chamada automaticamente quando o canal 0 do DMA
- * completa a transferência das amostras do ADC para o buffer.
- * Ela limpa a flag da interrupção e ativa o sinalizador
- * 'dma_temp_done' para que o laço principal saiba que pode
- * prosseguir.
+ * Esta função é chamada, dentro da interrupção do DMA, sempre que
+ * um bloco de amostras do ADC termina de ser escrito no anel. O
+ * bloco continua disponível para a Tarefa 1 até ser liberado; aqui
+ * só se ativa o sinalizador 'dma_temp_done'.
  */
-void dma_handler_temp() {
-    dma_hw->ints0 = 1u << 0;   // Limpa a interrupção do canal 0
-    dma_temp_done = true;     // Sinaliza conclusão para o executor
+void dma_handler_temp(adc_anel_t *anel, const uint16_t *bloco) {
+    (void)anel;
+    (void)bloco;
+    dma_temp_done = true;     // Sinaliza dados novos para o executor
 }
\ No newline at end of file
@@ -2,8 +2,10 @@
 #define IRQ_HANDLERS_H
 
 #include <stdbool.h>
+#include <stdint.h>
+#include "adc_anel.h"
 
 extern volatile bool dma_temp_done;
-void dma_handler_temp(void);
+void dma_handler_temp(adc_anel_t *anel, const uint16_t *bloco);
 
 #endif
\ No newline at end of file
@@ -7,7 +7,7 @@
  *      Ciclo principal do sistema embarcado, baseado em um
  *      executor cíclico com 3 tarefas principais:
  *
- *      Tarefa 1 - Leitura da temperatura via DMA (meio segundo)
+ *      Tarefa 1 - Média da temperatura capturada via DMA (contínua)
  *      Tarefa 2 - Exibição da temperatura e tendência no OLED
  *      Tarefa 3 - Análise da tendência da temperatura
  *
@@ -39,6 +39,7 @@ int64_t tarefa_4(alarm_id_t id, void *user_data);
 int64_t tarefa_5(alarm_id_t id, void *user_data);
 
 volatile float media;
+volatile int32_t media_decimos;   // a mesma média, em décimos de °C (para exibição)
 tendencia_t t;
 volatile absolute_time_t ini_tarefa1, fim_tarefa1, ini_tarefa2, fim_tarefa2, ini_tarefa3, fim_tarefa3, ini_tarefa4, fim_tarefa4;
 
@@ -92,8 +93,13 @@ bool tarefa_1(struct repeating_timer *t)
 {
         // --- Tarefa 1: Leitura de temperatura via DMA ---
         ini_tarefa1 = get_absolute_time();
-        media = tarefa1_obter_media_temp(&cfg_temp, DMA_TEMP_CHANNEL);
+        media = tarefa1_obter_media_temp();
+        media_decimos = tarefa1_obter_decimos_temp();
         fim_tarefa1 = get_absolute_time();
+
+        tarefa1_faixa_t faixa = tarefa1_obter_faixa_temp();
+        printf("Temperatura: %.2f °C | amostras de %.2f a %.2f °C, desvio %.3f °C\n",
+               media, faixa.min, faixa.max, faixa.desvio);
         add_alarm_in_ms(1000, tarefa_2, NULL, false);
         return true;
 }
@@ -112,7 +118,7 @@ int64_t tarefa_3(alarm_id_t id, void *user_data)
 {
         // --- Tarefa 2: Exibição no OLED ---
         ini_tarefa2 = get_absolute_time();
-        tarefa2_exibir_oled(media, t);
+        tarefa2_exibir_oled(media_decimos, t);
         fim_tarefa2 = get_absolute_time();
         add_alarm_in_ms(1000, tarefa_4, NULL, false);
         return false;
@@ -120,9 +126,9 @@ int64_t tarefa_3(alarm_id_t id, void *user_data)
 /***********/
 int64_t tarefa_4(alarm_id_t id, void *user_data)
 {
-        // --- Tarefa 4: Cor da matriz NeoPixel por tendência ---
+        // --- Tarefa 4: Temperatura rolando na matriz, na cor da tendência ---
         absolute_time_t ini_tarefa4 = get_absolute_time();
-        tarefa4_matriz_cor_por_tendencia(t);
+        tarefa4_rolar_temperatura(media_decimos, t);
         absolute_time_t fim_tarefa4 = get_absolute_time();
         add_alarm_in_ms(1000, tarefa_5, NULL, false);
         return false;
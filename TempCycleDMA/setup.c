@@ -9,9 +9,10 @@
  *      
  *      - Inicialização do terminal USB (stdio)
  *      - Configuração do ADC e habilitação do sensor interno
- *      - Configuração do canal DMA para leitura da temperatura
- *      - Registro da interrupção do canal DMA 0
- *      - Inicialização do display OLED (SSD1306)
+ *      - Início da captura contínua da temperatura (ADC + DMA
+ *        em anel, com evento de bloco pronto)
+ *      - Inicialização do display OLED (SSD1306) e do envio
+ *        assíncrono do framebuffer por DMA
  *
  *      A função principal `setup()` deve ser chamada uma única
  *      vez no início do programa, geralmente logo no `main()`,
@@ -19,11 +20,10 @@
  *      antes de iniciar o executor cíclico.
  *
  *  Relacionamento:
- *      - Define a configuração global `cfg_temp` para uso
- *        posterior na Tarefa 1 (tarefa1_temp.c)
- *      - Define os símbolos globais `ssd[]` e `area` usados na
- *        Tarefa 2 (tarefa2_display.c)
- *      - Utiliza o handler de interrupção definido em
+ *      - Liga a captura lida pela Tarefa 1 (tarefa1_temp.c)
+ *      - Define os símbolos globais `ssd[]`, `area` e `oled_dma`
+ *        usados na Tarefa 2 (tarefa2_display.c)
+ *      - O evento de bloco pronto da captura está em
  *        'irq_handlers.c'
  *
  *  
@@ -33,18 +33,19 @@
 
 #include "pico/stdlib.h"
 #include "hardware/adc.h"
-#include "hardware/dma.h"
-#include "hardware/irq.h"
 #include "setup.h"
-#include "irq_handlers.h"
+#include "tarefa1_temp.h"
 #include "ssd1306.h"
 #include "ssd1306_i2c.h"
+#include "ssd1306_dma.h"
 #include "hardware/i2c.h"
 #include "pico/binary_info.h"
 #include "neopixel_driver.h"
 
 // === Buffer de vídeo do OLED (tela de 128 x 64) ===
-uint8_t ssd[ssd1306_buffer_length];
+// O byte anterior aos pixels fica reservado para o byte de controle I²C (ssd1306_buffer_prefix)
+static uint8_t framebuffer[ssd1306_framebuffer_length];
+uint8_t *const ssd = &framebuffer[ssd1306_buffer_prefix];
 
 // === Área de renderização usada por render_on_display() ===
 struct render_area area = {
@@ -54,14 +55,14 @@ struct render_area area = {
     .end_page = ssd1306_n_pages - 1
 };
 
-// === Configuração global do canal DMA 0 ===
-dma_channel_config cfg_temp;
+// === Envio do framebuffer por DMA (a Tarefa 2 não espera o I²C) ===
+ssd1306_dma_t oled_dma;
 
 /**
  * @brief Realiza a configuração inicial do sistema.
  *
  * Esta função inicializa o terminal USB, ADC, sensor de temperatura,
- * canal DMA 0, interrupções e o display OLED.
+ * a captura contínua por DMA e o display OLED.
  */
 void setup() {
     // Inicializa a comunicação USB para printf()
@@ -72,17 +73,8 @@ void setup() {
     adc_init();
     adc_set_temp_sensor_enabled(true);
 
-    // Configura o canal DMA 0 para transferir dados do ADC
-    cfg_temp = dma_channel_get_default_config(DMA_TEMP_CHANNEL);
-    channel_config_set_transfer_data_size(&cfg_temp, DMA_SIZE_16);  // 16 bits
-    channel_config_set_read_increment(&cfg_temp, false);            // ADC FIFO fixo
-    channel_config_set_write_increment(&cfg_temp, true);            // Buffer se move
-    channel_config_set_dreq(&cfg_temp, DREQ_ADC);                   // dispara com ADC
-
-    // Configura interrupção do canal DMA 0
-    dma_channel_set_irq0_enabled(DMA_TEMP_CHANNEL, true);
-    irq_set_exclusive_handler(DMA_IRQ_0, dma_handler_temp);
-    irq_set_enabled(DMA_IRQ_0, true);\
+    // Captura contínua do sensor: dois canais DMA livres, anel em blocos e evento por bloco
+    tarefa1_iniciar_captura();
 
     // Inicializa o display OLED SSD1306 via I2C
     i2c_init(i2c1, 400 * 1000);  // <---I2C primeiro
@@ -93,6 +85,7 @@ void setup() {
 
     ssd1306_init();             // <---Depois do I2C estar pronto
     calculate_render_area_buffer_length(&area);
+    ssd1306_dma_init(&oled_dma, i2c1, ssd1306_i2c_address);  // Canal DMA ligado ao i2c1
 
     // Inicializa NeoPixel (Matriz RGB)
     npInit(LED_PIN);  // substitua LED_PIN pelo valor real, ex: 7
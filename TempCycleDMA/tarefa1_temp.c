@@ -5,26 +5,37 @@
  * ------------------------------------------------------------
  *  Descrição:
  *      Este módulo implementa a Tarefa 1 do executor cíclico,
- *      responsável por realizar a leitura do sensor interno
- *      de temperatura utilizando ADC + DMA, durante um intervalo
- *      contínuo de 0,5 segundos.
+ *      responsável por medir a temperatura do sensor interno
+ *      do RP2040 (ADC canal 4).
  *
- *      A leitura é feita em blocos menores (10.000 amostras)
- *      para evitar o uso excessivo da SRAM do RP2040. Cada
- *      bloco é transferido via DMA e processado de forma
- *      incremental para obter a média da temperatura ao final
- *      do intervalo total.
+ *      A captura é contínua: o ADC converte a 2 kHz e dois
+ *      canais DMA encadeados (lib/adc_anel) escrevem num anel
+ *      de 8192 amostras, dividido em blocos de 512. A cada
+ *      bloco completado, a interrupção do DMA chama o evento
+ *      'dma_handler_temp' (irq_handlers.c). A tarefa só lê os
+ *      blocos já prontos, direto no anel: não reinicia o ADC,
+ *      não espera o DMA e não há intervalo sem amostragem
+ *      entre uma execução e outra.
  *
  *  Funcionalidades:
- *      - Converte valores brutos do ADC para graus Celsius.
- *      - Controla o tempo de aquisição com precisão usando
- *        o clock interno via 'get_absolute_time()'.
- *      - Utiliza DMA canal 0 e depende da flag 'dma_temp_done'
- *        sinalizada pelo handler definido em 'irq_handlers.c'.
+ *      - Decima o fluxo de 2 kHz para ~1,95 Hz (lib/decimador):
+ *        CIC de ordem 2 por 256 e FIR de compensação por 4. Ao
+ *        contrário da média por bloco, o ruído e a interferência
+ *        acima da taxa de saída são atenuados antes de rebaterem
+ *        para perto de zero, e o resultado é contínuo entre blocos.
+ *      - Converte só a saída mais recente (contagens em Q4) para
+ *        graus Celsius: a conversão é linear, então dá o mesmo
+ *        que filtrar as temperaturas, sem conta em float por amostra.
+ *      - Na mesma passada pelos blocos, reduz os códigos brutos em
+ *        inteiros (lib/adc_reducao): mínimo, máximo e variância das
+ *        amostras do ciclo, expostos por 'tarefa1_obter_faixa_temp()'.
+ *        Se o decimador ainda não tiver saída nova, a média dessa
+ *        redução é a leitura do ciclo.
  *
  *  Relacionamento:
  *      - Chamado pelo laço principal em 'main.c' como tarefa do ciclo.
- *      - Requer configuração do canal DMA e IRQ em 'setup.c'.
+ *      - A captura é ligada uma vez em 'setup.c', por
+ *        'tarefa1_iniciar_captura()'.
  *
  *
  *  Data: 11/05/2025
@@ -33,22 +44,45 @@
 
 #include "pico/stdlib.h"
 #include "hardware/adc.h"
-#include "hardware/dma.h"
-#include "hardware/sync.h"
+#include <math.h>
+#include "adc_anel.h"
+#include "adc_reducao.h"
+#include "decimador.h"
+#include "irq_handlers.h"
 #include "tarefa1_temp.h"
 
-#define BLOCO_AMOSTRAS 10000
+#define ADC_CANAL_TEMP 4
+#define TAXA_AMOSTRAGEM_HZ 2000
+#define ADC_CLOCK_DIV (48000000.f / TAXA_AMOSTRAGEM_HZ - 1.f)
 
-static uint16_t buffer_temp[BLOCO_AMOSTRAS];
-extern volatile bool dma_temp_done;
+// Anel de 2^13 = 8192 amostras (16 KB, menos que o antigo bloco de 10 000) em blocos de
+// 2^9 = 512 (256 ms). Entre duas execuções da tarefa (2 s) chegam ~8 blocos: metade do anel.
+#define ANEL_LOG2 13
+#define BLOCO_LOG2 9
+
+// 2000 Hz / (256 · 4) ≈ 1,95 Hz: uma saída a cada 2 blocos, ~4 por execução da tarefa
+#define CIC_ORDEM 2
+#define CIC_LOG2_R 8
+#define FIR_FATOR 4
+
+ADC_ANEL_BUFFER(anel_buffer, ANEL_LOG2);
+static adc_anel_t anel_temp;
+static decimador_t decimador_temp;
+static int32_t saidas[(1u << BLOCO_LOG2) / ((1u << CIC_LOG2_R) * FIR_FATOR) + 1];
+static float ultima_media;
+static int32_t ultimos_decimos;
+static tarefa1_faixa_t ultima_faixa;
+
+// Variação da temperatura por contagem do ADC (em módulo; o sensor cai quando a temperatura sobe)
+#define GRAUS_POR_CONTAGEM (3.3f / (1 << 12) / 0.001721f)
 
 /**
  * @brief Converte valor do ADC para temperatura em °C.
  *
- * @param raw Valor bruto de 12 bits lido do ADC.
+ * @param raw Valor bruto do ADC (12 bits), ou a média de vários valores.
  * @return float Temperatura em graus Celsius.
  */
-static float convert_to_celsius(uint16_t raw)
+static float convert_to_celsius(float raw)
 {
     const float conv = 3.3f / (1 << 12); // Conversão para tensão
     float voltage = raw * conv;
@@ -56,55 +90,99 @@ static float convert_to_celsius(uint16_t raw)
 }
 
 /**
- * @brief Inicia uma transferência via DMA de um bloco do sensor de temperatura.
+ * @brief Liga a captura contínua do sensor de temperatura (ADC + DMA em anel).
+ *
+ * Chamada uma única vez, depois de adc_init() e adc_set_temp_sensor_enabled().
  *
- * @param buffer Buffer de destino.
- * @param cfg Configuração do canal DMA.
- * @param dma_chan Canal DMA utilizado.
+ * @return true se os canais DMA foram obtidos e a captura começou.
  */
-static void iniciar_dma_temp(uint16_t *buffer, dma_channel_config *cfg, int dma_chan)
+bool tarefa1_iniciar_captura(void)
 {
-    adc_select_input(4); // Canal 4 → sensor interno
-    adc_fifo_drain();
-    adc_run(false);
+    adc_select_input(ADC_CANAL_TEMP);
     adc_fifo_setup(true,
                    true,
                    1,
                    false,
                    false);
-    adc_run(true);
-
-    dma_channel_configure(
-        dma_chan,
-        cfg,
-        buffer, &adc_hw->fifo,
-        BLOCO_AMOSTRAS,
-        true);
+    adc_set_clkdiv(ADC_CLOCK_DIV);
+
+    decimador_init(&decimador_temp, CIC_ORDEM, CIC_LOG2_R, decimador_fir_n2_d4, DECIMADOR_FIR_N2_D4_TAPS,
+                   FIR_FATOR);
+    return adc_anel_iniciar_blocos(&anel_temp, anel_buffer, ANEL_LOG2, BLOCO_LOG2, dma_handler_temp);
 }
 
 /**
- * @brief Executa a Tarefa 1 do executor cíclico: coleta de temperatura por 0,5s.
+ * @brief Executa a Tarefa 1 do executor cíclico: decimação dos blocos capturados.
+ *
+ * Passa pelo decimador todos os blocos completados desde a chamada anterior, sem
+ * esperar o DMA, e acumula os mesmos blocos em 'adc_reducao' para a faixa do ciclo.
+ * O decimador começa carregado com a primeira amostra, então já a primeira saída é a
+ * temperatura real (a Tarefa 5 trata media < 1 como falha). Quando chegam blocos mas
+ * nenhuma saída nova do decimador, usa a média inteira desses blocos.
  *
- * @param cfg_temp Configuração do canal DMA.
- * @param dma_chan Número do canal DMA utilizado.
- * @return float Temperatura média calculada ao final do intervalo.
+ * @return float Temperatura filtrada mais recente (ou a anterior, se nenhum bloco
+ *         novo ficou pronto).
  */
-float tarefa1_obter_media_temp(dma_channel_config *cfg_temp, int dma_chan)
+float tarefa1_obter_media_temp(void)
 {
-    float soma = 0.0f;
-    uint32_t total_amostras = 0;
+    adc_reducao_t reducao;
+    const uint16_t *bloco;
+    uint32_t n = 0;
 
+    adc_reducao_zerar(&reducao);
     dma_temp_done = false;
-    iniciar_dma_temp(buffer_temp, cfg_temp, dma_chan);
-    dma_channel_wait_for_finish_blocking(dma_chan);
-    adc_run(false); // Desliga o ADC
+    while ((bloco = adc_anel_proximo_bloco(&anel_temp)) != NULL)
+    {
+        adc_reducao_somar_estat(&reducao, bloco, anel_temp.bloco);
+        uint32_t k = decimador_processar(&decimador_temp, bloco, anel_temp.bloco, 1, saidas);
+        adc_anel_liberar_bloco(&anel_temp);
+        if (k > 0)
+        {
+            n = k;
+        }
+    }
 
-    for (int i = 0; i < BLOCO_AMOSTRAS; i++)
+    if (reducao.n == 0)
     {
-        soma += convert_to_celsius(buffer_temp[i]);
+        return ultima_media;
     }
 
-    total_amostras += BLOCO_AMOSTRAS;
+    if (n > 0)
+    {
+        ultima_media = convert_to_celsius((float)saidas[n - 1] / (1 << DECIMADOR_FRAC));
+    }
+    else
+    {
+        ultima_media = convert_to_celsius(adc_reducao_media(&reducao));
+    }
+    ultimos_decimos = (int32_t)(ultima_media * 10.0f + (ultima_media < 0 ? -0.5f : 0.5f));
 
-    return soma / total_amostras;
+    // O código do ADC cai quando a temperatura sobe: o maior código é a menor temperatura
+    ultima_faixa.min = convert_to_celsius(reducao.max);
+    ultima_faixa.max = convert_to_celsius(reducao.min);
+    ultima_faixa.desvio = sqrtf(adc_reducao_variancia(&reducao)) * GRAUS_POR_CONTAGEM;
+    return ultima_media;
+}
+
+/**
+ * @brief Faixa das amostras brutas lidas na última execução com blocos novos.
+ *
+ * @return tarefa1_faixa_t Menor e maior temperatura e desvio padrão das amostras, em °C.
+ */
+tarefa1_faixa_t tarefa1_obter_faixa_temp(void)
+{
+    return ultima_faixa;
+}
+
+/**
+ * @brief Última temperatura lida, em décimos de °C inteiros.
+ *
+ * Arredondada uma única vez, quando a leitura é feita: os consumidores que mostram o valor
+ * com uma casa decimal (OLED e matriz) recebem esse inteiro, sem conta em float.
+ *
+ * @return int32_t Temperatura × 10, arredondada.
+ */
+int32_t tarefa1_obter_decimos_temp(void)
+{
+    return ultimos_decimos;
 }
\ No newline at end of file
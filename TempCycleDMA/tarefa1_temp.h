@@ -1,8 +1,19 @@
 #ifndef TAREFA1_TEMP_H
 #define TAREFA1_TEMP_H
 
-#include "hardware/dma.h"
+#include <stdbool.h>
+#include <stdint.h>
 
-float tarefa1_obter_media_temp(dma_channel_config* cfg, int dma_chan);
+// Dispersão das amostras brutas de um ciclo, em °C
+typedef struct {
+    float min;
+    float max;
+    float desvio;   // desvio padrão
+} tarefa1_faixa_t;
+
+bool tarefa1_iniciar_captura(void);
+float tarefa1_obter_media_temp(void);
+int32_t tarefa1_obter_decimos_temp(void);
+tarefa1_faixa_t tarefa1_obter_faixa_temp(void);
 
 #endif
\ No newline at end of file
@@ -18,41 +18,59 @@
 
 #include <stdio.h>
 #include <string.h>
+#include <stdbool.h>
 #include "ssd1306.h"
+#include "ssd1306_dma.h"
 #include "display_utils.h"
 #include "tarefa2_display.h"
 #include "tarefa3_tendencia.h"
 
-extern uint8_t ssd[];
-extern struct render_area area;
+extern uint8_t *const ssd;
+extern ssd1306_dma_t oled_dma;
 
-void tarefa2_exibir_oled(float temperatura, tendencia_t tendencia) {
-    ssd1306_clear_display(ssd);
-    render_on_display(ssd, &area);  // Garante que a limpeza seja visível
-    // sleep_ms(20);                   // Pequeno delay opcional
+static bool tela_montada = false;
+static tendencia_t tendencia_exibida;
 
-    char* linha1 = "Temperatura";
-    char* linha2 = "Media";
-    char linha3[30];
+void tarefa2_exibir_oled(int32_t decimos, tendencia_t tendencia) {
+    bool tendencia_mudou = !tela_montada || tendencia != tendencia_exibida;
 
-    snprintf(linha3, sizeof(linha3), "TEMP: %s", tendencia_para_texto(tendencia));
+    // Parte fixa da tela: desenhada uma única vez
+    if (!tela_montada) {
+        ssd1306_clear_display(ssd);
+        mostrar_valor_grande_invalidar();
 
-    // Fonte padrão: 6 px por caractere, altura: 8 px
-    int x1 = (128 - strlen(linha1) * 6) / 2;
-    int x2 = (128 - strlen(linha2) * 6) / 2;
-    int x3 = (128 - strlen(linha3) * 6) / 2;
+        char* linha1 = "Temperatura";
+        char* linha2 = "Media";
 
-    // Y = linha × altura da fonte (8 px padrão)
-    ssd1306_draw_string(ssd, x1, 0, linha1);    // Linha 0 (Y=0)
-    // Linha 1 = em branco (Y=8)
-    ssd1306_draw_string(ssd, x2, 16, linha2);   // Linha 2 (Y=16)
-    // Linha 3 = em branco (Y=24)
+        // Fonte proporcional, centralizada pela largura real do texto; altura: 8 px
+        // Y = linha × altura da fonte (8 px padrão)
+        ssd1306_draw_text_aligned(ssd, 0, 0, ssd1306_width, linha1, SSD1306_ALIGN_CENTER);    // Linha 0 (Y=0)
+        // Linha 1 = em branco (Y=8)
+        ssd1306_draw_text_aligned(ssd, 0, 16, ssd1306_width, linha2, SSD1306_ALIGN_CENTER);   // Linha 2 (Y=16)
+        // Linha 3 = em branco (Y=24)
+        tela_montada = true;
+    }
 
-    // Fonte grande começa abaixo: Y=32 px
-    mostrar_valor_grande(ssd, temperatura, 32);
+    // A fonte grande (Y=32..63) divide a página 7 com a linha da tendência. Se o texto da
+    // tendência mudou, a faixa inteira é limpa e o valor volta a ser desenhado do zero, para
+    // que nada do texto anterior fique nas colunas que o novo não cobre
+    if (tendencia_mudou) {
+        ssd1306_clear_rect(ssd, 0, 32, ssd1306_width, 32);
+        mostrar_valor_grande_invalidar();
+        tendencia_exibida = tendencia;
+    }
 
-    ssd1306_draw_string(ssd, 0, 56, linha3);  // Y = 32 
+    // Fonte grande começa abaixo: Y=32 px; só os dígitos que mudaram são redesenhados
+    int celulas = mostrar_valor_grande(ssd, decimos, 32);
 
-    render_on_display(ssd, &area);
-}
+    // Cada célula redesenhada sobrescreve as linhas 56–63 das suas colunas: a tendência
+    // volta por cima sempre que alguma célula mudou, como no redesenho da tela inteira
+    if (celulas > 0) {
+        char linha3[30];
+        snprintf(linha3, sizeof(linha3), "TEMP: %s", tendencia_para_texto(tendencia));
+        ssd1306_draw_string(ssd, 0, 56, linha3);  // Y = 56
+    }
 
+    // Envia por DMA apenas as colunas/páginas marcadas como alteradas; retorna sem esperar o I²C
+    ssd1306_dma_present(&oled_dma, ssd);
+}
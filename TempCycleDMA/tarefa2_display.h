@@ -16,14 +16,15 @@
 #ifndef TAREFA2_DISPLAY_H
 #define TAREFA2_DISPLAY_H
 
+#include <stdint.h>
 #include "tarefa3_tendencia.h"  // necessário para tipo tendencia_t
 
 /**
  * @brief Exibe no OLED a temperatura média e a tendência térmica.
  *
- * @param temperatura Valor da temperatura média atual
+ * @param decimos Temperatura média atual em décimos de °C (tarefa1_obter_decimos_temp)
  * @param tendencia Resultado da análise de tendência (subindo, caindo, estável)
  */
-void tarefa2_exibir_oled(float temperatura, tendencia_t tendencia);
+void tarefa2_exibir_oled(int32_t decimos, tendencia_t tendencia);
 
 #endif  // TAREFA2_DISPLAY_H
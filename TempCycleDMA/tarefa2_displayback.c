@@ -23,7 +23,7 @@
 #include "tarefa2_display.h"
 #include "tarefa3_tendencia.h"
 
-extern uint8_t ssd[];
+extern uint8_t *const ssd;
 extern struct render_area area;
 
 void tarefa2_exibir_oled(float temperatura, tendencia_t tendencia) {
@@ -7,18 +7,23 @@
  *      Este módulo implementa a Tarefa 3 do executor cíclico:
  *      a análise de tendência da temperatura.
  *      
- *      A função compara a temperatura atual com a anterior
- *      e classifica como:
- *          - TENDÊNCIA_SUBINDO
- *          - TENDÊNCIA_CAINDO
- *          - TENDÊNCIA_ESTÁVEL
+ *      Cada média da Tarefa 1 (em m°C, inteiro) entra numa reta
+ *      de mínimos quadrados sobre as últimas JANELA_TENDENCIA
+ *      médias (lib/estatistica). A temperatura é classificada
+ *      como:
+ *          - TENDENCIA_SUBINDO
+ *          - TENDENCIA_CAINDO
+ *          - TENDENCIA_ESTÁVEL
  *
- *      A tendência é detectada com base em um limiar mínimo
- *      de variação (±0.05°C) e pode ser exibida no terminal
- *      ou no display OLED.
+ *      Subir ou cair exige que a inclinação seja confiável
+ *      (|t| = inclinação / erro padrão acima de T_ENTRADA) e
+ *      relevante (pelo menos INCLINACAO_MIN_MC por ciclo); o
+ *      estado só volta a estável quando |t| cai abaixo de
+ *      T_SAIDA. Ruído entre duas médias seguidas não muda mais
+ *      a tendência, como acontecia com o limiar fixo de ±0,01 °C.
  * 
  *  Funcionalidades:
- *      - Armazena a última temperatura registrada
+ *      - Mantém a janela de médias e o estado do detector
  *      - Retorna enum `tendencia_t` representando o estado
  *      - Oferece função auxiliar para converter enum em string
  *
@@ -32,29 +37,32 @@
  */
 
 #include "tarefa3_tendencia.h"
+#include "estatistica.h"
 
-static float temperatura_anterior = 0.0f;
-static int primeiro_ciclo = 1;
+// Uma média a cada 2 s: a reta cobre os últimos 32 s
+#define JANELA_TENDENCIA 16
+#define T_ENTRADA EST_T_Q4(4.0)
+#define T_SAIDA EST_T_Q4(3.0)
+// 2 m°C por ciclo (1 m°C/s, 0,06 °C/min), em Q8
+#define INCLINACAO_MIN_MC (2 << EST_FRAC)
+
+static est_tendencia_t detector;
+static bool iniciado = false;
 
 tendencia_t tarefa3_analisa_tendencia(float atual) {
-    tendencia_t resultado;
+    if (!iniciado) {
+        est_tendencia_init(&detector, JANELA_TENDENCIA, T_ENTRADA, T_SAIDA, INCLINACAO_MIN_MC);
+        iniciado = true;
+    }
 
-    if (primeiro_ciclo) {
-        resultado = TENDENCIA_ESTÁVEL;
-        primeiro_ciclo = 0;
-    } else {
-        float delta = atual - temperatura_anterior;
+    // Única conta em float: a conversão da média para m°C
+    int32_t atual_mc = (int32_t)(atual * 1000.0f + (atual < 0.0f ? -0.5f : 0.5f));
 
-        if (delta > 0.01f)
-            resultado = TENDENCIA_SUBINDO;
-        else if (delta < -0.01f)
-            resultado = TENDENCIA_CAINDO;
-        else
-            resultado = TENDENCIA_ESTÁVEL;
+    switch (est_tendencia_atualizar(&detector, atual_mc)) {
+        case 1:  return TENDENCIA_SUBINDO;
+        case -1: return TENDENCIA_CAINDO;
+        default: return TENDENCIA_ESTÁVEL;
     }
-
-    temperatura_anterior = atual;
-    return resultado;
 }
 
 const char* tendencia_para_texto(tendencia_t t) {
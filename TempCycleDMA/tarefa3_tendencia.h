@@ -32,9 +32,9 @@ typedef enum {
 } tendencia_t;
 
 /**
- * @brief Analisa a tendência com base na temperatura atual e anterior.
+ * @brief Analisa a tendência pela inclinação das últimas médias de temperatura.
  *
- * @param atual Temperatura atual (ºC)
+ * @param atual Temperatura média do ciclo atual (ºC)
  * @return tendência identificada
  */
 tendencia_t tarefa3_analisa_tendencia(float atual);
@@ -16,6 +16,11 @@
  *      As cores são aplicadas a todos os LEDs simultaneamente,
  *      utilizando a função npSetAll() do driver de NeoPixels.
  *
+ *      tarefa4_rolar_temperatura() mostra, em vez disso, a
+ *      temperatura como texto rolando na cor da tendência. O
+ *      texto é tocado pelo agendador de efeitos (timer
+ *      repetitivo), então a tarefa só atualiza o valor e retorna.
+ *
  *  Relacionamento:
  *      - Depende de `tarefa3_tendencia.h` para o enum `tendencia_t`
  *      - Usa `neopixel_driver.h` para acionar os LEDs
@@ -29,6 +34,26 @@
 #include "neopixel_driver.h"
 #include "tarefa3_tendencia.h"
 #include "testes_cores.h"  // contém COR_AZUL, COR_VERDE, COR_VERMELHO
+#include "np_agendador.h"
+#include "big_string_drawer.h"
+
+#define TAREFA4_ROLAGEM_MS 120  // tempo de cada coluna do texto rolando
+
+// Texto em exibição e o efeito que o rola. A tarefa e o timer do agendador rodam como
+// callbacks de alarme no mesmo núcleo, então nunca se interrompem no meio de um quadro.
+static char texto_temp[BIG_STRING_MAX_CHARS + 1];
+static np_efeito_t efeito_temp;
+static np_efeito_t *const sequencia_temp[] = { &efeito_temp };
+static np_agendador_t agendador;
+static bool rolagem_iniciada = false;
+
+// Quadro composto pelo agendador (já em leds[]) vai para a matriz sem esperar o fio
+static void apresentar_matriz(uint64_t instante_us, const np_cor_t *quadro, void *dados) {
+    (void)instante_us;
+    (void)quadro;
+    (void)dados;
+    npShow();
+}
 
 /**
  * @brief Define a cor de todos os LEDs da matriz de acordo com a tendência.
@@ -50,3 +75,33 @@ void tarefa4_matriz_cor_por_tendencia(tendencia_t t) {
 
     npWrite();  // Atualiza fisicamente a matriz
 }
+
+/**
+ * @brief Mostra a temperatura rolando na matriz, na cor da tendência.
+ *
+ * Na primeira chamada inicia o texto em loop no agendador de efeitos; nas seguintes só troca
+ * o valor e a cor, que entram em vigor no próximo quadro da rolagem.
+ *
+ * @param decimos Temperatura média em décimos de °C (tarefa1_obter_decimos_temp)
+ * @param t       Tendência detectada (define a cor do texto)
+ */
+void tarefa4_rolar_temperatura(int32_t decimos, tendencia_t t) {
+    format_big_decimos(texto_temp, decimos);
+
+    const uint8_t cor[3][3] = { { COR_AZUL }, { COR_VERDE }, { COR_VERMELHO } };
+    uint8_t i = (t == TENDENCIA_CAINDO) ? 0 : (t == TENDENCIA_ESTÁVEL) ? 1 : 2;
+
+    if (!rolagem_iniciada) {
+        np_efeito_iniciar(&efeito_temp, np_efeito_texto_rolante, cor[i][0], cor[i][1], cor[i][2],
+                          TAREFA4_ROLAGEM_MS);
+        efeito_temp.dados = texto_temp;
+        np_agendador_init(&agendador, leds, apresentar_matriz, NULL);
+        np_agendador_definir_camada(&agendador, 0, sequencia_temp, 1, true);
+        rolagem_iniciada = np_agendador_iniciar_timer(&agendador, TAREFA4_ROLAGEM_MS / 2);
+        return;
+    }
+
+    efeito_temp.r = cor[i][0];
+    efeito_temp.g = cor[i][1];
+    efeito_temp.b = cor[i][2];
+}
@@ -23,6 +23,7 @@
 #ifndef TAREFA4_CONTROLA_NEOPIXEL_H
 #define TAREFA4_CONTROLA_NEOPIXEL_H
 
+#include <stdint.h>
 #include "tarefa3_tendencia.h"  // para o tipo tendencia_t
 
 #ifdef __cplusplus
@@ -36,6 +37,14 @@ extern "C" {
  */
 void tarefa4_matriz_cor_por_tendencia(tendencia_t t);
 
+/**
+ * @brief Mostra a temperatura como texto rolando na matriz, na cor da tendência.
+ *
+ * @param decimos Temperatura média em décimos de °C (tarefa1_obter_decimos_temp)
+ * @param t       Tendência detectada (define a cor do texto)
+ */
+void tarefa4_rolar_temperatura(int32_t decimos, tendencia_t t);
+
 #ifdef __cplusplus
 }
 #endif
@@ -15,8 +15,8 @@
 
 #include "general_config.h" // Acesso aos buffers OLED globais (antes configura_geral.h)
 #include "setup/oled/oled_utils.h"
-#include "lib/ssd1306/ssd1306_i2c.h"
-#include "lib/ssd1306/ssd1306.h"
+#include "ssd1306_i2c.h"
+#include "ssd1306.h"
 #include "display.h"
 
 /**
@@ -18,7 +18,7 @@
 #include "general_config.h" // Inclui configurações de pinos, buffer OLED e função de conexão
 #include "pico/stdlib.h"
 #include "hardware/i2c.h"
-#include "lib/ssd1306/ssd1306.h"    // ← necessário para ssd1306_init e calculate_render_area_buffer_length
+#include "ssd1306.h"    // ← necessário para ssd1306_init e calculate_render_area_buffer_length
 #include "oled_utils.h" // ← necessário para oled_clear
 #include "oled.h"
 
@@ -20,9 +20,9 @@
 
 #include "oled_utils.h"
 #include "hardware/i2c.h"
-#include "lib/ssd1306/ssd1306.h"
+#include "ssd1306.h"
 #include <string.h> // Para uso da função memset()
-#include "lib/ssd1306/ssd1306_i2c.h"
+#include "ssd1306_i2c.h"
 
 /**
  * @brief Inicializa o display OLED via I²C com os parâmetros fornecidos e define a área de renderização.
@@ -23,7 +23,7 @@
 #define OLED_UTILS_H
 
 #include "hardware/i2c.h"
-#include "lib/ssd1306/ssd1306.h"
+#include "ssd1306.h"
 #include <stdbool.h>
 
 void setup_oled(uint8_t *ssd, struct render_area *area, i2c_inst_t *i2c_port, uint sda, uint scl, uint freq_khz, bool clear_display);
@@ -36,7 +36,7 @@
 #define TOPIC_IRRIGATION "pico/irrigacao"
 
 // Buffers globais para OLED
-extern uint8_t oled_buffer[];
+extern uint8_t *const oled_buffer;
 extern struct render_area area;
 
 void setup_init_oled(void);
@@ -16,7 +16,7 @@
 #include "setup/led/led.h"
 #include "setup/buzzer/buzzer.h"
 #include "setup/setup.h"
-#include "lib/ssd1306/ssd1306_i2c.h"
+#include "ssd1306_i2c.h"
 #include "lib/mqtt/mqtt_lwip.h"
 #include "lwip/ip_addr.h"
 #include "pico/multicore.h"
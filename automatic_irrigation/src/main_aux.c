@@ -13,7 +13,7 @@
 #include "lib/circular_queue/circular_queue.h"
 #include "general_config.h"
 #include "setup/oled/oled_utils.h"
-#include "lib/ssd1306/ssd1306_i2c.h"
+#include "ssd1306_i2c.h"
 #include "lib/mqtt/mqtt_lwip.h"
 #include "lwip/ip_addr.h"
 #include "pico/multicore.h"
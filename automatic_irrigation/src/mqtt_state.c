@@ -17,7 +17,7 @@
  */
 
 #include "mqtt_state.h"              // Declaração das variáveis externas
-#include "lib/ssd1306/ssd1306_i2c.h" // Define tamanho do buffer e estrutura de renderização
+#include "ssd1306_i2c.h" // Define tamanho do buffer e estrutura de renderização
 
 // ================================
 // DEFINIÇÕES GLOBAIS ÚNICAS
@@ -45,8 +45,12 @@ bool mqtt_started = false;
  * Este buffer contém os dados de pixels que serão renderizados na tela.
  * Seu tamanho é definido pela função `ssd1306_buffer_length`, de acordo com
  * a resolução do display (tipicamente 128x64).
+ *
+ * O armazenamento reserva `ssd1306_buffer_prefix` byte antes dos pixels para o
+ * byte de controle I²C; `oled_buffer` aponta para o primeiro pixel.
  */
-uint8_t oled_buffer[ssd1306_buffer_length];
+static uint8_t oled_framebuffer[ssd1306_framebuffer_length];
+uint8_t *const oled_buffer = &oled_framebuffer[ssd1306_buffer_prefix];
 
 /**
  * @brief Estrutura que define a área da tela a ser desenhada.
@@ -9,7 +9,7 @@ extern uint32_t last_ip_bin;
 extern bool mqtt_started;
 
 // Buffer OLED e área global
-extern uint8_t oled_buffer[];
+extern uint8_t *const oled_buffer;
 extern struct render_area area;
 
 // Variável de controle do ping
@@ -6,7 +6,7 @@
 #include "setup/setup.h"
 #include "setup/led/led.h"
 #include "buzzer/buzzer.h"
-#include "utils/ssd1306.h"
+#include "ssd1306.h"
 
 struct render_area frame_area = {
     .start_column = 0,
@@ -43,21 +43,20 @@ void turn_on_led(int pin)
 
 void clear_display()
 {
-    uint8_t ssd[ssd1306_buffer_length];
+    uint8_t framebuffer[ssd1306_framebuffer_length];
+    uint8_t *ssd = &framebuffer[ssd1306_buffer_prefix]; // byte 0 reservado ao controle I²C
     memset(ssd, 0, ssd1306_buffer_length);
     render_on_display(ssd, &frame_area);
 }
 
 void show_comand_on_display(char *comand)
 {
-    uint8_t ssd[ssd1306_buffer_length];
+    uint8_t framebuffer[ssd1306_framebuffer_length];
+    uint8_t *ssd = &framebuffer[ssd1306_buffer_prefix]; // byte 0 reservado ao controle I²C
     memset(ssd, 0, ssd1306_buffer_length);
 
-    int text_len = strlen(comand);
-    int text_width = text_len * 6;
-    int x = (120 - text_width) / 2; // Centraliza horizontalmente
-
-    ssd1306_draw_string(ssd, x, 30, comand);
+    // Centraliza horizontalmente pela largura real do texto (fonte proporcional)
+    ssd1306_draw_text_aligned(ssd, 0, 30, ssd1306_width, comand, SSD1306_ALIGN_CENTER);
 
     render_on_display(ssd, &frame_area);
 }
@@ -1,17 +1,36 @@
+#include <math.h>
 #include <stdio.h>
 #include <string.h>
 #include "pico/stdlib.h"
 #include "hardware/adc.h"
-#include "hardware/dma.h"
+#include "adc_anel.h"
+#include "adc_reducao.h"
+#include "decimador.h"
 
 #include "setup/setup.h"
-#include "utils/ssd1306.h"
+#include "ssd1306.h"
 
-#define NUM_SAMPLES 100 // Número de amostras por ciclo de leitura
+// Captura contínua a 1 kHz num anel de 2^11 = 2048 amostras, em blocos de 2^7 = 128: a cada
+// leitura (1 s) há ~8 blocos novos, metade do anel
+#define SAMPLE_RATE_HZ 1000
+#define ADC_CLOCK_DIV (48000000.f / SAMPLE_RATE_HZ - 1.f)
+#define RING_LOG2 11
+#define BLOCK_LOG2 7
 
-uint16_t adc_buffer[NUM_SAMPLES]; // Buffer para armazenar as amostras do ADC
-int dma_chan;
-dma_channel_config cfg;
+// Decimação de 1 kHz para ~1,95 Hz: CIC de ordem 2 por 2^7 = 128 e FIR de compensação por 4
+#define CIC_ORDER 2
+#define CIC_LOG2_R 7
+#define FIR_FACTOR 4
+
+// Variação da temperatura por contagem do ADC (em módulo; o sensor cai quando a temperatura sobe)
+#define DEGREES_PER_COUNT (3.3f / (1 << 12) / 0.001721f)
+
+ADC_ANEL_BUFFER(adc_buffer, RING_LOG2); // Anel escrito continuamente pelo DMA
+adc_anel_t adc_ring;
+decimador_t temp_decimator;
+
+// Dispersão das amostras brutas da última leitura, em °C
+float temp_min, temp_max, temp_stddev;
 
 struct render_area frame_area = {
     .start_column = 0,
@@ -19,59 +38,81 @@ struct render_area frame_area = {
     .start_page = 0,
     .end_page = ssd1306_n_pages - 1};
 
-// Converte o valor bruto do ADC (12 bits) para temperatura em graus Celsius
-float convert_to_celsius(uint16_t raw)
+// Converte o valor bruto do ADC (12 bits), ou a média de vários, para temperatura em graus Celsius
+float convert_to_celsius(float raw)
 {
     const float conversion_factor = 3.3f / (1 << 12); // Fator de conversão para 3.3V e 12 bits
     float voltage = raw * conversion_factor;          // Converte valor para tensão
     return 27.0f - (voltage - 0.706f) / 0.001721f;    // Fórmula do datasheet do RP2040
 }
 
-float read_temperature()
+// Liga o ADC em modo contínuo, com o FIFO alimentando os dois canais DMA do anel
+bool start_temperature_capture()
 {
-    adc_fifo_drain();
-
-    // Configura o ADC para colocar dados no FIFO
-    adc_run(false); // Desliga ADC temporariamente
     adc_fifo_setup(
         true, // Envia dados para o FIFO
         true, // Habilita DMA para o FIFO
         1,    // Gatilho a cada amostra
         false,
         false);
-    adc_run(true); // Liga ADC para começar a amostrar
-
-    // Inicia a transferência DMA: do FIFO ADC para adc_buffer
-    dma_channel_configure(
-        dma_chan,
-        &cfg,
-        adc_buffer,    // Endereço de destino na RAM
-        &adc_hw->fifo, // Endereço de origem (registrador FIFO do ADC)
-        NUM_SAMPLES,   // Número de transferências (amostras)
-        true           // Inicia imediatamente
-    );
-
-    // Aguarda até que a transferência DMA seja concluída
-    dma_channel_wait_for_finish_blocking(dma_chan);
-
-    // Desliga o ADC após capturar os dados
-    adc_run(false);
-
-    // Calcula a média das temperaturas lidas
-    float sum = 0.0f;
-    for (int i = 0; i < NUM_SAMPLES; i++)
+    adc_set_clkdiv(ADC_CLOCK_DIV);
+
+    decimador_init(&temp_decimator, CIC_ORDER, CIC_LOG2_R, decimador_fir_n2_d4, DECIMADOR_FIR_N2_D4_TAPS,
+                   FIR_FACTOR);
+    return adc_anel_iniciar_blocos(&adc_ring, adc_buffer, RING_LOG2, BLOCK_LOG2, NULL);
+}
+
+float read_temperature()
+{
+    static float last_temp = 0.0f;
+
+    // Consome os blocos que o DMA completou desde a última leitura, sem parar o ADC nem esperar.
+    // Decima os códigos crus em inteiro (CIC + FIR) e converte só a saída mais recente, em Q4:
+    // a conversão é linear. Os mesmos blocos passam pela redução inteira (mínimo, máximo e
+    // variância), que também dá a leitura se o decimador ainda não tiver saída nova
+    int32_t outputs[(1u << BLOCK_LOG2) / ((1u << CIC_LOG2_R) * FIR_FACTOR) + 1];
+    adc_reducao_t reduction;
+    const uint16_t *block;
+    uint32_t n = 0;
+
+    adc_reducao_zerar(&reduction);
+    while ((block = adc_anel_proximo_bloco(&adc_ring)) != NULL)
+    {
+        adc_reducao_somar_estat(&reduction, block, adc_ring.bloco);
+        uint32_t k = decimador_processar(&temp_decimator, block, adc_ring.bloco, 1, outputs);
+        adc_anel_liberar_bloco(&adc_ring);
+        if (k > 0)
+        {
+            n = k;
+        }
+    }
+
+    if (reduction.n == 0)
     {
-        sum += convert_to_celsius(adc_buffer[i]); // Converte cada valor para °C e soma
+        return last_temp;
     }
 
-    float avg_temp = sum / NUM_SAMPLES;
+    if (n > 0)
+    {
+        last_temp = convert_to_celsius((float)outputs[n - 1] / (1 << DECIMADOR_FRAC));
+    }
+    else
+    {
+        last_temp = convert_to_celsius(adc_reducao_media(&reduction));
+    }
 
-    return avg_temp;
+    // O maior código é a menor temperatura
+    temp_min = convert_to_celsius(reduction.max);
+    temp_max = convert_to_celsius(reduction.min);
+    temp_stddev = sqrtf(adc_reducao_variancia(&reduction)) * DEGREES_PER_COUNT;
+
+    return last_temp;
 }
 
 void show_temperature_on_display(float temperature)
 {
-    uint8_t ssd[ssd1306_buffer_length];
+    uint8_t framebuffer[ssd1306_framebuffer_length];
+    uint8_t *ssd = &framebuffer[ssd1306_buffer_prefix]; // byte 0 reservado ao controle I²C
     memset(ssd, 0, ssd1306_buffer_length);
 
     ssd1306_draw_string(ssd, 20, 10, "Temperatura:");
@@ -79,18 +120,16 @@ void show_temperature_on_display(float temperature)
     char text[10];
     snprintf(text, sizeof(text), "%.1f C", temperature);
 
-    int text_len = strlen(text);
-    int text_width = text_len * 6;
-    int x = (120 - text_width) / 2; // Centraliza horizontalmente
-
-    ssd1306_draw_string(ssd, x, 30, text);
+    // Centraliza horizontalmente pela largura real do texto (fonte proporcional)
+    ssd1306_draw_text_aligned(ssd, 0, 30, ssd1306_width, text, SSD1306_ALIGN_CENTER);
 
     render_on_display(ssd, &frame_area);
 }
 
 void clear_display()
 {
-    uint8_t ssd[ssd1306_buffer_length];
+    uint8_t framebuffer[ssd1306_framebuffer_length];
+    uint8_t *ssd = &framebuffer[ssd1306_buffer_prefix]; // byte 0 reservado ao controle I²C
     memset(ssd, 0, ssd1306_buffer_length);
     render_on_display(ssd, &frame_area);
 }
@@ -100,8 +139,9 @@ bool alarm_callback(repeating_timer_t *t)
     float temperature = read_temperature();
     show_temperature_on_display(temperature);
 
-    // Temperatura média em °C
-    printf("Temperatura média: %.2f °C\n", temperature); // Imprime no terminal
+    // Temperatura média em °C e a dispersão das amostras do último segundo
+    printf("Temperatura média: %.2f °C (amostras de %.2f a %.2f °C, desvio %.3f °C)\n",
+           temperature, temp_min, temp_max, temp_stddev); // Imprime no terminal
     return true;
 }
 
@@ -112,15 +152,11 @@ int main()
     clear_display();
     calculate_render_area_buffer_length(&frame_area);
 
-    // Configura o canal DMA para receber dados do ADC
-    dma_chan = dma_claim_unused_channel(true);      // Requisita um canal DMA disponível
-    cfg = dma_channel_get_default_config(dma_chan); // Obtem configuração padrão
-
-    // Configurações do canal DMA
-    channel_config_set_transfer_data_size(&cfg, DMA_SIZE_16); // Cada leitura é de 16 bits
-    channel_config_set_read_increment(&cfg, false);           // Endereço fixo (registrador ADC FIFO)
-    channel_config_set_write_increment(&cfg, true);           // Incrementa para armazenar em adc_buffer[]
-    channel_config_set_dreq(&cfg, DREQ_ADC);                  // Dispara automaticamente com dados do ADC
+    // Captura contínua: o ADC não para mais entre uma leitura e outra
+    if (!start_temperature_capture())
+    {
+        printf("Sem canais DMA livres para o sensor de temperatura\n");
+    }
 
     static repeating_timer_t timer;
     add_repeating_timer_ms(1000, alarm_callback, NULL, &timer);
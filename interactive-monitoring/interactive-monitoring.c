@@ -4,10 +4,20 @@
 #include "pico/multicore.h"
 #include "hardware/pwm.h"
 #include "hardware/clocks.h"
+#include "adc_varredura.h"
 
 const int VRX = 26;
 const int ADC_CHANNEL_0 = 0;
 
+// O eixo X é amostrado sem parar a 1 kHz pelo DMA, num anel de 512 amostras; cada bloco de 32
+// amostras (32 ms) vira uma média
+#define VRX_SAMPLE_RATE_HZ 1000
+#define ADC_RING_LOG2 9
+#define ADC_BLOCK_LOG2 5
+
+ADC_ANEL_BUFFER(adc_buffer, ADC_RING_LOG2);
+adc_varredura_t adc_scan;
+
 const int RED_LED = 13;
 const int BLUE_LED = 12;
 const int GREEN_LED = 11;
@@ -25,6 +35,12 @@ void setup_joystick()
 {
     adc_init();
     adc_gpio_init(VRX);
+
+    if (!adc_varredura_iniciar(&adc_scan, adc_buffer, ADC_RING_LOG2, ADC_BLOCK_LOG2,
+                               ADC_VARREDURA_ENTRADA(ADC_CHANNEL_0), VRX_SAMPLE_RATE_HZ))
+    {
+        printf("Sem canais DMA livres para o joystick\n");
+    }
 }
 
 void setup_leds()
@@ -116,9 +132,7 @@ int main()
 
     while (true)
     {
-        adc_select_input(ADC_CHANNEL_0);
-        sleep_us(2);
-        vrx_value = adc_read();
+        vrx_value = adc_varredura_valor(&adc_scan, ADC_CHANNEL_0);
 
         if (vrx_value < LOW)
         {
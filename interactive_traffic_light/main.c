@@ -11,7 +11,7 @@
 #include "setup/button/button.h"
 #include "setup/led/led.h"
 #include "setup/display/display.h"
-#include "utils/ssd1306_i2c.h"
+#include "ssd1306_i2c.h"
 
 #define NUM_LEDS 3
 
@@ -88,14 +88,16 @@ int64_t beep_callback(alarm_id_t id, void *user_data)
 
 void clear_display()
 {
-    uint8_t ssd[ssd1306_buffer_length];
+    uint8_t framebuffer[ssd1306_framebuffer_length];
+    uint8_t *ssd = &framebuffer[ssd1306_buffer_prefix]; // byte 0 reservado ao controle I²C
     memset(ssd, 0, ssd1306_buffer_length);
     render_on_display(ssd, &frame_area);
 }
 
 void show_seconds_on_display(int seconds)
 {
-    uint8_t ssd[ssd1306_buffer_length];
+    uint8_t framebuffer[ssd1306_framebuffer_length];
+    uint8_t *ssd = &framebuffer[ssd1306_buffer_prefix]; // byte 0 reservado ao controle I²C
     memset(ssd, 0, ssd1306_buffer_length);
 
     ssd1306_draw_string(ssd, 10, 10, "Tempo restante:");
@@ -1,5 +1,5 @@
 #include "pico/stdlib.h"
-#include "../../utils/ssd1306.h"
+#include "ssd1306.h"
 
 #define I2C_SDA 14
 #define I2C_SCL 15
@@ -1,9 +1,9 @@
 #include <stdio.h>
-#include <math.h>
 #include "pico/stdlib.h"
 #include "hardware/adc.h"
-#include "hardware/dma.h"
-#include "hardware/timer.h"
+#include "adc_anel.h"
+#include "audio_dsp.h"
+#include "decimador.h"
 #include "neopixel.c"
 
 #define MIC_CHANNEL 2
@@ -12,19 +12,57 @@
 #define LED_PIN 7
 #define LED_COUNT 25
 
-#define ADC_CLOCK_DIV 96.f
-#define SAMPLES 200
-
-#define INTERVAL 750
-#define LIMIAR_ADC 2055
-
-uint dma_channel;
-dma_channel_config dma_cfg;
-
-volatile float intensity_detected = 0;
-uint16_t adc_buffer[SAMPLES];
-
-const uint8_t X_pattern[9] = {0, 4, 6, 8, 12, 16, 18, 20, 24};
+// Captura contínua: o ADC converte a 16 kHz e o DMA escreve num anel de 2048 amostras (128 ms);
+// cada janela de 512 amostras (32 ms) vira um quadro, ~31 quadros por segundo
+#define TAXA_AMOSTRAGEM 16000
+#define ADC_CLOCK_DIV (48000000.f / TAXA_AMOSTRAGEM - 1.f)
+#define ANEL_LOG2 11
+#define JANELA 512
+
+// Uma banda por coluna da matriz, dos graves (esquerda) aos agudos (direita)
+#define NUM_GRAVES 2
+#define NUM_AGUDOS 3
+#define NUM_BANDAS (NUM_GRAVES + NUM_AGUDOS)
+static const uint16_t FREQ_GRAVES[NUM_GRAVES] = {125, 315};
+static const uint16_t FREQ_AGUDOS[NUM_AGUDOS] = {800, 2000, 5000};
+
+// Os graves são analisados no fluxo decimado para 2 kHz (CIC de ordem 3 por 4 e FIR de
+// compensação por 2): cada janela de 512 amostras vira 64, com a mesma duração e a mesma
+// largura de banda (31 Hz) de antes, e o Goertzel dos graves anda 8 vezes menos. O que está
+// acima de 1 kHz é filtrado antes de rebater sobre 125 e 315 Hz. As saídas do decimador estão
+// em Q4, então as amplitudes dos graves saem 16 vezes maiores e são reduzidas no fim.
+#define TAXA_GRAVES 2000
+#define CIC_ORDEM 3
+#define CIC_LOG2_R 2
+#define FIR_FATOR 2
+#define JANELA_GRAVES (JANELA / (TAXA_AMOSTRAGEM / TAXA_GRAVES))
+
+// Amplitude (em contagens do ADC) que acende a primeira linha de uma barra; cada linha acima
+// pede o dobro (6 dB por linha)
+#define NIVEL_BASE 4
+
+// Quadros até o marcador de pico de uma barra cair uma linha
+#define QUADROS_QUEDA_PICO 6
+
+#define QUADROS_POR_RELATORIO 32
+
+ADC_ANEL_BUFFER(anel_buffer, ANEL_LOG2);
+static adc_anel_t anel;
+static uint16_t janela[JANELA];
+static audio_analisador_t analisador;
+
+static decimador_t decimador;
+static int32_t saidas_decimador[JANELA_GRAVES];
+static uint16_t janela_graves[JANELA_GRAVES];
+static uint16_t pos_graves;
+static audio_analisador_t analisador_graves;
+
+static uint8_t pico_barra[NUM_BANDAS];
+static uint8_t queda_pico[NUM_BANDAS];
+
+// Cor de cada linha das barras, de baixo para cima: verde, amarelo, vermelho
+static const uint8_t COR_LINHA[5][3] = {
+    {0, 40, 0}, {0, 40, 0}, {30, 30, 0}, {40, 15, 0}, {50, 0, 0}};
 
 void setup_microphone()
 {
@@ -47,72 +85,74 @@ void setup_neopixel()
     npInit(LED_PIN, LED_COUNT);
 }
 
-void setup_dma()
+// Decima a janela para 2 kHz e, a cada JANELA_GRAVES amostras decimadas, atualiza as bandas
+// graves em graves[] (de volta em contagens do ADC); entre atualizações elas ficam como estão
+static void analisar_graves(const uint16_t *amostras, uint16_t *graves)
 {
-    dma_channel = dma_claim_unused_channel(true);
-
-    dma_cfg = dma_channel_get_default_config(dma_channel);
+    uint32_t n = decimador_processar(&decimador, amostras, JANELA, 1, saidas_decimador);
 
-    channel_config_set_transfer_data_size(&dma_cfg, DMA_SIZE_16);
-    channel_config_set_read_increment(&dma_cfg, false);
-    channel_config_set_write_increment(&dma_cfg, true);
+    for (uint32_t i = 0; i < n; i++)
+    {
+        // O FIR pode passar um pouco da escala em degraus; o analisador recebe uint16
+        int32_t v = saidas_decimador[i];
+        janela_graves[pos_graves++] = (uint16_t)(v < 0 ? 0 : v > UINT16_MAX ? UINT16_MAX : v);
 
-    channel_config_set_dreq(&dma_cfg, DREQ_ADC);
+        if (pos_graves == JANELA_GRAVES)
+        {
+            audio_quadro_t q;
+            audio_analisar(&analisador_graves, janela_graves, &q);
+            for (uint b = 0; b < NUM_GRAVES; b++)
+                graves[b] = (uint16_t)((q.banda[b] + (1u << (DECIMADOR_FRAC - 1))) >> DECIMADOR_FRAC);
+            pos_graves = 0;
+        }
+    }
 }
 
-void sample_mic()
+// Recomeça o fluxo decimado (depois de um salto no anel)
+static void reiniciar_graves(void)
 {
-    adc_fifo_drain();
-    adc_run(false);
-
-    dma_channel_configure(dma_channel, &dma_cfg, adc_buffer, &(adc_hw->fifo), SAMPLES, true);
-
-    adc_run(true);
-    dma_channel_wait_for_finish_blocking(dma_channel);
-    adc_run(false);
+    decimador_reiniciar(&decimador);
+    pos_graves = 0;
 }
-bool read_microphone(struct repeating_timer *t)
-{
-    sample_mic();
-
-    float sum = 0.0f;
-    float avg = 0.0f;
-    float value = 0.0f;
-
-    for (int i = 0; i < SAMPLES; ++i)
-    {
-        avg += adc_buffer[i];
-        sleep_us(5);
-    }
-    avg /= SAMPLES;
-
-    for (int i = 0; i < SAMPLES; ++i)
-    {
-        value = (float)adc_buffer[i] - avg;
-        sum += value * value;
-    }
 
-    float rms = sqrtf(sum / SAMPLES);
+// Linhas acesas (0 a 5) para uma amplitude: quantos níveis NIVEL_BASE, 2·NIVEL_BASE, ... ela passa
+static uint8_t altura_barra(uint16_t amplitude)
+{
+    uint8_t altura = 0;
+    uint32_t nivel = NIVEL_BASE;
 
-    if (rms > 10.0f && avg > LIMIAR_ADC)
-    {
-        intensity_detected = 1.0;
-    }
-    else
+    while (altura < 5 && amplitude >= nivel)
     {
-        intensity_detected = 0.0;
+        altura++;
+        nivel <<= 1;
     }
-
-    printf("Média: %.2f\n", avg);
-    return true;
+    return altura;
 }
 
-void draw_X()
+// Barras das bandas crescendo de baixo para cima, com um marcador de pico que cai devagar
+void draw_spectrum(const audio_quadro_t *quadro)
 {
     npClear();
-    for (int i = 0; i < sizeof(X_pattern) / sizeof(X_pattern[0]); i++)
+    for (uint x = 0; x < NUM_BANDAS; ++x)
     {
-        npSetLED(X_pattern[i], 255, 0, 0);
+        uint8_t altura = altura_barra(quadro->banda[x]);
+
+        for (uint nivel = 0; nivel < altura; ++nivel)
+            npSetXY(x, 4 - nivel, COR_LINHA[nivel][0], COR_LINHA[nivel][1], COR_LINHA[nivel][2]);
+
+        if (altura >= pico_barra[x])
+        {
+            pico_barra[x] = altura;
+            queda_pico[x] = QUADROS_QUEDA_PICO;
+        }
+        else if (--queda_pico[x] == 0)
+        {
+            pico_barra[x]--;
+            queda_pico[x] = QUADROS_QUEDA_PICO;
+        }
+
+        if (pico_barra[x] > altura)
+            npSetXY(x, 5 - pico_barra[x], 20, 20, 20);
     }
     npWrite();
 }
@@ -123,23 +163,58 @@ int main()
     sleep_ms(2000);
     setup_neopixel();
     setup_microphone();
-    setup_dma();
+    audio_init(&analisador, TAXA_AMOSTRAGEM, FREQ_AGUDOS, NUM_AGUDOS, JANELA);
+    audio_init(&analisador_graves, TAXA_GRAVES, FREQ_GRAVES, NUM_GRAVES, JANELA_GRAVES);
+    analisador_graves.dc = 2048 << DECIMADOR_FRAC;  // meio da escala, em Q4
+    decimador_init(&decimador, CIC_ORDEM, CIC_LOG2_R, decimador_fir_n3_d2, DECIMADOR_FIR_N3_D2_TAPS, FIR_FATOR);
 
-    struct repeating_timer timer;
-    add_repeating_timer_ms(INTERVAL, read_microphone, NULL, &timer);
+    if (!adc_anel_iniciar(&anel, anel_buffer, ANEL_LOG2))
+    {
+        printf("Sem canais DMA livres para o microfone\n");
+        while (true)
+            tight_loop_contents();
+    }
+
+    audio_quadro_t quadro, agudos;
+    uint16_t graves[NUM_GRAVES] = {0};
+    uint quadros = 0;
+    uint64_t inicio_relatorio = time_us_64();
 
     while (true)
     {
-        if (intensity_detected > 0.0)
+        // Se o consumo atrasar quase uma volta do anel (printf bloqueado na USB, por exemplo),
+        // recomeça da amostra mais recente em vez de misturar voltas
+        if (adc_anel_disponiveis(&anel) > (3u << ANEL_LOG2) / 4)
         {
-            draw_X();
+            adc_anel_descartar(&anel);
+            reiniciar_graves();
         }
-        else
+
+        if (!adc_anel_ler(&anel, janela, JANELA))
         {
-            npClear();
-            npWrite();
+            tight_loop_contents();
+            continue;
         }
 
-        sleep_ms(300);
+        // Agudos na taxa cheia, graves no fluxo decimado; o quadro mostrado junta as duas
+        // análises, com o RMS e o pico da taxa cheia
+        audio_analisar(&analisador, janela, &agudos);
+        analisar_graves(janela, graves);
+
+        quadro = agudos;
+        for (uint b = 0; b < NUM_GRAVES; b++)
+            quadro.banda[b] = graves[b];
+        for (uint b = 0; b < NUM_AGUDOS; b++)
+            quadro.banda[NUM_GRAVES + b] = agudos.banda[b];
+        draw_spectrum(&quadro);
+
+        if (++quadros == QUADROS_POR_RELATORIO)
+        {
+            uint64_t agora = time_us_64();
+            printf("RMS: %u  Pico: %u  DC: %u  (%.1f quadros/s)\n", quadro.rms, quadro.pico, quadro.dc,
+                   quadros * 1e6 / (double)(agora - inicio_relatorio));
+            quadros = 0;
+            inicio_relatorio = agora;
+        }
     }
 }
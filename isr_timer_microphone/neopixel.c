@@ -2,7 +2,9 @@
 #define __NEOPIXEL_INC
 
 #include <stdlib.h>
-#include "ws2818b.pio.h"
+#include "neopixel_tx.h"
+#include "np_matriz.h"
+#include "np_glifos.h"
 
 // Definição de pixel GRB
 struct pixel_t
@@ -16,9 +18,13 @@ typedef pixel_t npLED_t; // Mudança de nome de "struct pixel_t" para "npLED_t"
 static npLED_t *leds;
 static uint led_count;
 
-// Variáveis para uso da máquina PIO.
-static PIO np_pio;
-static uint np_sm;
+// Quadro empacotado (uma palavra GRB por LED) lido pelo DMA e estado da transmissão.
+static uint32_t *np_quadro;
+static np_tx_t np_tx;
+
+// Índice na fita de cada posição (y * 5 + x) da matriz 5x5 da BitDogLab (serpentina, LED 0 no
+// canto inferior direito), usado para desenhar glifos.
+static uint8_t np_mapa[NP_GLIFO_LEDS];
 
 /**
  * Inicializa a máquina PIO para controle da matriz de LEDs.
@@ -28,21 +34,14 @@ void npInit(uint pin, uint amount)
 
     led_count = amount;
     leds = (npLED_t *)calloc(led_count, sizeof(npLED_t));
+    np_quadro = (uint32_t *)calloc(led_count, sizeof(uint32_t));
 
-    // Cria programa PIO.
-    uint offset = pio_add_program(pio0, &ws2818b_program);
-    np_pio = pio0;
-
-    // Toma posse de uma máquina PIO.
-    np_sm = pio_claim_unused_sm(np_pio, false);
-    if (np_sm < 0)
+    // Toma posse de uma máquina PIO livre (pio0 ou pio1) e de um canal DMA.
+    if (!np_tx_init(&np_tx, pin, np_quadro, led_count))
     {
-        np_pio = pio1;
-        np_sm = pio_claim_unused_sm(np_pio, true); // Se nenhuma máquina estiver livre, panic!
+        panic("NeoPixel: sem máquina PIO ou canal DMA livre");
     }
-
-    // Inicia programa na máquina PIO obtida.
-    ws2818b_program_init(np_pio, np_sm, offset, pin, 800000.f);
+    np_matriz_mapear(np_mapa, NP_GLIFO_LADO, NP_GLIFO_LADO, true, NP_MATRIZ_ROT_180);
 
     // Limpa buffer de pixels.
     for (uint i = 0; i < led_count; ++i)
@@ -63,6 +62,29 @@ void npSetLED(const uint index, const uint8_t r, const uint8_t g, const uint8_t
     leds[index].B = b;
 }
 
+/**
+ * Atribui uma cor ao LED da coluna x, linha y (0, 0 no canto superior esquerdo) da matriz 5x5.
+ */
+void npSetXY(const uint x, const uint y, const uint8_t r, const uint8_t g, const uint8_t b)
+{
+    if (led_count >= NP_GLIFO_LEDS && x < NP_GLIFO_LADO && y < NP_GLIFO_LADO)
+        npSetLED(np_mapa[y * NP_GLIFO_LADO + x], r, g, b);
+}
+
+/**
+ * Pinta os LEDs acesos de um glifo 5x5 (np_glifos.h), deslocado dx colunas e dy linhas.
+ */
+void npDesenharGlifo(uint32_t glifo, int dx, int dy, const uint8_t r, const uint8_t g, const uint8_t b)
+{
+    if (led_count < NP_GLIFO_LEDS)
+        return;
+
+    uint32_t restante = np_glifo_deslocar(glifo, dx, dy);
+    int bit;
+    while ((bit = np_glifo_proximo(&restante)) >= 0)
+        npSetLED(np_mapa[NP_GLIFO_LEDS - 1 - bit], r, g, b);
+}
+
 /**
  * Limpa o buffer de pixels.
  */
@@ -74,17 +96,18 @@ void npClear()
 
 /**
  * Escreve os dados do buffer nos LEDs.
+ *
+ * Empacota os pixels no quadro e dispara o DMA sem esperar a transmissão; o RESET de 100us
+ * do datasheet é aguardado pelo próximo envio.
  */
 void npWrite()
 {
-    // Escreve cada dado de 8-bits dos pixels em sequência no buffer da máquina PIO.
+    np_tx_wait(&np_tx);
     for (uint i = 0; i < led_count; ++i)
     {
-        pio_sm_put_blocking(np_pio, np_sm, leds[i].G);
-        pio_sm_put_blocking(np_pio, np_sm, leds[i].R);
-        pio_sm_put_blocking(np_pio, np_sm, leds[i].B);
+        np_quadro[i] = np_tx_word(leds[i].R, leds[i].G, leds[i].B);
     }
-    sleep_us(100); // Espera 100us, sinal de RESET do datasheet.
+    np_tx_start(&np_tx);
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,202 @@
+/**
+ * @file adc_anel.c
+ * @brief Implementação da captura contínua do ADC em buffer circular (dois canais DMA).
+ *
+ * Dependências: Pico SDK (`hardware/adc.h`, `hardware/dma.h`).
+ */
+
+#include <string.h>
+#include "hardware/adc.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "adc_anel.h"
+
+// Anéis com eventos de bloco, atendidos pelo handler compartilhado de DMA_IRQ_1
+static adc_anel_t *com_blocos[ADC_ANEL_MAX_BLOCOS];
+static bool handler_instalado;
+
+static void irq_blocos(void) {
+    for (uint i = 0; i < ADC_ANEL_MAX_BLOCOS; i++) {
+        adc_anel_t *a = com_blocos[i];
+        if (a == NULL || !dma_channel_get_irq1_status((uint)a->canal_dados)) {
+            continue;
+        }
+        dma_channel_acknowledge_irq1((uint)a->canal_dados);
+
+        uint32_t k = a->blocos_prontos;
+        a->blocos_prontos = k + 1;
+        if (a->evento) {
+            a->evento(a, &a->buffer[(k * a->bloco) & a->mascara]);
+        }
+    }
+}
+
+static bool registrar_blocos(adc_anel_t *a) {
+    for (uint i = 0; i < ADC_ANEL_MAX_BLOCOS; i++) {
+        if (com_blocos[i] == NULL) {
+            com_blocos[i] = a;
+            if (!handler_instalado) {
+                irq_add_shared_handler(DMA_IRQ_1, irq_blocos, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+                irq_set_enabled(DMA_IRQ_1, true);
+                handler_instalado = true;
+            }
+            dma_channel_set_irq1_enabled((uint)a->canal_dados, true);
+            return true;
+        }
+    }
+    return false;
+}
+
+static void desregistrar_blocos(adc_anel_t *a) {
+    for (uint i = 0; i < ADC_ANEL_MAX_BLOCOS; i++) {
+        if (com_blocos[i] == a) {
+            dma_channel_set_irq1_enabled((uint)a->canal_dados, false);
+            com_blocos[i] = NULL;
+        }
+    }
+}
+
+// Reserva os dois canais e liga a captura e o ADC, com o canal de dados redisparado a cada
+// 2^log2_bloco amostras (e, se blocos, uma interrupção por disparo)
+static bool iniciar(adc_anel_t *a, uint16_t *buffer, uint log2_amostras, uint log2_bloco, bool blocos,
+                    adc_anel_evento_t evento) {
+    if (log2_amostras == 0 || log2_amostras > ADC_ANEL_LOG2_MAX || log2_bloco > log2_amostras) {
+        return false;
+    }
+
+    a->canal_dados = dma_claim_unused_channel(false);
+    a->canal_recarga = dma_claim_unused_channel(false);
+    if (a->canal_dados < 0 || a->canal_recarga < 0) {
+        if (a->canal_dados >= 0) dma_channel_unclaim((uint)a->canal_dados);
+        if (a->canal_recarga >= 0) dma_channel_unclaim((uint)a->canal_recarga);
+        return false;
+    }
+
+    a->buffer = buffer;
+    a->mascara = (1u << log2_amostras) - 1;
+    a->bloco = 1u << log2_bloco;
+    a->contagem = a->bloco;
+    a->lido = 0;
+    a->blocos_prontos = 0;
+    a->blocos_lidos = 0;
+    a->blocos_perdidos = 0;
+    a->evento = evento;
+
+    if (blocos && !registrar_blocos(a)) {
+        dma_channel_unclaim((uint)a->canal_dados);
+        dma_channel_unclaim((uint)a->canal_recarga);
+        return false;
+    }
+
+    // Dados: FIFO do ADC → buffer, 16 bits, escrita com wrap no tamanho do buffer; ao fim de
+    // cada disparo (um bloco ou uma volta), encadeia a recarga
+    dma_channel_config cfg = dma_channel_get_default_config((uint)a->canal_dados);
+    channel_config_set_transfer_data_size(&cfg, DMA_SIZE_16);
+    channel_config_set_read_increment(&cfg, false);
+    channel_config_set_write_increment(&cfg, true);
+    channel_config_set_ring(&cfg, true, log2_amostras + 1);
+    channel_config_set_dreq(&cfg, DREQ_ADC);
+    channel_config_set_chain_to(&cfg, (uint)a->canal_recarga);
+    dma_channel_configure((uint)a->canal_dados, &cfg, buffer, &adc_hw->fifo, a->contagem, false);
+
+    // Recarga: uma palavra (a contagem) no registrador de contagem com gatilho do canal de dados.
+    // O endereço de escrita dele não é tocado, então o próximo disparo continua de onde parou.
+    dma_channel_config rec = dma_channel_get_default_config((uint)a->canal_recarga);
+    channel_config_set_transfer_data_size(&rec, DMA_SIZE_32);
+    channel_config_set_read_increment(&rec, false);
+    channel_config_set_write_increment(&rec, false);
+    dma_channel_configure((uint)a->canal_recarga, &rec, &dma_hw->ch[a->canal_dados].al1_transfer_count_trig,
+                          &a->contagem, 1, false);
+
+    adc_fifo_drain();
+    dma_channel_start((uint)a->canal_dados);
+    adc_run(true);
+    return true;
+}
+
+// Captura contínua sem blocos: o canal de dados é redisparado uma vez por volta, e o consumo
+// é feito por janelas com adc_anel_ler(). Retorna false se o tamanho for inválido ou faltar
+// canal DMA livre.
+bool adc_anel_iniciar(adc_anel_t *a, uint16_t *buffer, uint log2_amostras) {
+    return iniciar(a, buffer, log2_amostras, log2_amostras, false, NULL);
+}
+
+// Captura contínua em blocos de 2^log2_bloco amostras, com evento (opcional, pode ser NULL)
+// chamado na interrupção de cada bloco completado. Retorna false também se já houver
+// ADC_ANEL_MAX_BLOCOS anéis com blocos ativos.
+bool adc_anel_iniciar_blocos(adc_anel_t *a, uint16_t *buffer, uint log2_amostras, uint log2_bloco,
+                             adc_anel_evento_t evento) {
+    return iniciar(a, buffer, log2_amostras, log2_bloco, true, evento);
+}
+
+// Para o ADC e os dois canais e os libera
+void adc_anel_parar(adc_anel_t *a) {
+    adc_run(false);
+    desregistrar_blocos(a);
+    dma_channel_abort((uint)a->canal_recarga);
+    dma_channel_abort((uint)a->canal_dados);
+    dma_channel_unclaim((uint)a->canal_recarga);
+    dma_channel_unclaim((uint)a->canal_dados);
+    adc_fifo_drain();
+}
+
+// Índice (no buffer) da próxima amostra que o DMA vai escrever
+static inline uint32_t posicao_escrita(const adc_anel_t *a) {
+    uintptr_t escrita = (uintptr_t)dma_channel_hw_addr((uint)a->canal_dados)->write_addr;
+    return (uint32_t)((escrita - (uintptr_t)a->buffer) / sizeof(uint16_t)) & a->mascara;
+}
+
+// Amostras capturadas e ainda não consumidas
+uint32_t adc_anel_disponiveis(const adc_anel_t *a) {
+    return (posicao_escrita(a) - a->lido) & a->mascara;
+}
+
+// Copia as próximas n amostras para destino, se já estiverem no buffer; senão retorna false
+// sem esperar. n deve ser menor que o buffer, e o consumo precisa acompanhar a captura (uma
+// volta inteira sem leitura não é detectada).
+bool adc_anel_ler(adc_anel_t *a, uint16_t *destino, uint32_t n) {
+    if (adc_anel_disponiveis(a) < n) {
+        return false;
+    }
+
+    uint32_t ate_o_fim = a->mascara + 1 - a->lido;
+    if (n <= ate_o_fim) {
+        memcpy(destino, &a->buffer[a->lido], n * sizeof(uint16_t));
+    }
+    else {
+        memcpy(destino, &a->buffer[a->lido], ate_o_fim * sizeof(uint16_t));
+        memcpy(destino + ate_o_fim, a->buffer, (n - ate_o_fim) * sizeof(uint16_t));
+    }
+    a->lido = (a->lido + n) & a->mascara;
+    return true;
+}
+
+// Pula para a amostra mais recente (por exemplo, depois de uma pausa longa no consumo)
+void adc_anel_descartar(adc_anel_t *a) {
+    a->lido = posicao_escrita(a);
+}
+
+// Bloco pronto mais antigo ainda não liberado, lido direto no anel (sem cópia), ou NULL se
+// nenhum bloco completou desde o último liberado. Não espera. Se o consumidor ficou uma volta
+// inteira para trás, os blocos já sobrescritos são pulados e contados em blocos_perdidos.
+const uint16_t *adc_anel_proximo_bloco(adc_anel_t *a) {
+    uint32_t prontos = a->blocos_prontos;
+    uint32_t n_blocos = (a->mascara + 1) / a->bloco;
+
+    // O bloco em captura ocupa o lugar do pronto mais antigo quando a distância chega a n_blocos
+    if (prontos - a->blocos_lidos >= n_blocos) {
+        uint32_t mais_antigo = prontos - (n_blocos - 1);
+        a->blocos_perdidos += mais_antigo - a->blocos_lidos;
+        a->blocos_lidos = mais_antigo;
+    }
+    if (a->blocos_lidos == prontos) {
+        return NULL;
+    }
+    return &a->buffer[(a->blocos_lidos * a->bloco) & a->mascara];
+}
+
+// Devolve à captura o bloco obtido com adc_anel_proximo_bloco(). Ele precisa ser processado
+// antes que a captura dê a volta até ele (n_blocos - 1 tempos de bloco).
+void adc_anel_liberar_bloco(adc_anel_t *a) {
+    a->blocos_lidos++;
+}
@@ -0,0 +1,70 @@
+/**
+ * @file adc_anel.h
+ * @brief Captura contínua do ADC por DMA em um buffer circular.
+ *
+ * Substitui o ciclo "liga o ADC, configura o DMA, espera N amostras, desliga" por uma captura
+ * que nunca para:
+ * - O canal de dados lê o FIFO do ADC (DREQ_ADC) e escreve no buffer com wrap de endereço
+ *   (`channel_config_set_ring()`), então o ponteiro de escrita volta sozinho ao início.
+ * - Ao fim de cada volta, ele encadeia um segundo canal (recarga) que reescreve a contagem do
+ *   primeiro e o redispara. O FIFO do ADC segura as amostras durante os poucos ciclos da recarga:
+ *   não há tempo morto entre voltas.
+ * - A posição de escrita é lida do próprio canal DMA; quem consome guarda só o índice de leitura
+ *   e copia janelas completas com `adc_anel_ler()`, sem bloquear.
+ *
+ * Com `adc_anel_iniciar_blocos()` o anel é dividido em blocos de 2^k amostras: o canal de dados
+ * para (e é redisparado pela recarga) ao fim de cada bloco, e a interrupção desse fim (DMA_IRQ_1,
+ * handler compartilhado) conta o bloco como pronto e chama o evento opcional, ainda na IRQ.
+ * `adc_anel_proximo_bloco()` devolve o bloco pronto mais antigo direto no anel, sem cópia e sem
+ * esperar; `adc_anel_liberar_bloco()` o devolve à captura. Com dois blocos é o ping-pong clássico
+ * entre metades; com mais, o consumidor ganha folga para atrasar.
+ *
+ * O buffer precisa ter 2^n amostras e estar alinhado ao seu tamanho em bytes (exigência do wrap
+ * do DMA); `ADC_ANEL_BUFFER()` declara um assim. O ADC (entrada, divisor, FIFO com DREQ) é
+ * configurado por quem chama; `adc_anel_iniciar()` só liga o DMA e o `adc_run()`.
+ */
+
+#ifndef ADC_ANEL_H
+#define ADC_ANEL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "pico/types.h"
+
+#define ADC_ANEL_LOG2_MAX 14    // wrap do DMA vai até 2^15 bytes
+#define ADC_ANEL_MAX_BLOCOS 2   // anéis com eventos de bloco ao mesmo tempo
+
+// Declara um buffer de 2^log2 amostras alinhado para o wrap do DMA
+#define ADC_ANEL_BUFFER(nome, log2) \
+    static uint16_t nome[1u << (log2)] __attribute__((aligned(2u << (log2))))
+
+typedef struct adc_anel adc_anel_t;
+
+// Chamado na interrupção de fim de cada bloco, com o bloco recém-completado
+typedef void (*adc_anel_evento_t)(adc_anel_t *a, const uint16_t *bloco);
+
+struct adc_anel {
+    uint16_t *buffer;
+    uint32_t mascara;           // amostras - 1
+    uint32_t bloco;             // amostras por disparo do canal de dados
+    int canal_dados;
+    int canal_recarga;
+    uint32_t contagem;          // recarregada no canal de dados a cada disparo (lida pelo DMA)
+    uint32_t lido;              // índice da próxima amostra a consumir (adc_anel_ler)
+    volatile uint32_t blocos_prontos;   // blocos completados desde o início (contados na IRQ)
+    uint32_t blocos_lidos;              // blocos já liberados pelo consumidor
+    uint32_t blocos_perdidos;           // sobrescritos pela captura antes de consumidos
+    adc_anel_evento_t evento;
+};
+
+bool adc_anel_iniciar(adc_anel_t *a, uint16_t *buffer, uint log2_amostras);
+bool adc_anel_iniciar_blocos(adc_anel_t *a, uint16_t *buffer, uint log2_amostras, uint log2_bloco,
+                             adc_anel_evento_t evento);
+void adc_anel_parar(adc_anel_t *a);
+uint32_t adc_anel_disponiveis(const adc_anel_t *a);
+bool adc_anel_ler(adc_anel_t *a, uint16_t *destino, uint32_t n);
+void adc_anel_descartar(adc_anel_t *a);
+const uint16_t *adc_anel_proximo_bloco(adc_anel_t *a);
+void adc_anel_liberar_bloco(adc_anel_t *a);
+
+#endif
@@ -0,0 +1,107 @@
+/**
+ * @file adc_reducao.c
+ * @brief Implementação da redução inteira de blocos do ADC.
+ */
+
+#include "adc_reducao.h"
+
+// Com amostras de 12 bits, cada quadrado cabe em 24 bits: 256 deles somam menos de 2^32, então
+// Σx² anda em 32 bits por trechos de até 256 amostras e só vai para os 64 bits no fim do trecho
+#define TRECHO_QUAD 256u
+
+void adc_reducao_zerar(adc_reducao_t *r) {
+    r->n = 0;
+    r->soma = 0;
+    r->soma_quad = 0;
+    r->min = UINT16_MAX;
+    r->max = 0;
+}
+
+// Soma os códigos de um bloco no acumulador
+void adc_reducao_somar(adc_reducao_t *r, const uint16_t *amostras, uint32_t n) {
+    uint32_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    const uint16_t *p = amostras;
+    uint32_t i = n >> 2;
+
+    while (i--) {
+        s0 += p[0];
+        s1 += p[1];
+        s2 += p[2];
+        s3 += p[3];
+        p += 4;
+    }
+    for (i = n & 3; i; i--) {
+        s0 += *p++;
+    }
+
+    r->soma += s0 + s1 + s2 + s3;
+    r->n += n;
+}
+
+// Soma, mínimo, máximo e Σx² de um bloco, na mesma passada
+void adc_reducao_somar_estat(adc_reducao_t *r, const uint16_t *amostras, uint32_t n) {
+    uint32_t soma = 0;
+    uint32_t min = r->min, max = r->max;
+    const uint16_t *p = amostras;
+    uint32_t restam = n;
+
+    while (restam) {
+        uint32_t trecho = restam < TRECHO_QUAD ? restam : TRECHO_QUAD;
+        uint32_t q0 = 0, q1 = 0;
+        uint32_t i = trecho >> 2;
+
+        restam -= trecho;
+        while (i--) {
+            uint32_t a = p[0], b = p[1], c = p[2], d = p[3];
+            p += 4;
+
+            soma += a + b + c + d;
+            q0 += a * a + b * b;
+            q1 += c * c + d * d;
+
+            // Mínimo e máximo do grupo de 4 primeiro: 4 comparações para o grupo em vez de 8
+            uint32_t lo_ab = a < b ? a : b, hi_ab = a < b ? b : a;
+            uint32_t lo_cd = c < d ? c : d, hi_cd = c < d ? d : c;
+            uint32_t lo = lo_ab < lo_cd ? lo_ab : lo_cd;
+            uint32_t hi = hi_ab > hi_cd ? hi_ab : hi_cd;
+            if (lo < min) {
+                min = lo;
+            }
+            if (hi > max) {
+                max = hi;
+            }
+        }
+        for (i = trecho & 3; i; i--) {
+            uint32_t a = *p++;
+            soma += a;
+            q0 += a * a;
+            if (a < min) {
+                min = a;
+            }
+            if (a > max) {
+                max = a;
+            }
+        }
+        r->soma_quad += (uint64_t)q0 + q1;
+    }
+
+    r->soma += soma;
+    r->n += n;
+    r->min = (uint16_t)min;
+    r->max = (uint16_t)max;
+}
+
+// Média dos códigos acumulados (0 se o acumulador está vazio)
+float adc_reducao_media(const adc_reducao_t *r) {
+    return r->n ? (float)r->soma / (float)r->n : 0.0f;
+}
+
+// Variância populacional dos códigos, em contagens². O numerador n·Σx² - (Σx)² sai exato em
+// inteiros (Σx² - ⌊(Σx)²/n⌋, erro < 1 contagem² no total); só a divisão final é em float.
+float adc_reducao_variancia(const adc_reducao_t *r) {
+    if (r->n == 0) {
+        return 0.0f;
+    }
+    uint64_t quad_media = ((uint64_t)r->soma * r->soma) / r->n;
+    return (float)(r->soma_quad - quad_media) / (float)r->n;
+}
@@ -0,0 +1,40 @@
+/**
+ * @file adc_reducao.h
+ * @brief Redução de blocos de amostras cruas do ADC (12 bits) em inteiros: soma, mínimo, máximo
+ * e soma dos quadrados numa só passada, para converter a média em grandeza física uma vez só.
+ *
+ * Converter cada amostra para °C (ou volts) antes de somar custa uma multiplicação e uma divisão
+ * em ponto flutuante por amostra, emuladas em software no RP2040 (o M0+ não tem FPU). Como a
+ * conversão é linear, a média das conversões é a conversão da média: basta somar os códigos
+ * crus em inteiro e converter o resultado no fim.
+ *
+ * - Os laços internos andam de 4 em 4 amostras, com acumuladores independentes.
+ * - `adc_reducao_somar()` só soma (o caso da média); `adc_reducao_somar_estat()` também guarda
+ *   mínimo, máximo e Σx², para a variância, na mesma passada.
+ * - Um acumulador pode receber vários blocos seguidos (todos os blocos prontos do anel, por
+ *   exemplo). A soma é de 32 bits: cabem até ADC_REDUCAO_MAX_AMOSTRAS amostras de 12 bits.
+ * - As amostras precisam ter no máximo 12 bits (FIFO do ADC sem o bit de erro).
+ */
+
+#ifndef ADC_REDUCAO_H
+#define ADC_REDUCAO_H
+
+#include <stdint.h>
+
+#define ADC_REDUCAO_MAX_AMOSTRAS (1u << 20)    // 4095 · 2^20 < 2^32
+
+typedef struct {
+    uint32_t n;             // amostras acumuladas
+    uint32_t soma;          // Σx
+    uint64_t soma_quad;     // Σx² (só com adc_reducao_somar_estat)
+    uint16_t min;           // menor código visto (só com adc_reducao_somar_estat)
+    uint16_t max;           // maior código visto (só com adc_reducao_somar_estat)
+} adc_reducao_t;
+
+void adc_reducao_zerar(adc_reducao_t *r);
+void adc_reducao_somar(adc_reducao_t *r, const uint16_t *amostras, uint32_t n);
+void adc_reducao_somar_estat(adc_reducao_t *r, const uint16_t *amostras, uint32_t n);
+float adc_reducao_media(const adc_reducao_t *r);
+float adc_reducao_variancia(const adc_reducao_t *r);
+
+#endif
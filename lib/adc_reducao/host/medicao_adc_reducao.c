@@ -0,0 +1,189 @@
+/**
+ * @file medicao_adc_reducao.c
+ * @brief Redução inteira dos blocos do ADC contra a conversão em float por amostra e contra
+ * contas em double, e vazão dos dois caminhos.
+ *
+ * Confere soma, mínimo, máximo e Σx² contra um laço direto em 64 bits para blocos de todos os
+ * tamanhos de resto (0 a 3 amostras fora dos grupos de 4, trechos de Σx² quebrados no meio),
+ * para vários blocos no mesmo acumulador e para o acumulador cheio (2^20 amostras de 4095). A
+ * média convertida uma vez para °C tem de bater com a média das conversões por amostra do
+ * caminho antigo e ficar pelo menos tão perto quanto ele da conta em double; a variância tem de
+ * bater com a double. Depois mede amostras por segundo da conversão por amostra, da soma e da
+ * soma com estatísticas.
+ */
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include "teste.h"
+#include "adc_reducao.h"
+
+#define BLOCO 4096
+#define BLOCOS 200
+
+// Conversão dos leitores de temperatura (sensor interno do RP2040)
+static float convert_to_celsius(float raw) {
+    const float conv = 3.3f / (1 << 12);
+    float voltage = raw * conv;
+    return 27.0f - (voltage - 0.706f) / 0.001721f;
+}
+
+static double celsius_double(double raw) {
+    return 27.0 - (raw * 3.3 / 4096 - 0.706) / 0.001721;
+}
+
+// Caminho antigo: cada amostra convertida em float e a média tirada das conversões
+__attribute__((noinline)) static float media_float(const uint16_t *amostras, uint32_t n) {
+    float soma = 0.0f;
+    for (uint32_t i = 0; i < n; i++) {
+        soma += convert_to_celsius((float)amostras[i]);
+    }
+    return soma / (float)n;
+}
+
+typedef struct {
+    uint64_t soma, soma_quad;
+    uint16_t min, max;
+} referencia_t;
+
+static void referencia(referencia_t *r, const uint16_t *amostras, uint32_t n) {
+    for (uint32_t i = 0; i < n; i++) {
+        r->soma += amostras[i];
+        r->soma_quad += (uint64_t)amostras[i] * amostras[i];
+        r->min = amostras[i] < r->min ? amostras[i] : r->min;
+        r->max = amostras[i] > r->max ? amostras[i] : r->max;
+    }
+}
+
+static bool confere(const adc_reducao_t *r, const referencia_t *ref, uint32_t n) {
+    return r->n == n && r->soma == ref->soma && r->soma_quad == ref->soma_quad && r->min == ref->min &&
+           r->max == ref->max;
+}
+
+static uint32_t semente = 5;
+
+static uint32_t aleatorio(void) {
+    semente = semente * 1103515245u + 12345u;
+    return semente >> 8;
+}
+
+// Bloco parecido com o sensor: passeio aleatório em torno de 876..1075 (uns 27 °C ± 25)
+static void bloco_sensor(uint16_t *amostras, uint32_t n) {
+    static int32_t x = 975;
+    for (uint32_t i = 0; i < n; i++) {
+        x += (int32_t)(aleatorio() % 9) - 4;
+        x = x < 876 ? 876 : x > 1075 ? 1075 : x;
+        amostras[i] = (uint16_t)(x + (int32_t)(aleatorio() % 5) - 2);
+    }
+}
+
+int main(void) {
+    static uint16_t amostras[BLOCO];
+    static uint16_t grande[ADC_REDUCAO_MAX_AMOSTRAS];
+    adc_reducao_t r, s;
+
+    // Blocos de 0 a 600 amostras (restos de 0 a 3 e trechos de Σx² incompletos), escala cheia
+    int errados = 0;
+    for (uint32_t n = 0; n <= 600; n++) {
+        for (uint32_t i = 0; i < n; i++) {
+            amostras[i] = (uint16_t)(aleatorio() & 0xFFF);
+        }
+        referencia_t ref = { 0, 0, UINT16_MAX, 0 };
+        referencia(&ref, amostras, n);
+        adc_reducao_zerar(&r);
+        adc_reducao_zerar(&s);
+        adc_reducao_somar(&r, amostras, n);
+        adc_reducao_somar_estat(&s, amostras, n);
+        errados += r.n != n || r.soma != ref.soma || !confere(&s, &ref, n);
+    }
+    VERIFICA(errados == 0, "%d tamanhos de bloco com soma, Σx², mínimo ou máximo errados", errados);
+
+    // Vários blocos de tamanhos diferentes no mesmo acumulador
+    referencia_t ref = { 0, 0, UINT16_MAX, 0 };
+    adc_reducao_zerar(&s);
+    uint32_t total = 0;
+    for (int b = 0; b < 50; b++) {
+        uint32_t n = 1 + aleatorio() % BLOCO;
+        bloco_sensor(amostras, n);
+        referencia(&ref, amostras, n);
+        adc_reducao_somar_estat(&s, amostras, n);
+        total += n;
+    }
+    VERIFICA(confere(&s, &ref, total), "acumulador de 50 blocos difere da soma direta");
+
+    // Acumulador cheio: 2^20 amostras no máximo do ADC ainda cabem na soma de 32 bits
+    for (uint32_t i = 0; i < ADC_REDUCAO_MAX_AMOSTRAS; i++) {
+        grande[i] = 4095;
+    }
+    adc_reducao_zerar(&s);
+    adc_reducao_somar_estat(&s, grande, ADC_REDUCAO_MAX_AMOSTRAS);
+    VERIFICA(s.soma == 4095u * ADC_REDUCAO_MAX_AMOSTRAS && s.soma_quad == 4095ull * 4095 * ADC_REDUCAO_MAX_AMOSTRAS &&
+             adc_reducao_media(&s) == 4095.0f && adc_reducao_variancia(&s) == 0.0f,
+             "acumulador cheio: soma %u, média %f, variância %f", s.soma, adc_reducao_media(&s),
+             adc_reducao_variancia(&s));
+    adc_reducao_zerar(&s);
+    VERIFICA(adc_reducao_media(&s) == 0.0f && adc_reducao_variancia(&s) == 0.0f, "acumulador vazio não dá 0");
+
+    // Média em °C: converter a média inteira contra converter cada amostra
+    double erro_int = 0, erro_flt = 0, diferenca = 0, erro_var = 0;
+    for (int b = 0; b < BLOCOS; b++) {
+        bloco_sensor(amostras, BLOCO);
+        adc_reducao_zerar(&s);
+        adc_reducao_somar_estat(&s, amostras, BLOCO);
+
+        double soma = 0, soma2 = 0;
+        for (int i = 0; i < BLOCO; i++) {
+            soma += amostras[i];
+            soma2 += (double)amostras[i] * amostras[i];
+        }
+        double media = soma / BLOCO, variancia = soma2 / BLOCO - media * media;
+        double c_ref = celsius_double(media);
+        float c_int = convert_to_celsius(adc_reducao_media(&s));
+        float c_flt = media_float(amostras, BLOCO);
+
+        erro_int = fmax(erro_int, fabs(c_int - c_ref));
+        erro_flt = fmax(erro_flt, fabs(c_flt - c_ref));
+        diferenca = fmax(diferenca, fabs((double)c_int - c_flt));
+        erro_var = fmax(erro_var, fabs(adc_reducao_variancia(&s) - variancia) / (variancia + 1));
+    }
+    VERIFICA(diferenca < 0.001, "média inteira difere da média das conversões em %.5f °C", diferenca);
+    VERIFICA(erro_int <= erro_flt, "média inteira mais longe do double (%.6f °C) que a por amostra (%.6f °C)",
+             erro_int, erro_flt);
+    VERIFICA(erro_var < 1e-5, "variância com erro relativo %.2g contra o double", erro_var);
+
+    // Vazão
+    const int voltas = 2000;
+    volatile float afundar = 0;
+    double t0 = teste_agora();
+    for (int v = 0; v < voltas; v++) {
+        amostras[v % BLOCO] ^= 1;
+        afundar += media_float(amostras, BLOCO);
+    }
+    double por_amostra = (double)voltas * BLOCO / (teste_agora() - t0);
+
+    t0 = teste_agora();
+    for (int v = 0; v < voltas; v++) {
+        amostras[v % BLOCO] ^= 1;
+        adc_reducao_zerar(&r);
+        adc_reducao_somar(&r, amostras, BLOCO);
+        afundar += convert_to_celsius(adc_reducao_media(&r));
+    }
+    double so_soma = (double)voltas * BLOCO / (teste_agora() - t0);
+
+    t0 = teste_agora();
+    for (int v = 0; v < voltas; v++) {
+        amostras[v % BLOCO] ^= 1;
+        adc_reducao_zerar(&s);
+        adc_reducao_somar_estat(&s, amostras, BLOCO);
+        afundar += adc_reducao_variancia(&s);
+    }
+    double com_estat = (double)voltas * BLOCO / (teste_agora() - t0);
+
+    printf("média em °C: diferença máxima %.5f para o caminho por amostra; erro contra double %.6f (inteiro) e "
+           "%.6f (por amostra)\n", diferenca, erro_int, erro_flt);
+    printf("M amostras/s: float por amostra %.0f, soma inteira %.0f, soma + mín/máx/variância %.0f\n",
+           por_amostra / 1e6, so_soma / 1e6, com_estat / 1e6);
+    printf("no RP2040 o caminho por amostra faz %d conversões, multiplicações e divisões em soft-float por bloco; "
+           "o inteiro, uma de cada\n", BLOCO);
+    return TESTE_FIM();
+}
@@ -0,0 +1,171 @@
+/**
+ * @file adc_varredura.c
+ * @brief Implementação da varredura round-robin do ADC e da demultiplexação por canal.
+ *
+ * Dependências: Pico SDK (`hardware/adc.h`) e lib/adc_anel.
+ */
+
+#include "hardware/adc.h"
+#include "adc_varredura.h"
+
+// O ADC é um só: a varredura que recebe os eventos de bloco do anel
+static adc_varredura_t *ativa;
+
+// Evento de fim de bloco do anel (interrupção do DMA): separa o bloco por canal numa passada e
+// publica média, mínimo e máximo de cada um. O contador de versão fica ímpar durante a escrita,
+// para adc_varredura_ler() não pegar uma mistura de dois blocos.
+static void demultiplexar(adc_anel_t *a, const uint16_t *bloco) {
+    adc_varredura_t *v = ativa;
+    if (v == NULL || a != &v->anel) {
+        return;
+    }
+
+    const uint n = v->n_canais;
+    const uint32_t tamanho = a->bloco;
+    const uint fase = v->fase;
+    uint32_t soma[ADC_VARREDURA_ENTRADAS] = {0};
+    uint32_t min[ADC_VARREDURA_ENTRADAS];
+    uint32_t max[ADC_VARREDURA_ENTRADAS];
+
+    for (uint p = 0; p < n; p++) {
+        min[p] = UINT16_MAX;
+        max[p] = 0;
+    }
+
+    uint p = fase;
+    for (uint32_t i = 0; i < tamanho; i++) {
+        uint32_t x = bloco[i];
+        soma[p] += x;
+        if (x < min[p]) {
+            min[p] = x;
+        }
+        if (x > max[p]) {
+            max[p] = x;
+        }
+        if (++p == n) {
+            p = 0;
+        }
+    }
+
+    v->quadros++;
+    for (p = 0; p < n; p++) {
+        // Primeira amostra da posição p no bloco e quantas amostras ela tem
+        uint32_t inicio = (p + n - fase) % n;
+        uint32_t contagem = inicio < tamanho ? (tamanho - inicio + n - 1) / n : 0;
+        uint e = v->entrada[p];
+
+        if (contagem == 0) {
+            continue;
+        }
+        v->media[e] = (uint16_t)((soma[p] + contagem / 2) / contagem);
+        v->min[e] = (uint16_t)min[p];
+        v->max[e] = (uint16_t)max[p];
+    }
+    v->quadros++;
+
+    for (p = 0; p < n; p++) {
+        uint e = v->entrada[p];
+        adc_varredura_assinante_t assinante = v->assinante[e];
+        if (assinante == NULL) {
+            continue;
+        }
+
+        uint32_t inicio = (p + n - fase) % n;
+        adc_varredura_canal_t canal = {
+            .amostras = bloco + inicio,
+            .n = inicio < tamanho ? (tamanho - inicio + n - 1) / n : 0,
+            .passo = (uint8_t)n,
+            .media = v->media[e],
+            .min = v->min[e],
+            .max = v->max[e],
+        };
+        assinante(e, &canal, v->contexto[e]);
+    }
+
+    v->fase = (uint8_t)((fase + tamanho % n) % n);
+}
+
+// Liga a varredura das entradas da máscara (bits 0..4), cada uma a taxa_por_canal_hz, num anel
+// de 2^log2_amostras amostras intercaladas em blocos de 2^log2_bloco. Acima de 500 kS/s no total
+// o ADC fica na taxa máxima. Retorna false se a máscara for vazia, já houver uma varredura
+// ativa ou o anel não puder ser iniciado (tamanho inválido, sem canal DMA livre).
+bool adc_varredura_iniciar(adc_varredura_t *v, uint16_t *buffer, uint log2_amostras, uint log2_bloco,
+                           uint8_t mascara, uint32_t taxa_por_canal_hz) {
+    mascara &= (1u << ADC_VARREDURA_ENTRADAS) - 1;
+    if (mascara == 0 || taxa_por_canal_hz == 0 || ativa != NULL) {
+        return false;
+    }
+
+    v->mascara = mascara;
+    v->n_canais = 0;
+    for (uint e = 0; e < ADC_VARREDURA_ENTRADAS; e++) {
+        if (mascara & ADC_VARREDURA_ENTRADA(e)) {
+            v->entrada[v->n_canais++] = (uint8_t)e;
+        }
+        v->media[e] = 0;
+        v->min[e] = 0;
+        v->max[e] = 0;
+        v->assinante[e] = NULL;
+        v->contexto[e] = NULL;
+    }
+    v->fase = 0;
+    v->quadros = 0;
+
+    if (mascara & ADC_VARREDURA_ENTRADA(4)) {
+        adc_set_temp_sensor_enabled(true);
+    }
+
+    // A primeira conversão é da menor entrada; depois o ADC avança sozinho pela máscara
+    adc_select_input(v->entrada[0]);
+    adc_set_round_robin(v->n_canais > 1 ? mascara : 0);
+    adc_fifo_setup(true, true, 1, false, false);
+
+    // Período de conversão = (1 + div) ciclos de 48 MHz, com no mínimo 96 ciclos por conversão
+    float div = 48000000.f / ((float)taxa_por_canal_hz * v->n_canais) - 1.f;
+    adc_set_clkdiv(div > 0.f ? div : 0.f);
+
+    ativa = v;
+    if (!adc_anel_iniciar_blocos(&v->anel, buffer, log2_amostras, log2_bloco, demultiplexar)) {
+        ativa = NULL;
+        adc_set_round_robin(0);
+        return false;
+    }
+    return true;
+}
+
+// Para o ADC e o anel e desliga o round-robin
+void adc_varredura_parar(adc_varredura_t *v) {
+    adc_anel_parar(&v->anel);
+    adc_set_round_robin(0);
+    if (ativa == v) {
+        ativa = NULL;
+    }
+}
+
+// Registra quem recebe, a cada bloco, a vista da entrada no anel (um assinante por entrada;
+// NULL remove). Retorna false se a entrada não faz parte da varredura.
+bool adc_varredura_assinar(adc_varredura_t *v, uint entrada, adc_varredura_assinante_t assinante, void *contexto) {
+    if (entrada >= ADC_VARREDURA_ENTRADAS || !(v->mascara & ADC_VARREDURA_ENTRADA(entrada))) {
+        return false;
+    }
+    v->assinante[entrada] = NULL;
+    v->contexto[entrada] = contexto;
+    v->assinante[entrada] = assinante;
+    return true;
+}
+
+// Média, mínimo e máximo do último bloco da entrada, lidos juntos (do mesmo bloco) de
+// qualquer tarefa ou núcleo
+void adc_varredura_ler(const adc_varredura_t *v, uint entrada, adc_varredura_leitura_t *leitura) {
+    uint32_t antes, depois;
+
+    do {
+        antes = v->quadros;
+        leitura->media = v->media[entrada];
+        leitura->min = v->min[entrada];
+        leitura->max = v->max[entrada];
+        depois = v->quadros;
+    } while (antes != depois || (antes & 1u));
+
+    leitura->quadro = antes / 2;
+}
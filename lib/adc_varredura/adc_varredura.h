@@ -0,0 +1,82 @@
+/**
+ * @file adc_varredura.h
+ * @brief Amostragem de várias entradas do ADC em round-robin, com DMA e demultiplexação por canal.
+ *
+ * Substitui o `adc_select_input()` + `adc_read()` feito amostra a amostra por quem precisa ler
+ * (cada leitura trava a CPU ~2 us e acontece quando a tarefa roda, não num instante fixo):
+ * - O ADC converte sem parar, percorrendo sozinho as entradas da máscara
+ *   (`adc_set_round_robin()`) numa taxa fixa; as amostras intercaladas vão para um anel da
+ *   lib/adc_anel, em blocos de 2^k amostras.
+ * - No fim de cada bloco, ainda na interrupção do DMA, uma única passada pelo bloco separa as
+ *   amostras por canal e publica, para cada entrada, média (o valor decimado), mínimo e máximo
+ *   do bloco. Quem só quer o valor atual lê com `adc_varredura_valor()` ou
+ *   `adc_varredura_ler()`, de qualquer tarefa, sem tocar no ADC.
+ * - Assinantes (`adc_varredura_assinar()`) recebem, por bloco, a vista do seu canal direto no
+ *   anel: ponteiro para a primeira amostra e o passo entre amostras, sem cópia. O callback roda
+ *   na interrupção: precisa ser curto e, no FreeRTOS, usar só as funções "FromISR".
+ *
+ * A ordem das amostras no anel é a das entradas em ordem crescente, começando pela menor da
+ * máscara. Como o bloco nem sempre é múltiplo do número de canais, a fase (canal da primeira
+ * amostra de cada bloco) é acompanhada de bloco em bloco.
+ *
+ * O ADC é um só, então só existe uma varredura ativa por vez. Os pinos (`adc_gpio_init()`) e o
+ * `adc_init()` ficam com quem chama; a entrada 4 (sensor de temperatura) é ligada aqui.
+ */
+
+#ifndef ADC_VARREDURA_H
+#define ADC_VARREDURA_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "pico/types.h"
+#include "adc_anel.h"
+
+#define ADC_VARREDURA_ENTRADAS 5        // entradas 0..3 (GPIO 26..29) e 4 (sensor de temperatura)
+#define ADC_VARREDURA_ENTRADA(n) (1u << (n))
+
+// Vista de um canal dentro de um bloco do anel: amostras[0], amostras[passo], ... (n amostras)
+typedef struct {
+    const uint16_t *amostras;
+    uint32_t n;
+    uint8_t passo;              // número de canais da varredura
+    uint16_t media;
+    uint16_t min;
+    uint16_t max;
+} adc_varredura_canal_t;
+
+// Estatísticas do último bloco de um canal
+typedef struct {
+    uint16_t media;
+    uint16_t min;
+    uint16_t max;
+    uint32_t quadro;            // número do bloco de onde saíram (0 = ainda nenhum)
+} adc_varredura_leitura_t;
+
+typedef void (*adc_varredura_assinante_t)(uint entrada, const adc_varredura_canal_t *canal, void *contexto);
+
+typedef struct {
+    adc_anel_t anel;
+    uint8_t mascara;
+    uint8_t n_canais;
+    uint8_t entrada[ADC_VARREDURA_ENTRADAS];    // posição na varredura → entrada
+    uint8_t fase;                               // posição da primeira amostra do próximo bloco
+    volatile uint32_t quadros;                  // blocos demultiplexados
+    volatile uint16_t media[ADC_VARREDURA_ENTRADAS];
+    volatile uint16_t min[ADC_VARREDURA_ENTRADAS];
+    volatile uint16_t max[ADC_VARREDURA_ENTRADAS];
+    adc_varredura_assinante_t assinante[ADC_VARREDURA_ENTRADAS];
+    void *contexto[ADC_VARREDURA_ENTRADAS];
+} adc_varredura_t;
+
+bool adc_varredura_iniciar(adc_varredura_t *v, uint16_t *buffer, uint log2_amostras, uint log2_bloco,
+                           uint8_t mascara, uint32_t taxa_por_canal_hz);
+void adc_varredura_parar(adc_varredura_t *v);
+bool adc_varredura_assinar(adc_varredura_t *v, uint entrada, adc_varredura_assinante_t assinante, void *contexto);
+void adc_varredura_ler(const adc_varredura_t *v, uint entrada, adc_varredura_leitura_t *leitura);
+
+// Média do último bloco da entrada (o valor decimado), em contagens de 12 bits
+static inline uint16_t adc_varredura_valor(const adc_varredura_t *v, uint entrada) {
+    return v->media[entrada];
+}
+
+#endif
@@ -0,0 +1,97 @@
+/**
+ * @file audio_dsp.c
+ * @brief Implementação da análise de áudio por janelas (DC, RMS, pico e Goertzel).
+ */
+
+#include <math.h>
+#include "audio_dsp.h"
+
+// Coeficientes calculados uma vez; o caminho de cada janela é só inteiro
+void audio_init(audio_analisador_t *a, uint32_t taxa_hz, const uint16_t *freqs_hz, uint8_t n_bandas,
+                uint16_t janela) {
+    if (n_bandas > AUDIO_BANDAS_MAX) {
+        n_bandas = AUDIO_BANDAS_MAX;
+    }
+
+    a->n_bandas = n_bandas;
+    a->janela = janela;
+    a->dc = 2048;       // meio da escala até a primeira janela
+    for (uint8_t b = 0; b < n_bandas; b++) {
+        float w = 2.0f * 3.14159265f * (float)freqs_hz[b] / (float)taxa_hz;
+        a->coef[b] = (int32_t)lroundf(2.0f * cosf(w) * (1 << AUDIO_COEF_Q));
+    }
+}
+
+// Raiz quadrada inteira (piso), bit a bit
+uint32_t audio_isqrt64(uint64_t v) {
+    uint64_t r = 0;
+    uint64_t bit = (uint64_t)1 << 62;
+
+    while (bit > v) {
+        bit >>= 2;
+    }
+    while (bit) {
+        if (v >= r + bit) {
+            v -= r + bit;
+            r = (r >> 1) + bit;
+        }
+        else {
+            r >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint32_t)r;
+}
+
+// s[n] = x[n] + coef·s[n-1] - s[n-2]; no fim, |X|² = s1² + s2² - coef·s1·s2
+static uint32_t goertzel(const uint16_t *amostras, uint16_t n, int32_t dc, int32_t coef) {
+    int32_t s1 = 0, s2 = 0;
+
+    for (uint16_t i = 0; i < n; i++) {
+        int32_t s = (int32_t)amostras[i] - dc + (int32_t)(((int64_t)coef * s1) >> AUDIO_COEF_Q) - s2;
+        s2 = s1;
+        s1 = s;
+    }
+
+    int64_t potencia = (int64_t)s1 * s1 + (int64_t)s2 * s2 - ((((int64_t)coef * s1) >> AUDIO_COEF_Q) * s2);
+    if (potencia < 0) {
+        potencia = 0;
+    }
+    // Amplitude de um tom puro: 2·|X| / N
+    return (2u * audio_isqrt64((uint64_t)potencia)) / n;
+}
+
+// Analisa uma janela de a->janela amostras cruas do ADC
+void audio_analisar(audio_analisador_t *a, const uint16_t *amostras, audio_quadro_t *q) {
+    uint16_t n = a->janela;
+    int32_t dc = a->dc;
+    int32_t soma = 0;               // Σ(x - dc)
+    uint64_t soma_quadrados = 0;    // Σ(x - dc)²
+    uint32_t pico = 0;
+
+    for (uint16_t i = 0; i < n; i++) {
+        int32_t x = (int32_t)amostras[i] - dc;
+        uint32_t modulo = (uint32_t)(x < 0 ? -x : x);
+
+        soma += x;
+        soma_quadrados += modulo * modulo;
+        if (modulo > pico) {
+            pico = modulo;
+        }
+    }
+
+    // Variância em torno da média desta janela: Σ(x - dc)² - (Σ(x - dc))² / N, sem segunda passada
+    uint64_t correcao = (uint64_t)((int64_t)soma * soma) / n;
+    uint64_t desvios = soma_quadrados > correcao ? soma_quadrados - correcao : 0;
+
+    q->rms = (uint16_t)audio_isqrt64(desvios / n);
+    q->pico = (uint16_t)pico;
+    q->dc = (uint16_t)(dc + soma / (int32_t)n);
+
+    for (uint8_t b = 0; b < a->n_bandas; b++) {
+        uint32_t amplitude = goertzel(amostras, n, dc, a->coef[b]);
+        q->banda[b] = (uint16_t)(amplitude > UINT16_MAX ? UINT16_MAX : amplitude);
+    }
+
+    a->dc = q->dc;
+}
@@ -0,0 +1,48 @@
+/**
+ * @file audio_dsp.h
+ * @brief Análise de áudio por janelas em aritmética inteira: nível DC, RMS, pico e um banco
+ * de filtros de Goertzel.
+ *
+ * Cada janela de N amostras cruas do ADC (12 bits) é percorrida uma vez para as estatísticas e
+ * uma vez por banda para o Goertzel:
+ * - O nível DC subtraído é a média da janela anterior, então tudo sai na mesma passada; a média
+ *   da janela atual vira o DC da próxima.
+ * - RMS (em torno da média da própria janela) e pico (em torno do DC usado) saem em contagens
+ *   do ADC. A soma dos quadrados usa 64 bits e a raiz é inteira.
+ * - Cada banda é um Goertzel de uma frequência, com coeficiente 2cos(2πf/fs) em Q14 calculado
+ *   uma vez no `audio_init()`. A amplitude devolvida é a de um tom puro naquela frequência, em
+ *   contagens (2·|X|/N), para comparar direto com o RMS.
+ *
+ * O Goertzel custa uma multiplicação por amostra e por banda, contra N·log N de uma FFT para
+ * todas as frequências: para as poucas colunas de uma matriz de LEDs sai bem mais barato e não
+ * precisa de tabela de senos nem de buffer complexo.
+ */
+
+#ifndef AUDIO_DSP_H
+#define AUDIO_DSP_H
+
+#include <stdint.h>
+
+#define AUDIO_BANDAS_MAX 8
+#define AUDIO_COEF_Q 14         // coeficientes do Goertzel em Q14 (2cos cabe em ±2)
+
+typedef struct {
+    int32_t coef[AUDIO_BANDAS_MAX];     // 2cos(2πf/fs) em Q14
+    uint8_t n_bandas;
+    uint16_t janela;                    // amostras por janela (N)
+    int32_t dc;                         // média da janela anterior, em contagens
+} audio_analisador_t;
+
+typedef struct {
+    uint16_t dc;                        // média desta janela
+    uint16_t rms;                       // contagens, sem DC
+    uint16_t pico;                      // maior |x - dc|
+    uint16_t banda[AUDIO_BANDAS_MAX];   // amplitude de cada banda, contagens
+} audio_quadro_t;
+
+void audio_init(audio_analisador_t *a, uint32_t taxa_hz, const uint16_t *freqs_hz, uint8_t n_bandas,
+                uint16_t janela);
+void audio_analisar(audio_analisador_t *a, const uint16_t *amostras, audio_quadro_t *q);
+uint32_t audio_isqrt64(uint64_t v);
+
+#endif
@@ -0,0 +1,86 @@
+/**
+ * @file audio_wav.c
+ * @brief Leitor mínimo de WAV PCM de 16 bits (RIFF little-endian).
+ */
+
+#include <string.h>
+#include "audio_wav.h"
+
+static uint32_t le32(const uint8_t *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint16_t le16(const uint8_t *p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+// Abre o arquivo e avança até o bloco "data"; só aceita PCM de 16 bits
+bool audio_wav_abrir(audio_wav_t *w, const char *caminho) {
+    uint8_t cab[12];
+    uint8_t bloco[8];
+    uint16_t formato = 0, bits = 0;
+
+    memset(w, 0, sizeof(*w));
+    w->arquivo = fopen(caminho, "rb");
+    if (w->arquivo == NULL) {
+        return false;
+    }
+    if (fread(cab, 1, sizeof(cab), w->arquivo) != sizeof(cab) || memcmp(cab, "RIFF", 4) != 0
+        || memcmp(cab + 8, "WAVE", 4) != 0) {
+        audio_wav_fechar(w);
+        return false;
+    }
+
+    while (fread(bloco, 1, sizeof(bloco), w->arquivo) == sizeof(bloco)) {
+        uint32_t tamanho = le32(bloco + 4);
+
+        if (memcmp(bloco, "fmt ", 4) == 0) {
+            uint8_t fmt[16];
+            if (tamanho < sizeof(fmt) || fread(fmt, 1, sizeof(fmt), w->arquivo) != sizeof(fmt)) {
+                break;
+            }
+            formato = le16(fmt);
+            w->canais = le16(fmt + 2);
+            w->taxa_hz = le32(fmt + 4);
+            bits = le16(fmt + 14);
+            fseek(w->arquivo, (long)(tamanho - sizeof(fmt) + (tamanho & 1)), SEEK_CUR);
+        }
+        else if (memcmp(bloco, "data", 4) == 0) {
+            if (formato != 1 || bits != 16 || w->canais == 0) {
+                break;
+            }
+            w->restantes = tamanho / (2u * w->canais);
+            return true;
+        }
+        else {
+            fseek(w->arquivo, (long)(tamanho + (tamanho & 1)), SEEK_CUR);
+        }
+    }
+
+    audio_wav_fechar(w);
+    return false;
+}
+
+// Lê até n amostras do primeiro canal, já como códigos do ADC; devolve quantas leu
+uint32_t audio_wav_ler_adc(audio_wav_t *w, uint16_t *destino, uint32_t n) {
+    uint8_t quadro[2 * 8];
+    uint32_t lidas = 0;
+    size_t bytes = 2u * w->canais;
+
+    if (bytes > sizeof(quadro)) {
+        return 0;
+    }
+    while (lidas < n && w->restantes > 0 && fread(quadro, 1, bytes, w->arquivo) == bytes) {
+        int16_t s = (int16_t)le16(quadro);
+        destino[lidas++] = (uint16_t)(2048 + s / 16);
+        w->restantes--;
+    }
+    return lidas;
+}
+
+void audio_wav_fechar(audio_wav_t *w) {
+    if (w->arquivo != NULL) {
+        fclose(w->arquivo);
+        w->arquivo = NULL;
+    }
+}
@@ -0,0 +1,28 @@
+/**
+ * @file audio_wav.h
+ * @brief Leitura de arquivos WAV (PCM de 16 bits) como amostras do ADC, para rodar a análise de
+ * áudio no PC.
+ *
+ * Cada amostra do primeiro canal vira o código que o ADC de 12 bits leria com o microfone
+ * polarizado no meio da escala: 2048 + s / 16.
+ */
+
+#ifndef AUDIO_WAV_H
+#define AUDIO_WAV_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+typedef struct {
+    FILE *arquivo;
+    uint32_t taxa_hz;
+    uint16_t canais;
+    uint32_t restantes;     // quadros (amostras por canal) ainda não lidos
+} audio_wav_t;
+
+bool audio_wav_abrir(audio_wav_t *w, const char *caminho);
+uint32_t audio_wav_ler_adc(audio_wav_t *w, uint16_t *destino, uint32_t n);
+void audio_wav_fechar(audio_wav_t *w);
+
+#endif
@@ -0,0 +1,200 @@
+/**
+ * @file medicao_goertzel.c
+ * @brief Banco de Goertzel alimentado por WAV: acerto de cada banda contra a DFT em double e
+ * vazão de janelas.
+ *
+ * Gera medicao_goertzel.wav (PCM de 16 bits a 16 kHz, estéreo, com lixo no segundo canal) com
+ * um tom em cada frequência das bandas do microfone, silêncio e ruído, e o processa janela a
+ * janela como o projeto processa o anel do ADC. Em cada janela, cada banda tem de bater com a
+ * amplitude 2·|X|/N calculada em double sobre as mesmas amostras; com um tom, a banda dele fica
+ * perto da amplitude do tom e as outras bem abaixo, e RMS e pico saem do tom. Depois mede a
+ * vazão do caminho completo (ler o WAV e analisar) e só da análise, contra as 31,25 janelas/s
+ * de tempo real.
+ */
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include "teste.h"
+#include "audio_dsp.h"
+#include "audio_wav.h"
+
+#define TAXA_HZ 16000
+#define JANELA 512
+#define N_BANDAS 5
+#define AMPLITUDE 16384             // PCM; no ADC vira 16384 / 16 = 1024 contagens
+#define AMPLITUDE_ADC (AMPLITUDE / 16)
+#define JANELAS_POR_TRECHO 8
+#define N_TRECHOS (N_BANDAS + 2)    // um tom por banda, silêncio e ruído
+#define ARQUIVO "medicao_goertzel.wav"
+#define PI 3.14159265358979323846
+
+static const uint16_t freqs[N_BANDAS] = { 125, 315, 800, 2000, 5000 };
+
+static void escreve16(FILE *f, uint16_t v) {
+    fputc(v & 0xFF, f);
+    fputc(v >> 8, f);
+}
+
+static void escreve32(FILE *f, uint32_t v) {
+    escreve16(f, (uint16_t)v);
+    escreve16(f, (uint16_t)(v >> 16));
+}
+
+// Amostra do trecho: o tom da banda, silêncio ou ruído uniforme
+static int16_t amostra(int trecho, uint32_t n, uint32_t *semente) {
+    if (trecho < N_BANDAS) {
+        return (int16_t)lround(AMPLITUDE * sin(2 * PI * freqs[trecho] * n / TAXA_HZ));
+    }
+    if (trecho == N_BANDAS) {
+        return 0;
+    }
+    *semente = *semente * 1103515245u + 12345u;
+    return (int16_t)((int32_t)(*semente >> 16) - 32768) / 4;
+}
+
+static bool gerar_wav(const char *caminho) {
+    FILE *f = fopen(caminho, "wb");
+    if (!f) {
+        return false;
+    }
+    uint32_t quadros = N_TRECHOS * JANELAS_POR_TRECHO * JANELA;
+    uint32_t dados = quadros * 2 * 2;
+
+    fwrite("RIFF", 1, 4, f);
+    escreve32(f, 36 + 8 + 4 + dados);
+    fwrite("WAVE", 1, 4, f);
+    fwrite("LIST", 1, 4, f);            // bloco desconhecido: o leitor tem de pular
+    escreve32(f, 4);
+    fwrite("INFO", 1, 4, f);
+    fwrite("fmt ", 1, 4, f);
+    escreve32(f, 16);
+    escreve16(f, 1);                    // PCM
+    escreve16(f, 2);                    // estéreo
+    escreve32(f, TAXA_HZ);
+    escreve32(f, TAXA_HZ * 2 * 2);
+    escreve16(f, 2 * 2);
+    escreve16(f, 16);
+    fwrite("data", 1, 4, f);
+    escreve32(f, dados);
+
+    uint32_t semente = 1, lixo = 99;
+    for (uint32_t n = 0; n < quadros; n++) {
+        escreve16(f, (uint16_t)amostra((int)(n / (JANELAS_POR_TRECHO * JANELA)), n, &semente));
+        lixo = lixo * 1103515245u + 12345u;
+        escreve16(f, (uint16_t)(lixo >> 16));
+    }
+    bool ok = !ferror(f);
+    fclose(f);
+    return ok;
+}
+
+// 2·|X(w)|/N em double, com o mesmo DC que a análise subtrai. w sai do coeficiente Q14 da banda
+// (a frequência que o Goertzel realmente mede), então a diferença é só o arredondamento inteiro
+static double amplitude_dft(const uint16_t *x, int n, double dc, int32_t coef) {
+    double re = 0, im = 0, w = acos(coef / (2.0 * (1 << AUDIO_COEF_Q)));
+    for (int i = 0; i < n; i++) {
+        re += (x[i] - dc) * cos(w * i);
+        im -= (x[i] - dc) * sin(w * i);
+    }
+    return 2 * sqrt(re * re + im * im) / n;
+}
+
+int main(void) {
+    static uint16_t janela[JANELA];
+    audio_analisador_t a;
+    audio_quadro_t q;
+    audio_wav_t w;
+
+    VERIFICA(gerar_wav(ARQUIVO), "não gravou " ARQUIVO);
+    VERIFICA(audio_wav_abrir(&w, ARQUIVO), "não abriu " ARQUIVO);
+    VERIFICA(w.taxa_hz == TAXA_HZ && w.canais == 2 && w.restantes == N_TRECHOS * JANELAS_POR_TRECHO * JANELA,
+             "WAV com %u Hz, %u canais, %u quadros", w.taxa_hz, w.canais, w.restantes);
+
+    audio_init(&a, TAXA_HZ, freqs, N_BANDAS, JANELA);
+    double erro_max = 0;
+    int janelas = 0;
+    for (int t = 0; t < N_TRECHOS; t++) {
+        for (int j = 0; j < JANELAS_POR_TRECHO; j++, janelas++) {
+            uint32_t lidas = audio_wav_ler_adc(&w, janela, JANELA);
+            VERIFICA(lidas == JANELA, "janela %d com %u amostras", janelas, lidas);
+            int32_t dc = a.dc;
+            audio_analisar(&a, janela, &q);
+
+            // Cada banda contra a DFT em double
+            for (int b = 0; b < N_BANDAS; b++) {
+                double ref = amplitude_dft(janela, JANELA, dc, a.coef[b]);
+                double erro = fabs(q.banda[b] - ref);
+                erro_max = erro > erro_max ? erro : erro_max;
+                VERIFICA(erro <= 1.5, "trecho %d, janela %d, banda %d Hz: %u, double %.1f", t, j,
+                         freqs[b], q.banda[b], ref);
+            }
+            if (j == 0) {
+                continue;       // a primeira janela do trecho usa o DC do trecho anterior
+            }
+
+            if (t < N_BANDAS) {
+                VERIFICA(abs(q.banda[t] - AMPLITUDE_ADC) <= AMPLITUDE_ADC / 50, "tom de %u Hz lido como %u",
+                         freqs[t], q.banda[t]);
+                for (int b = 0; b < N_BANDAS; b++) {
+                    VERIFICA(b == t || q.banda[b] < AMPLITUDE_ADC / 10, "tom de %u Hz vaza %u na banda de %u Hz",
+                             freqs[t], q.banda[b], freqs[b]);
+                }
+                // Sem um número inteiro de ciclos na janela, a média e o RMS oscilam um pouco
+                VERIFICA(abs(q.dc - 2048) <= AMPLITUDE_ADC / 50, "tom de %u Hz: DC %u", freqs[t], q.dc);
+                VERIFICA(abs(q.rms - (int)lround(AMPLITUDE_ADC / sqrt(2))) <= AMPLITUDE_ADC / 100,
+                         "tom de %u Hz: RMS %u", freqs[t], q.rms);
+                VERIFICA(q.pico >= AMPLITUDE_ADC - 1 && q.pico <= AMPLITUDE_ADC + AMPLITUDE_ADC / 50,
+                         "tom de %u Hz: pico %u", freqs[t], q.pico);
+            }
+            else if (t == N_BANDAS) {
+                bool zerado = q.rms == 0 && q.pico == 0;
+                for (int b = 0; b < N_BANDAS; b++) {
+                    zerado &= q.banda[b] == 0;
+                }
+                VERIFICA(zerado && q.dc == 2048, "silêncio com RMS %u, pico %u, DC %u", q.rms, q.pico, q.dc);
+            }
+            else {
+                // Ruído uniforme de ±8192 PCM (±512 contagens): RMS 512/√3, espalhado pelas bandas
+                VERIFICA(abs(q.rms - 296) <= 15, "ruído com RMS %u", q.rms);
+                for (int b = 0; b < N_BANDAS; b++) {
+                    VERIFICA(q.banda[b] < 100, "ruído com %u na banda de %u Hz", q.banda[b], freqs[b]);
+                }
+            }
+        }
+    }
+    VERIFICA(audio_wav_ler_adc(&w, janela, JANELA) == 0, "sobraram amostras no WAV");
+    audio_wav_fechar(&w);
+
+    // Vazão do caminho completo: WAV → janelas → análise
+    const int voltas = 40;
+    volatile uint32_t soma = 0;
+    double t0 = teste_agora();
+    for (int v = 0; v < voltas; v++) {
+        audio_wav_abrir(&w, ARQUIVO);
+        while (audio_wav_ler_adc(&w, janela, JANELA) == JANELA) {
+            audio_analisar(&a, janela, &q);
+            soma += q.banda[v % N_BANDAS];
+        }
+        audio_wav_fechar(&w);
+    }
+    double com_leitura = voltas * janelas / (teste_agora() - t0);
+
+    // Só a análise, sobre a última janela lida
+    const int repeticoes = 200000;
+    t0 = teste_agora();
+    for (int r = 0; r < repeticoes; r++) {
+        janela[r % JANELA] ^= 1;
+        audio_analisar(&a, janela, &q);
+        soma += q.banda[r % N_BANDAS];
+    }
+    double so_analise = repeticoes / (teste_agora() - t0);
+    double tempo_real = (double)TAXA_HZ / JANELA;
+
+    printf("%d janelas de %d amostras, %d bandas: erro máximo %.2f contagens contra a DFT em double\n", janelas,
+           JANELA, N_BANDAS, erro_max);
+    printf("WAV + análise: %.0f janelas/s; só análise: %.0f janelas/s (%.0fx o tempo real de %.2f janelas/s)\n",
+           com_leitura, so_analise, so_analise / tempo_real, tempo_real);
+    return TESTE_FIM();
+}
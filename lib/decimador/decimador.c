@@ -0,0 +1,179 @@
+/**
+ * @file decimador.c
+ * @brief Implementação do decimador CIC + FIR e das tabelas de compensação.
+ */
+
+#include <string.h>
+#include "decimador.h"
+
+// Coeficientes simétricos em Q15 (somam 32768: ganho 1 em DC). Janela de Kaiser (beta 5) sobre a
+// resposta 1/|H_cic| na banda, com transição em cosseno até a rejeição.
+const int16_t decimador_fir_n2_d4[DECIMADOR_FIR_N2_D4_TAPS] = {
+    -4, -38, -118, -227, -279, -117, 426, 1433, 2807, 4252, 5361, 5776, 5361, 4252, 2807, 1433, 426,
+    -117, -279, -227, -118, -38, -4,
+};
+
+const int16_t decimador_fir_n3_d2[DECIMADOR_FIR_N3_D2_TAPS] = {
+    1, 1, -3, 38, 162, 103, -575, -1415, -515, 3588, 9121, 11756, 9121, 3588, -515, -1415, -575,
+    103, 162, 38, -3, 1, 1,
+};
+
+// ordem de 1 a DECIMADOR_ORDEM_MAX; R = 2^log2_r, com 12 + ordem·log2_r ≤ 32 bits; fir_q15 com
+// n_taps coeficientes (NULL e 0 para só o CIC, e aí fator_fir é 1). Retorna false se a
+// combinação não couber.
+bool decimador_init(decimador_t *d, uint8_t ordem, uint8_t log2_r, const int16_t *fir_q15, uint8_t n_taps,
+                    uint8_t fator_fir) {
+    if (ordem == 0 || ordem > DECIMADOR_ORDEM_MAX || log2_r == 0 ||
+        DECIMADOR_BITS_ENTRADA + ordem * log2_r > 32 || n_taps > DECIMADOR_TAPS_MAX) {
+        return false;
+    }
+    if (fir_q15 == NULL || n_taps == 0) {
+        fir_q15 = NULL;
+        n_taps = 0;
+        fator_fir = 1;
+    }
+    if (fator_fir == 0) {
+        return false;
+    }
+
+    d->ordem = ordem;
+    d->log2_r = log2_r;
+    d->deslocamento = (int8_t)(ordem * log2_r - DECIMADOR_FRAC);
+    d->fir = fir_q15;
+    d->n_taps = n_taps;
+    d->fator_fir = fator_fir;
+    decimador_reiniciar(d);
+    return true;
+}
+
+// Esquece o fluxo anterior: a próxima amostra recarrega o estado
+void decimador_reiniciar(decimador_t *d) {
+    memset(d->integrador, 0, sizeof(d->integrador));
+    memset(d->atraso, 0, sizeof(d->atraso));
+    memset(d->historico, 0, sizeof(d->historico));
+    d->fase = 0;
+    d->fase_fir = 0;
+    d->pos = 0;
+    d->iniciado = false;
+}
+
+// Pentes sobre a saída do último integrador e normalização do ganho R^N para Q4
+static int32_t pentes(decimador_t *d, uint32_t c) {
+    for (uint8_t k = 0; k < d->ordem; k++) {
+        uint32_t t = c - d->atraso[k];
+        d->atraso[k] = c;
+        c = t;
+    }
+
+    int8_t desl = d->deslocamento;
+    if (desl > 0) {
+        return (int32_t)((c >> desl) + ((c >> (desl - 1)) & 1u));
+    }
+    return (int32_t)(c << -desl);
+}
+
+// Põe uma saída do CIC no histórico do FIR; devolve true (e o valor em *y) quando é a vez de
+// uma saída do FIR
+static bool fir(decimador_t *d, int32_t v, int32_t *y) {
+    if (d->n_taps == 0) {
+        *y = v;
+        return true;
+    }
+
+    uint8_t n = d->n_taps;
+    d->historico[d->pos] = v;
+    d->historico[d->pos + n] = v;
+    d->pos = (uint8_t)(d->pos + 1 == n ? 0 : d->pos + 1);
+
+    if (++d->fase_fir < d->fator_fir) {
+        return false;
+    }
+    d->fase_fir = 0;
+
+    // historico[pos .. pos + n - 1] é a janela inteira, da mais antiga à mais nova. Cada produto
+    // cabe em 32 bits (|coef| < 2^15, 0 ≤ v < 2^16); só a soma precisa de 64.
+    const int32_t *janela = &d->historico[d->pos];
+    const int16_t *h = d->fir;
+    int64_t acc = 0;
+    for (uint8_t k = 0; k < n; k++) {
+        acc += (int32_t)(h[k] * janela[k]);
+    }
+    *y = (int32_t)((acc + (1 << 14)) >> 15);
+    return true;
+}
+
+// Carrega o estado como se a entrada estivesse parada em x: ordem·R amostras constantes
+// assentam os pentes, e o histórico do FIR recebe a saída correspondente
+static void carregar(decimador_t *d, uint32_t x) {
+    uint32_t r = 1u << d->log2_r;
+    int32_t v = 0;
+
+    for (uint8_t s = 0; s < d->ordem; s++) {
+        for (uint32_t i = 0; i < r; i++) {
+            uint32_t acc = x;
+            for (uint8_t k = 0; k < d->ordem; k++) {
+                d->integrador[k] += acc;
+                acc = d->integrador[k];
+            }
+        }
+        v = pentes(d, d->integrador[d->ordem - 1]);
+    }
+    for (uint8_t k = 0; k < 2 * d->n_taps; k++) {
+        d->historico[k] = v;
+    }
+    d->iniciado = true;
+}
+
+// Decima n amostras de entrada (entrada[0], entrada[passo], ...) e escreve as saídas prontas
+// em saida, em contagens Q4. Devolve quantas saídas foram escritas: no máximo
+// n / decimador_fator() + 1.
+uint32_t decimador_processar(decimador_t *d, const uint16_t *entrada, uint32_t n, uint32_t passo, int32_t *saida) {
+    if (n == 0) {
+        return 0;
+    }
+    if (!d->iniciado) {
+        carregar(d, *entrada);
+    }
+
+    const uint32_t r = 1u << d->log2_r;
+    const uint8_t ultimo = (uint8_t)(d->ordem - 1);
+    uint32_t fase = d->fase;
+    uint32_t geradas = 0;
+
+    // Os quatro integradores andam sempre (quatro somas, sem desvio por ordem); o pente lê o
+    // da ordem configurada
+    uint32_t i0 = d->integrador[0], i1 = d->integrador[1], i2 = d->integrador[2], i3 = d->integrador[3];
+
+    while (n) {
+        uint32_t trecho = r - fase;
+        if (trecho > n) {
+            trecho = n;
+        }
+        n -= trecho;
+        fase += trecho;
+
+        for (uint32_t i = 0; i < trecho; i++) {
+            i0 += *entrada;
+            i1 += i0;
+            i2 += i1;
+            i3 += i2;
+            entrada += passo;
+        }
+
+        if (fase == r) {
+            fase = 0;
+            uint32_t topo = ultimo == 0 ? i0 : ultimo == 1 ? i1 : ultimo == 2 ? i2 : i3;
+            int32_t y;
+            if (fir(d, pentes(d, topo), &y)) {
+                saida[geradas++] = y;
+            }
+        }
+    }
+
+    d->integrador[0] = i0;
+    d->integrador[1] = i1;
+    d->integrador[2] = i2;
+    d->integrador[3] = i3;
+    d->fase = (uint16_t)fase;
+    return geradas;
+}
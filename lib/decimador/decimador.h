@@ -0,0 +1,73 @@
+/**
+ * @file decimador.h
+ * @brief Decimação de fluxos do ADC: filtro CIC (integradores e pentes) seguido de um FIR curto
+ * em Q15 que compensa a queda do CIC na banda e decima mais um pouco.
+ *
+ * Tirar a média de um bloco é um CIC de ordem 1: a resposta cai devagar (sinc) e deixa passar,
+ * rebatido para perto de zero, quase tudo que está acima da nova taxa. Aqui:
+ * - O CIC de ordem N (1 a 4) decima por R = 2^k só com somas: N integradores por amostra de
+ *   entrada e N pentes por saída, em 32 bits sem sinal. O estouro dos integradores se cancela nos
+ *   pentes (aritmética modular), desde que 12 + N·k ≤ 32 bits; o ganho R^N vira um deslocamento.
+ * - O FIR roda só na taxa de saída do CIC, e só calcula as saídas que ficam (decimação
+ *   polifásica): n_taps multiplicações a cada fator_fir saídas do CIC.
+ * - As saídas são contagens do ADC em Q4 (DECIMADOR_FRAC): a decimação ganha resolução além dos
+ *   12 bits.
+ *
+ * Na primeira amostra depois de iniciar (ou reiniciar) o estado é carregado como se a entrada
+ * estivesse parada nela desde sempre: as primeiras saídas já valem a leitura, sem a rampa de
+ * zero até o valor que o filtro teria.
+ *
+ * A entrada pode ter passo (`passo` > 1), para decimar um canal direto na vista intercalada
+ * da lib/adc_varredura, sem cópia. O estado fica no decimador: blocos seguidos de qualquer
+ * tamanho formam um fluxo contínuo.
+ *
+ * `decimador_fir_n2_d4` e `decimador_fir_n3_d2` são compensações prontas para CIC de ordem 2
+ * (com FIR decimando por 4) e de ordem 3 (FIR decimando por 2), calculadas para R ≥ 4.
+ */
+
+#ifndef DECIMADOR_H
+#define DECIMADOR_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define DECIMADOR_ORDEM_MAX 4
+#define DECIMADOR_TAPS_MAX 32
+#define DECIMADOR_FRAC 4                // saídas em contagens Q4
+#define DECIMADOR_BITS_ENTRADA 12
+
+// Compensação para CIC de ordem 2 + FIR /4: banda até 0,05 da taxa do CIC, -71 dB a partir de 0,2
+#define DECIMADOR_FIR_N2_D4_TAPS 23
+extern const int16_t decimador_fir_n2_d4[DECIMADOR_FIR_N2_D4_TAPS];
+
+// Compensação para CIC de ordem 3 + FIR /2: ±0,1 dB até 0,05 da taxa do CIC, -89 dB a partir de 0,4
+#define DECIMADOR_FIR_N3_D2_TAPS 23
+extern const int16_t decimador_fir_n3_d2[DECIMADOR_FIR_N3_D2_TAPS];
+
+typedef struct {
+    uint8_t ordem;
+    uint8_t log2_r;
+    int8_t deslocamento;        // normaliza o ganho R^N para Q4 (negativo: desloca para a esquerda)
+    bool iniciado;              // estado já carregado com a primeira amostra
+    uint8_t n_taps;             // 0: só o CIC
+    uint8_t fator_fir;
+    uint8_t fase_fir;           // saídas do CIC desde a última saída do FIR
+    uint8_t pos;                // onde entra a próxima saída do CIC no histórico
+    uint16_t fase;              // amostras de entrada desde a última saída do CIC
+    uint32_t integrador[DECIMADOR_ORDEM_MAX];
+    uint32_t atraso[DECIMADOR_ORDEM_MAX];  // entrada anterior de cada pente
+    const int16_t *fir;
+    int32_t historico[2 * DECIMADOR_TAPS_MAX];  // cada valor escrito duas vezes: janela contígua
+} decimador_t;
+
+bool decimador_init(decimador_t *d, uint8_t ordem, uint8_t log2_r, const int16_t *fir_q15, uint8_t n_taps,
+                    uint8_t fator_fir);
+void decimador_reiniciar(decimador_t *d);
+uint32_t decimador_processar(decimador_t *d, const uint16_t *entrada, uint32_t n, uint32_t passo, int32_t *saida);
+
+// Fator total de decimação (entradas por saída)
+static inline uint32_t decimador_fator(const decimador_t *d) {
+    return ((uint32_t)1 << d->log2_r) * d->fator_fir;
+}
+
+#endif
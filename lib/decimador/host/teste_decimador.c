@@ -0,0 +1,276 @@
+/**
+ * @file teste_decimador.c
+ * @brief Ganho DC e resposta em frequência do CIC + FIR contra a teoria, e vazão.
+ *
+ * As tabelas de compensação somam 32768 (ganho 1 em DC) e são simétricas; entrada constante sai
+ * exatamente em valor·16 (Q4) desde a primeira saída e depois de um degrau, em todas as ordens
+ * do CIC e nas três configurações dos projetos. Para a resposta em frequência, um tom passa pelo
+ * decimador e a amplitude da saída (na frequência rebatida, com um número inteiro de períodos na
+ * janela medida) tem de bater com |H_cic|·|H_fir| calculado em double; as tabelas cumprem a banda
+ * e a rejeição prometidas no cabeçalho, e a partir de 0,8 da taxa de saída o decimador rejeita o
+ * que a média de bloco do mesmo fator deixava rebater. Também confere que blocos picados e
+ * entrada com passo dão a mesma saída, e mede a vazão de cada configuração contra a média de
+ * bloco.
+ */
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include "teste.h"
+#include "decimador.h"
+
+#define PI 3.14159265358979323846
+#define AMPLITUDE 1500.0
+#define JANELA_MEDIDA 1000      // saídas medidas, depois do transitório
+#define TRANSITORIO 64
+#define MAX_ENTRADAS ((TRANSITORIO + JANELA_MEDIDA) * 1024)
+
+typedef struct {
+    const char *nome;
+    uint8_t ordem, log2_r;
+    const int16_t *fir;
+    uint8_t n_taps, fator_fir;
+} config_t;
+
+// TempCycleDMA (tarefa1_temp.c), dma_adc_temperature e isr_timer_microphone
+static const config_t configs[] = {
+    { "CIC2 R256 + FIR/4", 2, 8, decimador_fir_n2_d4, DECIMADOR_FIR_N2_D4_TAPS, 4 },
+    { "CIC2 R128 + FIR/4", 2, 7, decimador_fir_n2_d4, DECIMADOR_FIR_N2_D4_TAPS, 4 },
+    { "CIC3 R4 + FIR/2", 3, 2, decimador_fir_n3_d2, DECIMADOR_FIR_N3_D2_TAPS, 2 },
+};
+#define N_CONFIGS (int)(sizeof(configs) / sizeof(configs[0]))
+
+static uint16_t entrada[MAX_ENTRADAS];
+static int32_t saida[MAX_ENTRADAS];
+
+static bool iniciar(decimador_t *d, const config_t *c) {
+    return decimador_init(d, c->ordem, c->log2_r, c->fir, c->n_taps, c->fator_fir);
+}
+
+// |H| do CIC de ordem n e fator r, f em ciclos por amostra de entrada
+static double h_cic(double f, int n, int r) {
+    double s = sin(PI * f);
+    return fabs(s) < 1e-12 ? 1.0 : pow(fabs(sin(PI * f * r) / (r * s)), n);
+}
+
+// |H| do FIR em Q15, f em ciclos por saída do CIC
+static double h_fir(const int16_t *h, int n, double f) {
+    double c = (n - 1) / 2.0, s = 0;
+    for (int k = 0; k < n; k++) {
+        s += h[k] * cos(2 * PI * f * (k - c));
+    }
+    return fabs(s) / 32768;
+}
+
+static double db(double a) {
+    return 20 * log10(a + 1e-9);
+}
+
+// Amplitude relativa da saída para um tom de f_rel vezes a taxa de saída: f_rel·JANELA_MEDIDA
+// inteiro, então a janela tem um número inteiro de períodos do tom rebatido
+static double medir_tom(const config_t *c, double f_rel) {
+    decimador_t d;
+    iniciar(&d, c);
+    uint32_t fator = decimador_fator(&d);
+    uint32_t n = (TRANSITORIO + JANELA_MEDIDA) * fator;
+    double f = f_rel / fator;
+    for (uint32_t i = 0; i < n; i++) {
+        entrada[i] = (uint16_t)lround(2048 + AMPLITUDE * sin(2 * PI * f * i));
+    }
+    uint32_t geradas = decimador_processar(&d, entrada, n, 1, saida);
+
+    double rebatida = f_rel - floor(f_rel), re = 0, im = 0, media = 0;
+    const int32_t *y = saida + geradas - JANELA_MEDIDA;
+    for (int k = 0; k < JANELA_MEDIDA; k++) {
+        media += y[k];
+    }
+    media /= JANELA_MEDIDA;
+    for (int k = 0; k < JANELA_MEDIDA; k++) {
+        re += (y[k] - media) * cos(2 * PI * rebatida * k);
+        im -= (y[k] - media) * sin(2 * PI * rebatida * k);
+    }
+    return 2 * sqrt(re * re + im * im) / JANELA_MEDIDA / (1 << DECIMADOR_FRAC) / AMPLITUDE;
+}
+
+static uint32_t semente = 3;
+
+static uint16_t aleatorio_adc(void) {
+    semente = semente * 1103515245u + 12345u;
+    return (uint16_t)((semente >> 12) & 0xFFF);
+}
+
+int main(void) {
+    decimador_t d, e;
+
+    // Tabelas: ganho 1 em DC e simetria (fase linear)
+    const struct {
+        const char *nome;
+        const int16_t *h;
+        int n;
+    } tabelas[] = {
+        { "decimador_fir_n2_d4", decimador_fir_n2_d4, DECIMADOR_FIR_N2_D4_TAPS },
+        { "decimador_fir_n3_d2", decimador_fir_n3_d2, DECIMADOR_FIR_N3_D2_TAPS },
+    };
+    for (int t = 0; t < 2; t++) {
+        int32_t soma = 0;
+        bool simetrica = true;
+        for (int k = 0; k < tabelas[t].n; k++) {
+            soma += tabelas[t].h[k];
+            simetrica &= tabelas[t].h[k] == tabelas[t].h[tabelas[t].n - 1 - k];
+        }
+        VERIFICA(soma == 32768, "%s soma %d, não 32768", tabelas[t].nome, soma);
+        VERIFICA(simetrica, "%s não é simétrica", tabelas[t].nome);
+    }
+
+    // Ganho DC exato: constante sai em valor·16 desde a primeira saída depois de reiniciar, e
+    // depois de um degrau, passado o atraso do filtro. Nas configurações dos projetos e em todas as ordens do
+    // CIC (com R no limite de 32 bits a partir da ordem 2)
+    config_t dc[N_CONFIGS + DECIMADOR_ORDEM_MAX];
+    for (int c = 0; c < N_CONFIGS; c++) {
+        dc[c] = configs[c];
+    }
+    for (int o = 1; o <= DECIMADOR_ORDEM_MAX; o++) {
+        uint8_t log2_r = (uint8_t)((32 - DECIMADOR_BITS_ENTRADA) / o);
+        log2_r = log2_r > 10 ? 10 : log2_r;
+        dc[N_CONFIGS + o - 1] = (config_t){ "só CIC", (uint8_t)o, log2_r, NULL, 0, 1 };
+    }
+    static const uint16_t niveis[] = { 1234, 0, 4095, 3001, 1, 2048 };
+    for (int c = 0; c < N_CONFIGS + DECIMADOR_ORDEM_MAX; c++) {
+        VERIFICA(iniciar(&d, &dc[c]), "%s ordem %u R 2^%u recusado", dc[c].nome, dc[c].ordem, dc[c].log2_r);
+        uint32_t fator = decimador_fator(&d);
+        uint32_t n = 64 * fator < MAX_ENTRADAS ? 64 * fator : MAX_ENTRADAS;
+        int errados = 0;
+        for (unsigned v = 0; v < sizeof(niveis) / sizeof(niveis[0]); v++) {
+            for (uint32_t i = 0; i < n; i++) {
+                entrada[i] = niveis[v];
+            }
+            bool reiniciado = v % 3 == 0;
+            if (reiniciado) {
+                decimador_reiniciar(&d);
+            }
+            uint32_t geradas = decimador_processar(&d, entrada, n, 1, saida);
+            // Depois de um degrau, o CIC leva ordem saídas e o FIR mais n_taps para assentar
+            uint32_t assenta = (uint32_t)(dc[c].ordem + dc[c].n_taps + dc[c].fator_fir - 1) / dc[c].fator_fir + 1;
+            if (reiniciado) {
+                assenta = 0;
+            }
+            for (uint32_t k = assenta; k < geradas; k++) {
+                errados += saida[k] != (int32_t)niveis[v] << DECIMADOR_FRAC;
+            }
+            errados += geradas < assenta + 4;
+        }
+        VERIFICA(errados == 0, "%s ordem %u R 2^%u: %d saídas fora de valor·16 com entrada constante", dc[c].nome,
+                 dc[c].ordem, dc[c].log2_r, errados);
+    }
+
+    // Tabelas com o CIC da ordem delas contra o cabeçalho, para R de 4 a 256 (f em ciclos por saída
+    // do CIC): n2_d4 rejeita 71 dB de 0,2 a 0,5; n3_d2 fica em ±0,1 dB até 0,05 e rejeita 89 dB de
+    // 0,4 a 0,5
+    double pior_rej_n2 = -400, pior_rej_n3 = -400, pior_banda_n3 = 0;
+    for (int r = 4; r <= 256; r *= 4) {
+        for (int k = 0; k <= 5000; k++) {
+            double f = 0.5 * k / 5000;
+            double g2 = h_cic(f / r, 2, r) * h_fir(decimador_fir_n2_d4, DECIMADOR_FIR_N2_D4_TAPS, f);
+            double g3 = h_cic(f / r, 3, r) * h_fir(decimador_fir_n3_d2, DECIMADOR_FIR_N3_D2_TAPS, f);
+            if (f >= 0.2) {
+                pior_rej_n2 = fmax(pior_rej_n2, db(g2));
+            }
+            if (f >= 0.4) {
+                pior_rej_n3 = fmax(pior_rej_n3, db(g3));
+            }
+            if (f <= 0.05) {
+                pior_banda_n3 = fmax(pior_banda_n3, fabs(db(g3)));
+            }
+        }
+    }
+    VERIFICA(pior_rej_n2 <= -71, "CIC2 + decimador_fir_n2_d4 só rejeita %.1f dB acima de 0,2", -pior_rej_n2);
+    VERIFICA(pior_rej_n3 <= -89, "CIC3 + decimador_fir_n3_d2 só rejeita %.1f dB acima de 0,4", -pior_rej_n3);
+    VERIFICA(pior_banda_n3 <= 0.1, "CIC3 + decimador_fir_n3_d2 desvia %.3f dB na banda", pior_banda_n3);
+
+    // Resposta medida contra a teoria; frequências em múltiplos da taxa de saída, as acima de
+    // 0,5 rebatem para a banda
+    static const double freqs[] = { 0.05, 0.1, 0.2, 0.3, 0.4, 0.45, 0.8, 1.2, 1.7, 2.3, 3.7 };
+    const int n_freqs = (int)(sizeof(freqs) / sizeof(freqs[0]));
+    for (int c = 0; c < N_CONFIGS; c++) {
+        printf("%s (saída a 1/%u da entrada):\n", configs[c].nome, (1u << configs[c].log2_r) * configs[c].fator_fir);
+        int r = 1 << configs[c].log2_r;
+        int fator = r * configs[c].fator_fir;
+        for (int k = 0; k < n_freqs; k++) {
+            double f = freqs[k] / fator;
+            double medida = medir_tom(&configs[c], freqs[k]);
+            double teoria = h_cic(f, configs[c].ordem, r) * h_fir(configs[c].fir, configs[c].n_taps, f * r);
+            double media_bloco = h_cic(f, 1, fator);
+
+            // 0,6% (0,05 dB) da teoria, mais o piso do arredondamento (uns -90 dB da amplitude)
+            VERIFICA(fabs(medida - teoria) <= 3e-5 + 0.006 * teoria, "%s, %.2f da saída: %.2f dB, teoria %.2f dB",
+                     configs[c].nome, freqs[k], db(medida), db(teoria));
+            if (freqs[k] >= 0.8) {
+                VERIFICA(medida < media_bloco / 10, "%s, %.2f da saída: %.1f dB, média de bloco %.1f dB",
+                         configs[c].nome, freqs[k], db(medida), db(media_bloco));
+            }
+            printf("  %.2f da saída: %7.2f dB (teoria %7.2f dB, média de bloco %6.2f dB)\n", freqs[k], db(medida),
+                   db(teoria), db(media_bloco));
+        }
+    }
+
+    // Blocos picados e entrada com passo: mesma saída que um bloco só
+    static int32_t saida2[MAX_ENTRADAS];
+    static uint16_t intercalada[3 * 20000];
+    const uint32_t n = 20000;
+    for (uint32_t i = 0; i < n; i++) {
+        entrada[i] = aleatorio_adc();
+        intercalada[3 * i] = 0;
+        intercalada[3 * i + 1] = entrada[i];
+        intercalada[3 * i + 2] = 4095;
+    }
+    for (int c = 0; c < N_CONFIGS; c++) {
+        iniciar(&d, &configs[c]);
+        iniciar(&e, &configs[c]);
+        uint32_t inteiro = decimador_processar(&d, entrada, n, 1, saida), picado = 0;
+        for (uint32_t i = 0; i < n;) {
+            uint32_t k = 1 + aleatorio_adc() % 700;
+            k = i + k > n ? n - i : k;
+            picado += decimador_processar(&e, entrada + i, k, 1, saida2 + picado);
+            i += k;
+        }
+        int diferentes = inteiro != picado;
+        for (uint32_t k = 0; k < inteiro && k < picado; k++) {
+            diferentes += saida[k] != saida2[k];
+        }
+        iniciar(&e, &configs[c]);
+        uint32_t com_passo = decimador_processar(&e, intercalada + 1, n, 3, saida2);
+        diferentes += com_passo != inteiro;
+        for (uint32_t k = 0; k < inteiro && k < com_passo; k++) {
+            diferentes += saida[k] != saida2[k];
+        }
+        VERIFICA(diferentes == 0, "%s: blocos picados ou com passo diferem em %d saídas", configs[c].nome,
+                 diferentes);
+    }
+
+    // Vazão, contra a média de bloco do mesmo fator
+    const uint32_t bloco = MAX_ENTRADAS;
+    const int voltas = 20;
+    volatile int32_t afundar = 0;
+    for (uint32_t i = 0; i < bloco; i++) {
+        entrada[i] = aleatorio_adc();
+    }
+    for (int c = 0; c < N_CONFIGS; c++) {
+        iniciar(&d, &configs[c]);
+        double t0 = teste_agora();
+        for (int v = 0; v < voltas; v++) {
+            afundar += (int32_t)decimador_processar(&d, entrada, bloco, 1, saida);
+        }
+        printf("%s: %.0f M amostras/s\n", configs[c].nome, voltas * (double)bloco / (teste_agora() - t0) / 1e6);
+    }
+    double t0 = teste_agora();
+    for (int v = 0; v < voltas; v++) {
+        uint32_t soma = 0;
+        entrada[v] ^= 1;
+        for (uint32_t i = 0; i < bloco; i++) {
+            soma += entrada[i];
+        }
+        afundar += (int32_t)soma;
+    }
+    printf("média de bloco: %.0f M amostras/s\n", voltas * (double)bloco / (teste_agora() - t0) / 1e6);
+    return TESTE_FIM();
+}
@@ -0,0 +1,264 @@
+/**
+ * @file estatistica.c
+ * @brief Implementação das estatísticas incrementais e do detector de tendência.
+ */
+
+#include "estatistica.h"
+
+// ---------------------------------------------------------------------------------------------
+// Produtos de até 128 bits, só para comparar os dois lados do teste da inclinação (o M0+ não
+// tem tipo de 128 bits)
+
+typedef struct {
+    uint64_t alto;
+    uint64_t baixo;
+} u128_t;
+
+static u128_t mul_64x64(uint64_t a, uint64_t b) {
+    uint64_t a0 = (uint32_t)a, a1 = a >> 32;
+    uint64_t b0 = (uint32_t)b, b1 = b >> 32;
+    uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+    uint64_t meio = (p00 >> 32) + (uint32_t)p01 + (uint32_t)p10;
+
+    u128_t r = {
+        .alto = p11 + (p01 >> 32) + (p10 >> 32) + (meio >> 32),
+        .baixo = (meio << 32) | (uint32_t)p00,
+    };
+    return r;
+}
+
+// a·b, com a·b abaixo de 2^128
+static u128_t mul_128x32(u128_t a, uint32_t b) {
+    u128_t baixo = mul_64x64(a.baixo, b);
+    baixo.alto += a.alto * b;
+    return baixo;
+}
+
+static bool maior_128(u128_t a, u128_t b) {
+    return a.alto != b.alto ? a.alto > b.alto : a.baixo > b.baixo;
+}
+
+// ---------------------------------------------------------------------------------------------
+// Média móvel exponencial
+
+void est_ewma_init(est_ewma_t *e, uint8_t shift) {
+    e->valor = 0;
+    e->shift = shift;
+    e->iniciado = false;
+}
+
+// Acrescenta x e devolve a média em Q8. A primeira amostra vira a média inteira.
+int32_t est_ewma_atualizar(est_ewma_t *e, int32_t x) {
+    int32_t xq = x * (1 << EST_FRAC);
+
+    if (!e->iniciado) {
+        e->valor = xq;
+        e->iniciado = true;
+    }
+    else {
+        e->valor += (xq - e->valor) >> e->shift;
+    }
+    return e->valor;
+}
+
+// ---------------------------------------------------------------------------------------------
+// Média e variância de Welford
+
+void est_welford_zerar(est_welford_t *w) {
+    w->n = 0;
+    w->media = 0;
+    w->m2 = 0;
+}
+
+void est_welford_atualizar(est_welford_t *w, int32_t x) {
+    int32_t xq = x * (1 << EST_FRAC);
+    // Em 64 bits: com |x| perto de EST_VALOR_MAX, x e a média de sinais opostos ficam, em Q8, a
+    // quase 2^31 um do outro, e o arredondamento abaixo ainda soma n / 2
+    int64_t delta = (int64_t)xq - w->media;
+
+    // delta / n arredondado: truncar puxaria a média sempre para o lado da amostra anterior
+    w->n++;
+    int64_t n = w->n;
+    w->media += (int32_t)((delta + (delta < 0 ? -(n / 2) : n / 2)) / n);
+    w->m2 += (delta * ((int64_t)xq - w->media)) >> EST_FRAC;
+}
+
+// Variância amostral (divisor n - 1) em Q8; 0 com menos de duas amostras
+int64_t est_welford_variancia(const est_welford_t *w) {
+    return w->n > 1 ? w->m2 / (int64_t)(w->n - 1) : 0;
+}
+
+// ---------------------------------------------------------------------------------------------
+// Mínimo e máximo em janela (deques monotônicos)
+
+#define DEQUE_MASCARA (EST_JANELA_MAX - 1)
+
+static inline est_par_t *deque_fim(est_deque_t *d) {
+    return &d->item[(d->inicio + d->n - 1) & DEQUE_MASCARA];
+}
+
+static inline void deque_empurrar(est_deque_t *d, int32_t valor, uint32_t tempo) {
+    est_par_t *p = &d->item[(d->inicio + d->n) & DEQUE_MASCARA];
+    p->valor = valor;
+    p->tempo = tempo;
+    d->n++;
+}
+
+// Tira da frente o que saiu da janela (no máximo um item por amostra)
+static inline void deque_expirar(est_deque_t *d, uint32_t agora, uint16_t janela) {
+    if (d->n && agora - d->item[d->inicio].tempo >= janela) {
+        d->inicio = (uint8_t)((d->inicio + 1) & DEQUE_MASCARA);
+        d->n--;
+    }
+}
+
+void est_minmax_init(est_minmax_t *m, uint16_t janela) {
+    if (janela == 0) {
+        janela = 1;
+    }
+    if (janela > EST_JANELA_MAX) {
+        janela = EST_JANELA_MAX;
+    }
+    m->janela = janela;
+    m->tempo = 0;
+    m->min.inicio = m->min.n = 0;
+    m->max.inicio = m->max.n = 0;
+    m->min.item[0].valor = 0;
+    m->max.item[0].valor = 0;
+}
+
+// Acrescenta x à janela das últimas m->janela amostras. Cada deque guarda só os candidatos:
+// quem é pior que a amostra nova e mais antigo que ela nunca mais será o mínimo (ou o máximo).
+void est_minmax_atualizar(est_minmax_t *m, int32_t x) {
+    uint32_t agora = m->tempo++;
+
+    deque_expirar(&m->min, agora, m->janela);
+    while (m->min.n && deque_fim(&m->min)->valor >= x) {
+        m->min.n--;
+    }
+    deque_empurrar(&m->min, x, agora);
+
+    deque_expirar(&m->max, agora, m->janela);
+    while (m->max.n && deque_fim(&m->max)->valor <= x) {
+        m->max.n--;
+    }
+    deque_empurrar(&m->max, x, agora);
+}
+
+// ---------------------------------------------------------------------------------------------
+// Reta de mínimos quadrados em janela, com x = 0 (mais antiga) ... n - 1 (mais recente)
+
+void est_reta_init(est_reta_t *r, uint16_t janela) {
+    if (janela < 3) {
+        janela = 3;
+    }
+    if (janela > EST_JANELA_MAX) {
+        janela = EST_JANELA_MAX;
+    }
+    r->janela = janela;
+    r->pos = 0;
+    r->n = 0;
+    r->soma = 0;
+    r->soma_ky = 0;
+    r->soma_quad = 0;
+}
+
+// Com a janela cheia, cada amostra desce um índice: Σk·y perde Σy, ganha de volta a que saiu
+// (que tinha k = 0) e recebe a nova com k = janela - 1
+void est_reta_atualizar(est_reta_t *r, int32_t y) {
+    if (r->n < r->janela) {
+        r->soma_ky += (int64_t)r->n * y;
+        r->n++;
+    }
+    else {
+        int32_t antiga = r->y[r->pos];
+        r->soma_ky += antiga - r->soma + (int64_t)(r->janela - 1) * y;
+        r->soma -= antiga;
+        r->soma_quad -= (int64_t)antiga * antiga;
+    }
+    r->soma += y;
+    r->soma_quad += (int64_t)y * y;
+    r->y[r->pos] = y;
+    r->pos = (uint8_t)(r->pos + 1 == r->janela ? 0 : r->pos + 1);
+}
+
+// n·Sxy centrado: n·Σk·y - Σk·Σy
+static int64_t n_sxy(const est_reta_t *r) {
+    int64_t n = r->n;
+    return n * r->soma_ky - (n * (n - 1) / 2) * r->soma;
+}
+
+// n(n² - 1) = 12·Sxx centrado
+static int64_t kx(const est_reta_t *r) {
+    int64_t n = r->n;
+    return n * (n * n - 1);
+}
+
+// Inclinação da reta, em Q8 por amostra; 0 com menos de duas amostras
+int32_t est_reta_inclinacao(const est_reta_t *r) {
+    if (r->n < 2) {
+        return 0;
+    }
+    return (int32_t)((12 * n_sxy(r) * (1 << EST_FRAC)) / (r->n * kx(r)));
+}
+
+// Sinal da inclinação (+1 ou -1) se ela for diferente de zero com confiança, isto é, se
+// |t| = |b| / erro padrão de b passar de t_q4 / 16; senão 0.
+//
+// Com Sxy, Sxx e Syy centrados, t² = (n - 2)·Sxy² / (Sxx·Syy - Sxy²). Passando tudo para inteiros
+// (N = n·Sxy, Kx = 12·Sxx, Syy' = n·Syy = n·Σy² - (Σy)²) e multiplicando por 256 para o Q4 do
+// limiar, t² > k² vira 12·N²·(256(n - 2) + kq²) > kq²·Syy'·Kx·n, comparado em 128 bits.
+int8_t est_reta_sinal_confiavel(const est_reta_t *r, uint8_t t_q4) {
+    if (r->n < 3) {
+        return 0;
+    }
+
+    int64_t n = r->n;
+    int64_t nsxy = n_sxy(r);
+    uint64_t syy = (uint64_t)(n * r->soma_quad - r->soma * r->soma);
+    uint64_t kq2 = (uint64_t)t_q4 * t_q4;
+
+    if (nsxy == 0) {
+        return 0;
+    }
+
+    uint64_t abs_nsxy = (uint64_t)(nsxy < 0 ? -nsxy : nsxy);
+    u128_t esquerda = mul_128x32(mul_64x64(abs_nsxy, abs_nsxy), (uint32_t)(12 * (256 * (n - 2) + kq2)));
+    u128_t direita = mul_64x64(syy, kq2 * (uint64_t)kx(r) * (uint64_t)n);
+
+    if (!maior_128(esquerda, direita)) {
+        return 0;
+    }
+    return nsxy > 0 ? 1 : -1;
+}
+
+// ---------------------------------------------------------------------------------------------
+// Detector de tendência
+
+// janela: amostras da reta; t_entrada_q4/t_saida_q4: limiares de |t| (EST_T_Q4) para entrar e
+// sair de SUBINDO/CAINDO (saída ≤ entrada dá a histerese); inclinacao_min: |inclinação| mínima,
+// em Q8 por amostra, para uma variação confiável mas desprezível não contar como tendência
+void est_tendencia_init(est_tendencia_t *t, uint16_t janela, uint8_t t_entrada_q4, uint8_t t_saida_q4,
+                        int32_t inclinacao_min) {
+    est_reta_init(&t->reta, janela);
+    t->estado = 0;
+    t->t_entrada_q4 = t_entrada_q4;
+    t->t_saida_q4 = t_saida_q4 < t_entrada_q4 ? t_saida_q4 : t_entrada_q4;
+    t->inclinacao_min = inclinacao_min;
+}
+
+// Acrescenta y e devolve o estado: -1 caindo, 0 estável, +1 subindo
+int8_t est_tendencia_atualizar(est_tendencia_t *t, int32_t y) {
+    est_reta_atualizar(&t->reta, y);
+
+    int32_t b = est_reta_inclinacao(&t->reta);
+    bool relevante = (b < 0 ? -b : b) >= t->inclinacao_min;
+
+    if (t->estado != 0 && (!relevante || est_reta_sinal_confiavel(&t->reta, t->t_saida_q4) != t->estado)) {
+        t->estado = 0;
+    }
+    if (t->estado == 0 && relevante) {
+        t->estado = est_reta_sinal_confiavel(&t->reta, t->t_entrada_q4);
+    }
+    return t->estado;
+}
@@ -0,0 +1,116 @@
+/**
+ * @file estatistica.h
+ * @brief Estatísticas incrementais em inteiros, com memória fixa e atualização O(1): média móvel
+ * exponencial, média/variância de Welford, mínimo e máximo em janela, reta de mínimos quadrados
+ * em janela e um detector de tendência pela confiança da inclinação.
+ *
+ * - As amostras são inteiros (por exemplo, temperatura em m°C) com |x| < EST_VALOR_MAX; médias,
+ *   variâncias e inclinações saem em Q8 (EST_FRAC bits fracionários). Nenhuma atualização usa
+ *   ponto flutuante: no RP2040 (sem FPU) cada operação em float é emulada.
+ * - EWMA: s += (x - s) / 2^k, só soma e deslocamento.
+ * - Welford: média e soma dos quadrados dos desvios acumuladas sem a subtração catastrófica de
+ *   Σx² - (Σx)²/n; uma divisão por amostra, em 64 bits, porque o desvio x - média em Q8 pode
+ *   passar de 2^31 perto de EST_VALOR_MAX.
+ *   Cada passo arredonda a média para o Q8, então ela anda alguns LSB longe da exata em
+ *   sequências longas.
+ * - Mínimo/máximo em janela: deques monotônicos; cada amostra entra e sai uma vez de cada um.
+ * - Reta: Σy, Σk·y e Σy² da janela são atualizados ao deslizar, sem refazer as somas.
+ * - Tendência: a inclinação só conta se |t| (inclinação / erro padrão) passar de um limiar, com
+ *   histerese entre entrar e sair de SUBINDO/CAINDO; ruído sem direção não muda o estado.
+ */
+
+#ifndef ESTATISTICA_H
+#define ESTATISTICA_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define EST_FRAC 8                      // resultados em Q8
+#define EST_VALOR_MAX (1 << 22)         // |x| abaixo disto mantém todas as contas em 64 bits
+#define EST_JANELA_MAX 64               // potência de 2
+
+// Converte um limiar de |t| para o Q4 usado pelo detector (3,0 → 48)
+#define EST_T_Q4(v) ((uint8_t)((v) * 16 + 0.5))
+
+typedef struct {
+    int32_t valor;          // Q8
+    uint8_t shift;          // alfa = 1 / 2^shift
+    bool iniciado;
+} est_ewma_t;
+
+typedef struct {
+    uint32_t n;
+    int32_t media;          // Q8
+    int64_t m2;             // Σ(x - média)², Q8 (cabe enquanto a soma sem o Q8 for < 2^55)
+} est_welford_t;
+
+typedef struct {
+    int32_t valor;
+    uint32_t tempo;
+} est_par_t;
+
+// Deque circular de pares (valor, instante)
+typedef struct {
+    est_par_t item[EST_JANELA_MAX];
+    uint8_t inicio;
+    uint8_t n;
+} est_deque_t;
+
+typedef struct {
+    est_deque_t min;        // valores crescentes: o da frente é o mínimo
+    est_deque_t max;        // valores decrescentes: o da frente é o máximo
+    uint32_t tempo;
+    uint16_t janela;
+} est_minmax_t;
+
+typedef struct {
+    int32_t y[EST_JANELA_MAX];  // buffer circular da janela
+    uint8_t pos;                // onde entra a próxima amostra
+    uint16_t n;
+    uint16_t janela;
+    int64_t soma;               // Σy
+    int64_t soma_ky;            // Σk·y, k = 0 para a mais antiga
+    int64_t soma_quad;          // Σy²
+} est_reta_t;
+
+typedef struct {
+    est_reta_t reta;
+    int8_t estado;              // -1 caindo, 0 estável, +1 subindo
+    uint8_t t_entrada_q4;       // |t| para sair do estável
+    uint8_t t_saida_q4;         // |t| abaixo do qual volta ao estável
+    int32_t inclinacao_min;     // |inclinação| mínima (Q8, por amostra) para subir/cair
+} est_tendencia_t;
+
+void est_ewma_init(est_ewma_t *e, uint8_t shift);
+int32_t est_ewma_atualizar(est_ewma_t *e, int32_t x);
+
+void est_welford_zerar(est_welford_t *w);
+void est_welford_atualizar(est_welford_t *w, int32_t x);
+int64_t est_welford_variancia(const est_welford_t *w);
+
+void est_minmax_init(est_minmax_t *m, uint16_t janela);
+void est_minmax_atualizar(est_minmax_t *m, int32_t x);
+
+void est_reta_init(est_reta_t *r, uint16_t janela);
+void est_reta_atualizar(est_reta_t *r, int32_t y);
+int32_t est_reta_inclinacao(const est_reta_t *r);
+int8_t est_reta_sinal_confiavel(const est_reta_t *r, uint8_t t_q4);
+
+void est_tendencia_init(est_tendencia_t *t, uint16_t janela, uint8_t t_entrada_q4, uint8_t t_saida_q4,
+                        int32_t inclinacao_min);
+int8_t est_tendencia_atualizar(est_tendencia_t *t, int32_t y);
+
+// Média de Welford em Q8
+static inline int32_t est_welford_media(const est_welford_t *w) {
+    return w->media;
+}
+
+static inline int32_t est_minmax_min(const est_minmax_t *m) {
+    return m->min.item[m->min.inicio].valor;
+}
+
+static inline int32_t est_minmax_max(const est_minmax_t *m) {
+    return m->max.item[m->max.inicio].valor;
+}
+
+#endif
@@ -0,0 +1,323 @@
+/**
+ * @file teste_tendencia.c
+ * @brief Detector de tendência sobre um traço de temperatura: estados contra o mesmo detector
+ * em double, casos de histerese e comparação com o limiar fixo de ±0,01 °C antigo.
+ *
+ * O traço imita as médias da Tarefa 1 (m°C, uma a cada 2 s) com ruído de medida: estável,
+ * subida, patamar, descida, patamar e uma subida fraca cuja confiança fica entre os limiares de
+ * entrada e saída. Em cada ciclo o estado tem de bater com a reta e o |t| calculados em double
+ * sobre a mesma janela; no estável o detector não pode trocar de estado (o limiar antigo troca a
+ * cada poucas médias), nas rampas tem de entrar em poucos ciclos e ficar, nos patamares tem de
+ * voltar ao estável, e na subida fraca a histerese tem de segurar o estado onde um detector com
+ * saída = entrada pisca. Mínimo/máximo em janela e Welford são conferidos no mesmo traço, e
+ * Welford também nos extremos de EST_VALOR_MAX.
+ *
+ * O traço e os estados vão para teste_tendencia.csv. Com um arquivo de argumento (uma média em
+ * m°C por linha, como gravada da serial), só roda o detector sobre ele e lista as trocas.
+ */
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include "teste.h"
+#include "estatistica.h"
+
+// Mesmos parâmetros da Tarefa 3 do TempCycleDMA
+#define JANELA 16
+#define T_ENTRADA EST_T_Q4(4.0)
+#define T_SAIDA EST_T_Q4(3.0)
+#define INCLINACAO_MIN (2 << EST_FRAC)
+
+#define CAPTURA "teste_tendencia.csv"
+
+typedef struct {
+    const char *nome;
+    int ciclos;
+    double inclinacao;      // m°C por ciclo
+    double ruido;           // desvio do ruído de medida, m°C
+} trecho_t;
+
+enum { ESTAVEL, SUBIDA, PATAMAR, DESCIDA, PATAMAR2, FRACA, N_TRECHOS };
+
+static const trecho_t trechos[N_TRECHOS] = {
+    [ESTAVEL] = { "estável", 120, 0, 8 },
+    [SUBIDA] = { "subida", 60, 15, 8 },
+    [PATAMAR] = { "patamar", 60, 0, 8 },
+    [DESCIDA] = { "descida", 60, -10, 8 },
+    [PATAMAR2] = { "patamar", 60, 0, 8 },
+    [FRACA] = { "subida fraca", 200, 2.8, 12 },
+};
+
+#define MAX_CICLOS 600
+
+static uint32_t semente = 17;
+
+// Aproximadamente normal, desvio 1 (soma de 12 uniformes)
+static double gauss(void) {
+    double s = 0;
+    for (int i = 0; i < 12; i++) {
+        semente = semente * 1103515245u + 12345u;
+        s += (semente >> 8) / (double)(1 << 24);
+    }
+    return s - 6;
+}
+
+// Estado do detector refeito em double, com as mesmas regras e a mesma janela
+typedef struct {
+    int8_t estado;
+    double t;               // |t| da última janela (INFINITY se os pontos caem na reta)
+} referencia_t;
+
+static int8_t sinal_double(const int32_t *y, int n, double limiar, double *t_abs) {
+    double my = 0, sxy = 0, syy = 0, sxx = 0, mx = (n - 1) / 2.0;
+    for (int k = 0; k < n; k++) {
+        my += y[k];
+    }
+    my /= n;
+    for (int k = 0; k < n; k++) {
+        sxx += (k - mx) * (k - mx);
+        sxy += (k - mx) * (y[k] - my);
+        syy += (y[k] - my) * (y[k] - my);
+    }
+    double resid = syy - sxy * sxy / sxx;
+    *t_abs = resid > 0 ? fabs(sxy / sxx) / sqrt(resid / (n - 2) / sxx) : INFINITY;
+    if (n < 3 || sxy == 0 || !(*t_abs > limiar)) {
+        return 0;
+    }
+    return sxy > 0 ? 1 : -1;
+}
+
+static void referencia(referencia_t *r, const int32_t *traco, int ciclo, double entrada, double saida) {
+    int n = ciclo + 1 < JANELA ? ciclo + 1 : JANELA;
+    const int32_t *y = traco + ciclo + 1 - n;
+
+    double t_abs, b = 0;
+    if (n >= 2) {
+        double mx = (n - 1) / 2.0, sxy = 0, sxx = 0;
+        for (int k = 0; k < n; k++) {
+            sxx += (k - mx) * (k - mx);
+            sxy += (k - mx) * y[k];
+        }
+        b = sxy / sxx;
+    }
+    bool relevante = fabs(b) * (1 << EST_FRAC) >= INCLINACAO_MIN;
+
+    if (r->estado != 0 && (!relevante || sinal_double(y, n, saida, &t_abs) != r->estado)) {
+        r->estado = 0;
+    }
+    if (r->estado == 0 && relevante) {
+        r->estado = sinal_double(y, n, entrada, &t_abs);
+    }
+    sinal_double(y, n, 0, &r->t);
+}
+
+// Só o detector sobre um traço gravado: uma média em m°C por linha
+static int rodar_arquivo(const char *caminho) {
+    FILE *f = fopen(caminho, "r");
+    if (!f) {
+        printf("não abriu %s\n", caminho);
+        return 1;
+    }
+    est_tendencia_t d;
+    est_tendencia_init(&d, JANELA, T_ENTRADA, T_SAIDA, INCLINACAO_MIN);
+    long mc;
+    int ciclo = 0, trocas = 0;
+    int8_t anterior = 0;
+    while (fscanf(f, "%ld", &mc) == 1) {
+        int8_t estado = est_tendencia_atualizar(&d, (int32_t)mc);
+        if (estado != anterior) {
+            printf("ciclo %d (%ld m°C): %d -> %d\n", ciclo, mc, anterior, estado);
+            anterior = estado;
+            trocas++;
+        }
+        ciclo++;
+    }
+    fclose(f);
+    printf("%d médias, %d trocas de estado\n", ciclo, trocas);
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    if (argc > 1) {
+        return rodar_arquivo(argv[1]);
+    }
+
+    static int32_t traco[MAX_CICLOS];
+    static int trecho_de[MAX_CICLOS];
+    int ciclos = 0;
+    double temp = 27000;
+    for (int s = 0; s < N_TRECHOS; s++) {
+        for (int c = 0; c < trechos[s].ciclos; c++, ciclos++) {
+            temp += trechos[s].inclinacao;
+            traco[ciclos] = (int32_t)lround(temp + trechos[s].ruido * gauss());
+            trecho_de[ciclos] = s;
+        }
+    }
+
+    est_tendencia_t d, sem_hist;
+    est_tendencia_init(&d, JANELA, T_ENTRADA, T_SAIDA, INCLINACAO_MIN);
+    est_tendencia_init(&sem_hist, JANELA, T_ENTRADA, T_ENTRADA, INCLINACAO_MIN);
+    referencia_t ref = { 0, 0 };
+    est_minmax_t mm;
+    est_minmax_init(&mm, JANELA);
+    est_welford_t w;
+    est_welford_zerar(&w);
+
+    static int8_t estados[MAX_CICLOS];
+    int divergentes = 0, minmax_errados = 0;
+    int trocas[N_TRECHOS] = { 0 }, trocas_sem_hist[N_TRECHOS] = { 0 }, trocas_antigo[N_TRECHOS] = { 0 };
+    int entrada[N_TRECHOS], saida[N_TRECHOS], ciclos_em[N_TRECHOS][3] = { { 0 } };
+    int na_faixa = 0, seguro_na_faixa = 0;
+    int8_t anterior = 0, anterior_sem_hist = 0, antigo = 0;
+    for (int s = 0; s < N_TRECHOS; s++) {
+        entrada[s] = saida[s] = -1;
+    }
+
+    FILE *csv = fopen(CAPTURA, "w");
+    VERIFICA(csv != NULL, "não gravou " CAPTURA);
+    if (csv) {
+        fprintf(csv, "ciclo;m°C;estado;sem histerese;limiar antigo;|t|\n");
+    }
+
+    for (int c = 0; c < ciclos; c++) {
+        int s = trecho_de[c];
+        int inicio = c == 0 || trecho_de[c - 1] != s;
+        int8_t e = est_tendencia_atualizar(&d, traco[c]);
+        int8_t e2 = est_tendencia_atualizar(&sem_hist, traco[c]);
+        referencia(&ref, traco, c, T_ENTRADA / 16.0, T_SAIDA / 16.0);
+        divergentes += e != ref.estado;
+        estados[c] = e;
+
+        // Regra antiga: compara a média com a anterior contra ±10 m°C
+        if (c > 0) {
+            int32_t delta = traco[c] - traco[c - 1];
+            int8_t novo = delta > 10 ? 1 : delta < -10 ? -1 : 0;
+            trocas_antigo[s] += novo != antigo && !inicio;
+            antigo = novo;
+        }
+
+        trocas[s] += e != anterior && !inicio;
+        trocas_sem_hist[s] += e2 != anterior_sem_hist && !inicio;
+        if (e != anterior && e != 0 && entrada[s] < 0) {
+            entrada[s] = c;
+        }
+        if (e != anterior && e == 0 && saida[s] < 0) {
+            saida[s] = c;
+        }
+        ciclos_em[s][e + 1]++;
+        if (ref.t > T_SAIDA / 16.0 && ref.t <= T_ENTRADA / 16.0) {
+            na_faixa++;
+            seguro_na_faixa += anterior != 0 && e == anterior;
+        }
+        anterior = e;
+        anterior_sem_hist = e2;
+
+        // Mínimo e máximo em janela contra a busca direta
+        est_minmax_atualizar(&mm, traco[c]);
+        int32_t mn = traco[c], mx = traco[c];
+        for (int k = c; k > c - JANELA && k >= 0; k--) {
+            mn = traco[k] < mn ? traco[k] : mn;
+            mx = traco[k] > mx ? traco[k] : mx;
+        }
+        minmax_errados += est_minmax_min(&mm) != mn || est_minmax_max(&mm) != mx;
+        est_welford_atualizar(&w, traco[c]);
+
+        if (csv) {
+            fprintf(csv, "%d;%d;%d;%d;%d;%.2f\n", c, traco[c], e, e2, antigo, ref.t);
+        }
+    }
+    if (csv) {
+        fclose(csv);
+    }
+
+    VERIFICA(divergentes == 0, "%d ciclos com estado diferente do detector em double", divergentes);
+    VERIFICA(minmax_errados == 0, "%d ciclos com mínimo ou máximo da janela errado", minmax_errados);
+
+    // Welford contra média e variância em double do traço inteiro
+    double soma = 0, soma2 = 0;
+    for (int c = 0; c < ciclos; c++) {
+        soma += traco[c];
+    }
+    double media = soma / ciclos;
+    for (int c = 0; c < ciclos; c++) {
+        soma2 += (traco[c] - media) * (traco[c] - media);
+    }
+    double variancia = soma2 / (ciclos - 1);
+    double w_media = est_welford_media(&w) / 256.0, w_var = est_welford_variancia(&w) / 256.0;
+    VERIFICA(fabs(w_media - media) < 0.5 && fabs(w_var / variancia - 1) < 1e-3,
+             "Welford: média %.2f (double %.2f), variância %.1f (double %.1f)", w_media, media, w_var, variancia);
+
+    // Welford nos extremos: um bloco longo em +(EST_VALOR_MAX - 1) e um curto em -(EST_VALOR_MAX - 1).
+    // Na primeira amostra negativa o desvio em Q8 fica a 512 de 2^31, e o arredondamento ainda
+    // soma n / 2 = 550
+    const int32_t extremo = EST_VALOR_MAX - 1;
+    const int n_positivos = 1100, n_extremos = 1200;
+    est_welford_zerar(&w);
+    soma = soma2 = 0;
+    for (int i = 0; i < n_extremos; i++) {
+        int32_t x = i < n_positivos ? extremo : -extremo;
+        est_welford_atualizar(&w, x);
+        soma += x;
+    }
+    media = soma / n_extremos;
+    for (int i = 0; i < n_extremos; i++) {
+        double x = i < n_positivos ? extremo : -extremo;
+        soma2 += (x - media) * (x - media);
+    }
+    variancia = soma2 / (n_extremos - 1);
+    w_media = est_welford_media(&w) / 256.0;
+    w_var = est_welford_variancia(&w) / 256.0;
+    VERIFICA(fabs(w_media - media) < 1 && fabs(w_var / variancia - 1) < 1e-3,
+             "Welford nos extremos: média %.2f (double %.2f), variância %.4g (double %.4g)", w_media, media,
+             w_var, variancia);
+
+    // Estável e patamares: nenhuma troca no estável; nos patamares, volta ao estável e fica
+    VERIFICA(ciclos_em[ESTAVEL][1] == trechos[ESTAVEL].ciclos && trocas[ESTAVEL] == 0,
+             "estável: %d trocas, %d ciclos fora do estável", trocas[ESTAVEL],
+             trechos[ESTAVEL].ciclos - ciclos_em[ESTAVEL][1]);
+    VERIFICA(trocas_antigo[ESTAVEL] > 20, "limiar antigo trocou só %d vezes no estável", trocas_antigo[ESTAVEL]);
+
+    // Rampas: entra em até meia janela e não sai até o patamar
+    int ini_subida = trechos[ESTAVEL].ciclos;
+    int ini_descida = ini_subida + trechos[SUBIDA].ciclos + trechos[PATAMAR].ciclos;
+    VERIFICA(entrada[SUBIDA] >= 0 && entrada[SUBIDA] - ini_subida <= JANELA / 2 && trocas[SUBIDA] == 1 &&
+             estados[ini_subida + trechos[SUBIDA].ciclos - 1] == 1,
+             "subida: entrou no ciclo %d (início %d), %d trocas", entrada[SUBIDA], ini_subida, trocas[SUBIDA]);
+    VERIFICA(entrada[DESCIDA] >= 0 && entrada[DESCIDA] - ini_descida <= JANELA / 2 && trocas[DESCIDA] == 1 &&
+             estados[ini_descida + trechos[DESCIDA].ciclos - 1] == -1,
+             "descida: entrou no ciclo %d (início %d), %d trocas", entrada[DESCIDA], ini_descida, trocas[DESCIDA]);
+    for (int s = PATAMAR; s <= PATAMAR2; s += PATAMAR2 - PATAMAR) {
+        int ini = s == PATAMAR ? ini_subida + trechos[SUBIDA].ciclos : ini_descida + trechos[DESCIDA].ciclos;
+        VERIFICA(saida[s] >= 0 && saida[s] - ini <= JANELA && trocas[s] == 1 &&
+                 estados[ini + trechos[s].ciclos - 1] == 0,
+                 "patamar do ciclo %d: voltou ao estável no ciclo %d, %d trocas", ini, saida[s], trocas[s]);
+    }
+
+    // Subida fraca: |t| passa boa parte do tempo entre os limiares; a histerese segura o estado
+    VERIFICA(na_faixa > 0 && seguro_na_faixa > 0, "faixa de histerese: %d ciclos, %d com o estado seguro",
+             na_faixa, seguro_na_faixa);
+    VERIFICA(ciclos_em[FRACA][2] > trechos[FRACA].ciclos / 2 && ciclos_em[FRACA][0] == 0,
+             "subida fraca: %d ciclos subindo, %d caindo", ciclos_em[FRACA][2], ciclos_em[FRACA][0]);
+    VERIFICA(trocas[FRACA] < trocas_sem_hist[FRACA], "subida fraca: %d trocas com histerese, %d sem",
+             trocas[FRACA], trocas_sem_hist[FRACA]);
+
+    // Vazão
+    const int voltas = 2000000;
+    volatile int32_t afundar = 0;
+    est_tendencia_init(&d, JANELA, T_ENTRADA, T_SAIDA, INCLINACAO_MIN);
+    double t0 = teste_agora();
+    for (int v = 0; v < voltas; v++) {
+        afundar += est_tendencia_atualizar(&d, traco[v % ciclos]);
+    }
+    double vazao = voltas / (teste_agora() - t0);
+
+    printf("%d ciclos, janela %d, |t| %.1f/%.1f:\n", ciclos, JANELA, T_ENTRADA / 16.0, T_SAIDA / 16.0);
+    for (int s = 0; s < N_TRECHOS; s++) {
+        printf("  %-13s %4d ciclos: trocas %2d (sem histerese %2d, limiar antigo %2d); caindo/estável/subindo "
+               "%d/%d/%d\n", trechos[s].nome, trechos[s].ciclos, trocas[s], trocas_sem_hist[s], trocas_antigo[s],
+               ciclos_em[s][0], ciclos_em[s][1], ciclos_em[s][2]);
+    }
+    printf("faixa de histerese: %d ciclos, %d com o estado seguro\n", na_faixa, seguro_na_faixa);
+    printf("%.1f M atualizações/s\n", vazao / 1e6);
+    return TESTE_FIM();
+}
@@ -0,0 +1,22 @@
+/**
+ * @file i2c.h
+ * @brief Subconjunto de "hardware/i2c.h" para o build host.
+ *
+ * Só declara o tipo da instância e `i2c0`/`i2c1`, como no SDK; o barramento em si é o
+ * emulador (`ssd1306_emulador.c`), que ignora a instância e decodifica os bytes enviados.
+ */
+
+#ifndef PICO_HOST_HARDWARE_I2C_H
+#define PICO_HOST_HARDWARE_I2C_H
+
+#include <stdint.h>
+
+typedef struct i2c_inst i2c_inst_t;
+
+extern i2c_inst_t i2c0_inst;
+extern i2c_inst_t i2c1_inst;
+
+#define i2c0 (&i2c0_inst)
+#define i2c1 (&i2c1_inst)
+
+#endif
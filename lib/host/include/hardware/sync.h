@@ -0,0 +1,22 @@
+/**
+ * @file sync.h
+ * @brief "hardware/sync.h" no build host: um único fluxo de execução, sem interrupções reais.
+ *
+ * As "interrupções" dos backends simulados (fim de quadro do emulador SSD1306) só rodam dentro
+ * das chamadas do próprio driver, então desabilitar interrupções não precisa fazer nada.
+ */
+
+#ifndef PICO_HOST_HARDWARE_SYNC_H
+#define PICO_HOST_HARDWARE_SYNC_H
+
+#include <stdint.h>
+
+static inline uint32_t save_and_disable_interrupts(void) {
+    return 0;
+}
+
+static inline void restore_interrupts(uint32_t status) {
+    (void)status;
+}
+
+#endif
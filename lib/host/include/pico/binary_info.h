@@ -0,0 +1,12 @@
+/**
+ * @file binary_info.h
+ * @brief Versão vazia de "pico/binary_info.h" para o build host (sem metadados no binário).
+ */
+
+#ifndef PICO_HOST_BINARY_INFO_H
+#define PICO_HOST_BINARY_INFO_H
+
+#define bi_decl(...)
+#define bi_decl_if_func_used(...)
+
+#endif
@@ -0,0 +1,29 @@
+/**
+ * @file critical_section.h
+ * @brief "pico/critical_section.h" no build host: um único fluxo de execução, sem travas reais.
+ */
+
+#ifndef PICO_HOST_CRITICAL_SECTION_H
+#define PICO_HOST_CRITICAL_SECTION_H
+
+typedef struct {
+    int nivel;
+} critical_section_t;
+
+static inline void critical_section_init(critical_section_t *crit_sec) {
+    crit_sec->nivel = 0;
+}
+
+static inline void critical_section_enter_blocking(critical_section_t *crit_sec) {
+    crit_sec->nivel++;
+}
+
+static inline void critical_section_exit(critical_section_t *crit_sec) {
+    crit_sec->nivel--;
+}
+
+static inline void critical_section_deinit(critical_section_t *crit_sec) {
+    (void)crit_sec;
+}
+
+#endif
@@ -0,0 +1,28 @@
+/**
+ * @file stdlib.h
+ * @brief Subconjunto mínimo de "pico/stdlib.h" para compilar as bibliotecas de lib/ no PC.
+ *
+ * Usado apenas nos builds host (emuladores e mocks); no Pico vale o cabeçalho do SDK.
+ */
+
+#ifndef PICO_HOST_STDLIB_H
+#define PICO_HOST_STDLIB_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <assert.h>
+#include "pico/types.h"
+#include "pico/time.h"
+
+#ifndef _u
+#define _u(x) x ## u
+#endif
+
+#ifndef count_of
+#define count_of(a) (sizeof(a) / sizeof((a)[0]))
+#endif
+
+#define tight_loop_contents() ((void)0)
+
+#endif
@@ -0,0 +1,91 @@
+/**
+ * @file time.h
+ * @brief Relógio de "pico/time.h" no build host, sobre o CLOCK_MONOTONIC do sistema.
+ *
+ * As esperas são reais (nanosleep), então tempos medidos no PC seguem o relógio de parede.
+ */
+
+#ifndef PICO_HOST_TIME_H
+#define PICO_HOST_TIME_H
+
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
+
+static inline uint64_t time_us_64(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000u + (uint64_t)ts.tv_nsec / 1000u;
+}
+
+static inline uint32_t time_us_32(void) {
+    return (uint32_t)time_us_64();
+}
+
+static inline void sleep_us(uint64_t us) {
+    struct timespec ts = { (time_t)(us / 1000000u), (long)(us % 1000000u) * 1000L };
+    nanosleep(&ts, NULL);
+}
+
+static inline void sleep_ms(uint32_t ms) {
+    sleep_us((uint64_t)ms * 1000u);
+}
+
+// Alarmes: o host não tem interrupção de timer, então add_alarm_at() só aceita o pedido e
+// nunca chama o callback; código que depende dele precisa avançar também por polling
+typedef uint64_t absolute_time_t;
+typedef int32_t alarm_id_t;
+typedef int64_t (*alarm_callback_t)(alarm_id_t id, void *user_data);
+
+static inline absolute_time_t from_us_since_boot(uint64_t us) {
+    return us;
+}
+
+static inline absolute_time_t get_absolute_time(void) {
+    return time_us_64();
+}
+
+static inline void sleep_until(absolute_time_t target) {
+    uint64_t agora = time_us_64();
+    if (target > agora) {
+        sleep_us(target - agora);
+    }
+}
+
+static inline alarm_id_t add_alarm_at(absolute_time_t time, alarm_callback_t callback, void *user_data,
+                                      bool fire_if_past) {
+    (void)time;
+    (void)callback;
+    (void)user_data;
+    (void)fire_if_past;
+    return 1;
+}
+
+// Timer repetitivo: mesma limitação dos alarmes (o callback nunca é chamado no host)
+typedef struct repeating_timer repeating_timer_t;
+typedef bool (*repeating_timer_callback_t)(repeating_timer_t *rt);
+
+struct repeating_timer {
+    int64_t delay_us;
+    repeating_timer_callback_t callback;
+    void *user_data;
+};
+
+static inline bool add_repeating_timer_us(int64_t delay_us, repeating_timer_callback_t callback, void *user_data,
+                                          repeating_timer_t *out) {
+    out->delay_us = delay_us;
+    out->callback = callback;
+    out->user_data = user_data;
+    return true;
+}
+
+static inline bool cancel_repeating_timer(repeating_timer_t *timer) {
+    timer->callback = NULL;
+    return true;
+}
+
+#endif
@@ -0,0 +1,14 @@
+/**
+ * @file types.h
+ * @brief Tipos básicos de "pico/types.h" para o build host.
+ */
+
+#ifndef PICO_HOST_TYPES_H
+#define PICO_HOST_TYPES_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef unsigned int uint;
+
+#endif
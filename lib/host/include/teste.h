@@ -0,0 +1,42 @@
+/**
+ * @file teste.h
+ * @brief Verificações e cronômetro mínimos para os testes e medições host das bibliotecas.
+ *
+ * Cada teste é um executável registrado no ctest pelo CMakeLists.txt da biblioteca (build
+ * isolado, sem o Pico SDK). `VERIFICA()` conta e descreve as falhas sem parar o teste, e
+ * `TESTE_FIM()` vira o código de saída: 0 quando tudo passou.
+ */
+
+#ifndef HOST_TESTE_H
+#define HOST_TESTE_H
+
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#include <stdio.h>
+#include <time.h>
+
+static int teste_falhas;
+
+#define VERIFICA(cond, ...)                                             \
+    do {                                                                \
+        if (!(cond)) {                                                  \
+            teste_falhas++;                                             \
+            printf("FALHOU %s:%d: ", __FILE__, __LINE__);               \
+            printf(__VA_ARGS__);                                        \
+            printf("\n");                                               \
+        }                                                               \
+    } while (0)
+
+#define TESTE_FIM() \
+    (printf(teste_falhas ? "%d falha(s)\n" : "ok\n", teste_falhas), teste_falhas ? 1 : 0)
+
+// Relógio monotônico em segundos, para as medições de vazão
+static inline double teste_agora(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+#endif
@@ -0,0 +1,46 @@
+/**
+ * @file pio.h
+ * @brief Subconjunto de "hardware/pio.h" para o build host, sobre o mock de `np_pio_mock.c`.
+ *
+ * Cada PIO tem quatro TX FIFOs; o que é escrito nelas (por `pio_sm_put_blocking()` ou pelo
+ * DMA mockado) passa pelo registrador de deslocamento da máquina de estados como no
+ * programa ws2818b e vira a sequência de bits do fio.
+ */
+
+#ifndef PICO_HOST_HARDWARE_PIO_H
+#define PICO_HOST_HARDWARE_PIO_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "pico/types.h"
+
+#define NUM_PIO_STATE_MACHINES 4
+
+typedef struct pio_hw {
+    volatile uint32_t txf[NUM_PIO_STATE_MACHINES];
+} pio_hw_t;
+
+typedef pio_hw_t *PIO;
+
+extern pio_hw_t pio0_hw_mock;
+extern pio_hw_t pio1_hw_mock;
+
+#define pio0 (&pio0_hw_mock)
+#define pio1 (&pio1_hw_mock)
+
+typedef struct {
+    const uint16_t *instructions;
+    uint8_t length;
+    int8_t origin;
+} pio_program_t;
+
+bool pio_can_add_program(PIO pio, const pio_program_t *program);
+uint pio_add_program(PIO pio, const pio_program_t *program);
+int pio_claim_unused_sm(PIO pio, bool required);
+void pio_sm_claim(PIO pio, uint sm);
+void pio_sm_unclaim(PIO pio, uint sm);
+void pio_sm_set_enabled(PIO pio, uint sm, bool enabled);
+uint pio_get_dreq(PIO pio, uint sm, bool is_tx);
+void pio_sm_put_blocking(PIO pio, uint sm, uint32_t data);
+
+#endif
@@ -0,0 +1,28 @@
+/**
+ * @file ws2818b.pio.h
+ * @brief Versão host do cabeçalho gerado pelo pioasm a partir de `ws2818b.pio`.
+ *
+ * Em vez de carregar instruções, `ws2818b_program_init()` configura o mock com o mesmo
+ * deslocamento do programa real (shift à direita, autopull de 24 bits); manter os dois iguais.
+ */
+
+#ifndef PICO_HOST_WS2818B_PIO_H
+#define PICO_HOST_WS2818B_PIO_H
+
+#include "hardware/pio.h"
+#include "np_pio_mock.h"
+
+static const pio_program_t ws2818b_program = {
+    .instructions = NULL,
+    .length = 4,
+    .origin = -1,
+};
+
+static inline void ws2818b_program_init(PIO pio, uint sm, uint offset, uint pin, float freq) {
+    (void)offset;
+    (void)freq;
+    np_pio_mock_config(pio, sm, pin, true, 24);
+    pio_sm_set_enabled(pio, sm, true);
+}
+
+#endif
@@ -0,0 +1,143 @@
+/**
+ * @file medicao_np_brilho.c
+ * @brief Tabelas de brilho/gama 8.8 contra o cálculo em float e custo por quadro dos dois caminhos.
+ *
+ * Confere as tabelas de np_brilho contra powf() e a multiplicação em float do npWriteComBrilho()
+ * antigo (diferença de no máximo 1 nível), que o dithering temporal reproduz o valor 8.8 exato na
+ * média de 256 quadros e que np_escalar() arredonda como o float. Depois mede o tempo por quadro
+ * de 25 LEDs do caminho float e do caminho por tabela. No PC há FPU, então o tempo medido não
+ * representa o RP2040, onde cada multiplicação e conversão float é uma chamada de soft-float; por
+ * isso o resultado traz também quantas dessas chamadas cada quadro fazia.
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include "teste.h"
+#include "np_brilho.h"
+
+#define LED_COUNT 25
+#define QUADROS 200000
+
+typedef struct {
+    uint8_t G, R, B;
+} led_t;
+
+static led_t leds[LED_COUNT];
+static uint32_t quadro[LED_COUNT];
+
+// npWriteComBrilho() antigo: três multiplicações float por LED
+__attribute__((noinline)) static void quadro_float(float brilho) {
+    for (int i = 0; i < LED_COUNT; i++) {
+        uint8_t r = (uint8_t)(leds[i].R * brilho);
+        uint8_t g = (uint8_t)(leds[i].G * brilho);
+        uint8_t b = (uint8_t)(leds[i].B * brilho);
+        quadro[i] = g | ((uint32_t)r << 8) | ((uint32_t)b << 16);
+    }
+}
+
+// Caminho atual: uma consulta à tabela do nível de brilho por canal
+__attribute__((noinline)) static void quadro_tabela(const np_brilho_t *b) {
+    for (int i = 0; i < LED_COUNT; i++) {
+        uint8_t r = np_brilho_aplicar(b, leds[i].R);
+        uint8_t g = np_brilho_aplicar(b, leds[i].G);
+        uint8_t bl = np_brilho_aplicar(b, leds[i].B);
+        quadro[i] = g | ((uint32_t)r << 8) | ((uint32_t)bl << 16);
+    }
+}
+
+int main(void) {
+    static np_brilho_t b;
+    static const uint16_t niveis[] = { 0, 1, 13, 26, 64, 100, 128, 200, 255, NP_BRILHO_MAX };
+
+    // Tabelas contra float, com e sem gama, em vários níveis
+    int erro_max = 0;
+    for (int gama = 0; gama < 2; gama++) {
+        np_brilho_init(&b, gama);
+        for (size_t k = 0; k < sizeof(niveis) / sizeof(niveis[0]); k++) {
+            np_brilho_set(&b, niveis[k]);
+            float brilho = niveis[k] / (float)NP_BRILHO_MAX;
+            for (int v = 0; v < 256; v++) {
+                float base = gama ? 255.0f * powf(v / 255.0f, 2.2f) : (float)v;
+                int esperado = (int)lroundf(base * brilho);
+                int erro = abs(np_brilho_aplicar(&b, (uint8_t)v) - esperado);
+                if (erro > erro_max) {
+                    erro_max = erro;
+                }
+                VERIFICA(erro <= 1, "gama %d, nível %u, valor %d: %u em vez de %d", gama, niveis[k], v,
+                         np_brilho_aplicar(&b, (uint8_t)v), esperado);
+            }
+        }
+    }
+    np_brilho_init(&b, false);
+    VERIFICA(np_brilho_aplicar(&b, 255) == 255 && np_brilho_aplicar(&b, 0) == 0, "100 %% sem gama não é identidade");
+
+    // np_escalar() e np_escala_fracao() arredondam como a conta em float
+    for (int v = 0; v < 256; v++) {
+        for (uint32_t den = 1; den <= 8; den++) {
+            for (uint32_t num = 0; num <= den; num++) {
+                uint16_t escala = np_escala_fracao(num, den);
+                int esperado = (int)lroundf(v * (float)num / (float)den);
+                VERIFICA(abs(np_escalar((uint8_t)v, escala) - esperado) <= 1, "%d x %u/%u = %u, float %d", v,
+                         num, den, np_escalar((uint8_t)v, escala), esperado);
+            }
+        }
+    }
+
+    // Dithering: em 256 quadros a soma das saídas é exatamente o valor 8.8 da tabela
+    np_brilho_init(&b, true);
+    int acesos_so_com_pontilhado = 0;
+    for (size_t k = 0; k < sizeof(niveis) / sizeof(niveis[0]); k++) {
+        np_brilho_set(&b, niveis[k]);
+        for (int v = 0; v < 256; v++) {
+            uint8_t resto = 0;
+            uint32_t soma = 0;
+            for (int q = 0; q < 256; q++) {
+                soma += np_brilho_pontilhar(&b, (uint8_t)v, &resto);
+            }
+            VERIFICA(soma == b.tabela[v], "nível %u, valor %d: soma %u em vez de %u", niveis[k], v, soma,
+                     b.tabela[v]);
+            acesos_so_com_pontilhado += np_brilho_aplicar(&b, (uint8_t)v) == 0 && soma > 0;
+        }
+    }
+    VERIFICA(acesos_so_com_pontilhado > 0, "nenhum valor baixo acende só com o dithering");
+
+    // Custo por quadro de 25 LEDs
+    uint32_t semente = 1;
+    for (int i = 0; i < LED_COUNT; i++) {
+        semente = semente * 1103515245u + 12345u;
+        leds[i] = (led_t){ (uint8_t)(semente >> 8), (uint8_t)(semente >> 16), (uint8_t)(semente >> 24) };
+    }
+    volatile float brilho = 0.37f;
+    volatile uint32_t soma_quadros = 0;     // mantém os quadros vivos com otimização
+    np_brilho_set_gama(&b, false);
+    np_brilho_set(&b, np_escala_fracao(37, 100));
+
+    double t0 = teste_agora();
+    for (int q = 0; q < QUADROS; q++) {
+        leds[q % LED_COUNT].R = (uint8_t)q;
+        quadro_float(brilho);
+        soma_quadros += quadro[q % LED_COUNT];
+    }
+    double ns_float = (teste_agora() - t0) * 1e9 / QUADROS;
+
+    t0 = teste_agora();
+    for (int q = 0; q < QUADROS; q++) {
+        leds[q % LED_COUNT].R = (uint8_t)q;
+        quadro_tabela(&b);
+        soma_quadros += quadro[q % LED_COUNT];
+    }
+    double ns_tabela = (teste_agora() - t0) * 1e9 / QUADROS;
+
+    t0 = teste_agora();
+    for (int q = 0; q < QUADROS / 100; q++) {
+        np_brilho_set(&b, (uint16_t)(q & 1 ? 94 : 95));
+    }
+    double ns_troca = (teste_agora() - t0) * 1e9 / (QUADROS / 100);
+
+    printf("erro máximo contra float: %d nível; dithering exato em 256 quadros\n", erro_max);
+    printf("quadro de %d LEDs: %.0f ns em float, %.0f ns por tabela (%.1fx); troca de nível %.0f ns\n",
+           LED_COUNT, ns_float, ns_tabela, ns_float / ns_tabela, ns_troca);
+    printf("soft-float por quadro no RP2040: %d multiplicações e %d conversões int↔float antes, nenhuma agora\n",
+           3 * LED_COUNT, 2 * 3 * LED_COUNT);
+    return TESTE_FIM();
+}
@@ -0,0 +1,223 @@
+/**
+ * @file medicao_np_cor.c
+ * @brief HSV, paletas e misturas de np_cor contra contas em float, vazão e quadros de exemplo.
+ *
+ * Confere np_hsv() contra a conversão HSV → RGB em float, as paletas (entradas exatas, interpolação
+ * e volta à primeira cor), os gradientes e as misturas de quadros (alfa global, alfa por pixel,
+ * soma com saturação e escurecimento) contra a conta direta. Depois mede conversões e quadros por
+ * segundo, e grava em medicao_np_cor.ppm uma sequência de quadros 5x5 (paleta arco-íris girando,
+ * misturada com a paleta de calor) para inspeção visual.
+ */
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include "teste.h"
+#include "np_cor.h"
+
+#define LED_COUNT 25
+#define LADO 5
+#define QUADROS_PPM 16
+#define ESCALA_PPM 8
+#define CAPTURA "medicao_np_cor.ppm"
+
+static int diferenca(np_cor_t a, np_cor_t b) {
+    int d = abs(a.R - b.R);
+    d = abs(a.G - b.G) > d ? abs(a.G - b.G) : d;
+    return abs(a.B - b.B) > d ? abs(a.B - b.B) : d;
+}
+
+// HSV → RGB em float (h em setores 0..6, s e v em 0..1), como nos efeitos antigos
+static np_cor_t hsv_float(float h, float s, float v) {
+    h = fmodf(h, 6.0f);
+    int i = (int)h;
+    float f = h - (float)i, p = v * (1 - s), q = v * (1 - s * f), t = v * (1 - s * (1 - f));
+    float r, g, b;
+
+    switch (i) {
+    case 0:  r = v; g = t; b = p; break;
+    case 1:  r = q; g = v; b = p; break;
+    case 2:  r = p; g = v; b = t; break;
+    case 3:  r = p; g = q; b = v; break;
+    case 4:  r = t; g = p; b = v; break;
+    default: r = v; g = p; b = q; break;
+    }
+    return NP_COR((uint8_t)lroundf(r * 255), (uint8_t)lroundf(g * 255), (uint8_t)lroundf(b * 255));
+}
+
+static bool quadro_ppm(FILE *f, const np_cor_t quadros[][LED_COUNT], int n) {
+    fprintf(f, "P6\n%d %d\n255\n", n * LADO * ESCALA_PPM, LADO * ESCALA_PPM);
+    for (int y = 0; y < LADO * ESCALA_PPM; y++) {
+        for (int q = 0; q < n; q++) {
+            for (int x = 0; x < LADO * ESCALA_PPM; x++) {
+                np_cor_t c = quadros[q][(y / ESCALA_PPM) * LADO + x / ESCALA_PPM];
+                fputc(c.R, f);
+                fputc(c.G, f);
+                fputc(c.B, f);
+            }
+        }
+    }
+    return !ferror(f);
+}
+
+int main(void) {
+    // HSV inteiro contra float
+    int erro_hsv = 0;
+    for (int h = 0; h < NP_MATIZ_MAX; h++) {
+        for (int s = 0; s < 256; s += 5) {
+            for (int v = 0; v < 256; v += 5) {
+                int e = diferenca(np_hsv((uint16_t)h, (uint8_t)s, (uint8_t)v),
+                                  hsv_float(h / (float)NP_MATIZ_SETOR, s / 255.0f, v / 255.0f));
+                erro_hsv = e > erro_hsv ? e : erro_hsv;
+            }
+        }
+    }
+    VERIFICA(erro_hsv <= 2, "np_hsv difere do float em %d níveis", erro_hsv);
+    VERIFICA(diferenca(np_hsv(NP_MATIZ_MAX + 100, 200, 150), np_hsv(100, 200, 150)) == 0, "matiz não é cíclico");
+    VERIFICA(diferenca(np_hsv(700, 0, 77), NP_COR(77, 77, 77)) == 0, "saturação 0 não dá cinza");
+
+    // np_mul8 exato para todos os pares
+    int erro_mul = 0;
+    for (int a = 0; a < 256; a++) {
+        for (int b = 0; b < 256; b++) {
+            erro_mul += np_mul8((uint8_t)a, (uint8_t)b) != (a * b + 127) / 255;
+        }
+    }
+    VERIFICA(erro_mul == 0, "np_mul8 errado em %d pares", erro_mul);
+
+    // Paletas: entrada exata nos múltiplos de 16, interpolação entre vizinhas, volta à primeira
+    for (int i = 0; i < NP_PALETA_CORES; i++) {
+        VERIFICA(diferenca(NP_PALETA_ARCO_IRIS.cor[i], np_hsv((uint16_t)(i * 96), 255, 255)) == 0,
+                 "arco-íris[%d] diferente de np_hsv(%d)", i, i * 96);
+        VERIFICA(diferenca(np_paleta_cor(&NP_PALETA_CALOR, (uint8_t)(i * 16)), NP_PALETA_CALOR.cor[i]) == 0,
+                 "índice %d não cai na entrada %d", i * 16, i);
+    }
+    for (int indice = 0; indice < 256; indice++) {
+        np_cor_t a = NP_PALETA_OCEANO.cor[indice >> 4];
+        np_cor_t b = NP_PALETA_OCEANO.cor[((indice >> 4) + 1) & 15];
+        float f = (indice & 15) / 16.0f;
+        np_cor_t esperado = NP_COR((uint8_t)lroundf(a.R + (b.R - a.R) * f), (uint8_t)lroundf(a.G + (b.G - a.G) * f),
+                                   (uint8_t)lroundf(a.B + (b.B - a.B) * f));
+        VERIFICA(diferenca(np_paleta_cor(&NP_PALETA_OCEANO, (uint8_t)indice), esperado) <= 1,
+                 "oceano[%d] fora da interpolação", indice);
+    }
+
+    np_paleta_t gradiente;
+    const np_cor_t pontos[] = { NP_COR(0, 0, 0), NP_COR(255, 0, 0), NP_COR(255, 255, 255) };
+    np_paleta_gradiente(&gradiente, pontos, 3);
+    VERIFICA(diferenca(gradiente.cor[0], pontos[0]) == 0 && diferenca(gradiente.cor[15], pontos[2]) == 0,
+             "gradiente não começa e termina nos pontos dados");
+    for (int i = 1; i < NP_PALETA_CORES; i++) {
+        VERIFICA(gradiente.cor[i].R >= gradiente.cor[i - 1].R && gradiente.cor[i].G >= gradiente.cor[i - 1].G,
+                 "gradiente não é monotônico na entrada %d", i);
+    }
+
+    // Misturas contra a conta direta
+    static np_cor_t a[LED_COUNT], b[LED_COUNT], c[LED_COUNT];
+    static uint8_t alfas[LED_COUNT];
+    uint32_t semente = 3;
+    for (int i = 0; i < LED_COUNT; i++) {
+        semente = semente * 1103515245u + 12345u;
+        a[i] = NP_COR((uint8_t)(semente >> 8), (uint8_t)(semente >> 16), (uint8_t)(semente >> 24));
+        b[i] = NP_COR((uint8_t)(semente >> 4), (uint8_t)(semente >> 12), (uint8_t)(semente >> 20));
+        alfas[i] = (uint8_t)(i * 255 / (LED_COUNT - 1));
+    }
+    const uint8_t *pa = (const uint8_t *)a, *pb = (const uint8_t *)b, *pc = (const uint8_t *)c;
+
+    for (uint16_t alfa = 0; alfa <= 256; alfa += 16) {
+        memcpy(c, a, sizeof(c));
+        np_misturar(c, b, LED_COUNT, alfa);
+        for (int i = 0; i < 3 * LED_COUNT; i++) {
+            float esperado = pa[i] + (pb[i] - pa[i]) * (alfa / 256.0f);
+            VERIFICA(fabsf(pc[i] - esperado) <= 1.0f, "np_misturar alfa %u, byte %d: %u, float %.1f", alfa, i,
+                     pc[i], esperado);
+        }
+    }
+    memcpy(c, a, sizeof(c));
+    np_misturar(c, b, LED_COUNT, 256);
+    VERIFICA(memcmp(c, b, sizeof(c)) == 0, "alfa 100 %% não copia a origem");
+
+    memcpy(c, a, sizeof(c));
+    np_misturar_alfas(c, b, alfas, LED_COUNT);
+    for (int i = 0; i < 3 * LED_COUNT; i++) {
+        int alfa = alfas[i / 3];
+        int esperado = (pa[i] * (255 - alfa) + pb[i] * alfa + 127) / 255;
+        VERIFICA(abs(pc[i] - esperado) <= 1, "np_misturar_alfas byte %d: %u em vez de %d", i, pc[i], esperado);
+    }
+    VERIFICA(diferenca(c[0], a[0]) == 0 && diferenca(c[LED_COUNT - 1], b[LED_COUNT - 1]) == 0,
+             "alfa 0 / 255 por pixel não preserva destino / origem");
+
+    memcpy(c, a, sizeof(c));
+    np_somar(c, b, LED_COUNT);
+    for (int i = 0; i < 3 * LED_COUNT; i++) {
+        int s = pa[i] + pb[i];
+        VERIFICA(pc[i] == (s > 255 ? 255 : s), "np_somar byte %d: %u em vez de %d", i, pc[i], s);
+    }
+
+    memcpy(c, a, sizeof(c));
+    np_escurecer(c, LED_COUNT, 128);
+    for (int i = 0; i < 3 * LED_COUNT; i++) {
+        VERIFICA(pc[i] == (pa[i] * 128 + 128) >> 8, "np_escurecer byte %d: %u", i, pc[i]);
+    }
+
+    // Vazão
+    volatile uint32_t soma = 0;
+    uint32_t n = 0;
+    double t0 = teste_agora();
+    for (int rep = 0; rep < 400; rep++) {
+        for (uint16_t h = 0; h < NP_MATIZ_MAX; h++, n++) {
+            np_cor_t cor = np_hsv(h, (uint8_t)(200 + rep), (uint8_t)(255 - rep));
+            soma += cor.R + cor.G + cor.B;
+        }
+    }
+    double hsv_int = n / (teste_agora() - t0);
+
+    t0 = teste_agora();
+    for (int rep = 0; rep < 400; rep++) {
+        for (uint16_t h = 0; h < NP_MATIZ_MAX; h++) {
+            np_cor_t cor = hsv_float(h / 256.0f, (uint8_t)(200 + rep) / 255.0f, (uint8_t)(255 - rep) / 255.0f);
+            soma += cor.R + cor.G + cor.B;
+        }
+    }
+    double hsv_flt = n / (teste_agora() - t0);
+
+    const int quadros = 1000000;
+    t0 = teste_agora();
+    for (int q = 0; q < quadros; q++) {
+        np_misturar(c, b, LED_COUNT, (uint16_t)(q & 255));
+        b[q % LED_COUNT].R ^= 1;
+    }
+    double misturar = quadros / (teste_agora() - t0);
+
+    t0 = teste_agora();
+    for (int q = 0; q < quadros; q++) {
+        for (int i = 0; i < LED_COUNT; i++) {
+            c[i] = np_paleta_cor(&NP_PALETA_ARCO_IRIS, (uint8_t)(q + i * 10));
+        }
+        soma += c[q % LED_COUNT].G;
+    }
+    double paleta = quadros / (teste_agora() - t0);
+
+    // Quadros para inspeção: arco-íris girando, misturado a 50 % com a paleta de calor
+    static np_cor_t sequencia[QUADROS_PPM][LED_COUNT];
+    for (int q = 0; q < QUADROS_PPM; q++) {
+        for (int i = 0; i < LED_COUNT; i++) {
+            sequencia[q][i] = np_paleta_cor(&NP_PALETA_ARCO_IRIS, (uint8_t)(q * 16 + i * 10));
+            c[i] = np_paleta_cor(&NP_PALETA_CALOR, (uint8_t)(q * 8 + (i / LADO) * 40));
+        }
+        np_misturar(sequencia[q], c, LED_COUNT, 128);
+    }
+    FILE *f = fopen(CAPTURA, "wb");
+    VERIFICA(f && quadro_ppm(f, sequencia, QUADROS_PPM), "não gravou " CAPTURA);
+    if (f) {
+        fclose(f);
+    }
+
+    printf("np_hsv: erro máximo %d nível contra float\n", erro_hsv);
+    printf("np_hsv: %.1f M conversões/s; float: %.1f M conversões/s\n", hsv_int / 1e6, hsv_flt / 1e6);
+    printf("quadro de %d LEDs: np_misturar %.1f M/s, paleta %.1f M/s\n", LED_COUNT, misturar / 1e6,
+           paleta / 1e6);
+    printf("%d quadros em " CAPTURA "\n", QUADROS_PPM);
+    return TESTE_FIM();
+}
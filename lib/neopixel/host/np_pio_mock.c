@@ -0,0 +1,274 @@
+/**
+ * @file np_pio_mock.c
+ * @brief Mock de PIO (TX FIFO + OSR do ws2818b) e de DMA para rodar `neopixel_tx.c` no PC.
+ */
+
+#include <assert.h>
+#include <string.h>
+#include "hardware/pio.h"
+#include "hardware/dma.h"
+#include "np_pio_mock.h"
+
+pio_hw_t pio0_hw_mock;
+pio_hw_t pio1_hw_mock;
+
+typedef struct {
+    bool reservada;
+    bool habilitada;
+    uint pino;
+    bool shift_right;
+    uint autopull_bits;
+    uint n_bits;
+    uint8_t bits[NP_PIO_MOCK_MAX_BITS];     // bits na ordem em que saem no fio
+} maquina_mock_t;
+
+static maquina_mock_t maquinas[2][NUM_PIO_STATE_MACHINES];
+static uint instrucoes_usadas[2];
+
+typedef struct {
+    bool reservado;
+    dma_channel_config cfg;
+    volatile void *escrita;
+    const volatile void *leitura;
+    uint32_t contagem;
+} canal_mock_t;
+
+static canal_mock_t canais[NUM_DMA_CHANNELS];
+
+// Campos de dma_channel_config.ctrl usados pelo mock
+#define CTRL_TAMANHO_MASK 0x3u
+#define CTRL_INCR_LEITURA (1u << 4)
+#define CTRL_INCR_ESCRITA (1u << 5)
+
+static inline uint indice_pio(PIO pio) {
+    return pio == pio0 ? 0 : 1;
+}
+
+static inline maquina_mock_t *maquina(PIO pio, uint sm) {
+    return &maquinas[indice_pio(pio)][sm & (NUM_PIO_STATE_MACHINES - 1)];
+}
+
+// ---------------------------------------------------------------- PIO
+
+bool pio_can_add_program(PIO pio, const pio_program_t *program) {
+    return instrucoes_usadas[indice_pio(pio)] + program->length <= 32;
+}
+
+uint pio_add_program(PIO pio, const pio_program_t *program) {
+    uint offset = instrucoes_usadas[indice_pio(pio)];
+    instrucoes_usadas[indice_pio(pio)] += program->length;
+    return offset;
+}
+
+int pio_claim_unused_sm(PIO pio, bool required) {
+    for (uint sm = 0; sm < NUM_PIO_STATE_MACHINES; sm++) {
+        if (!maquina(pio, sm)->reservada) {
+            maquina(pio, sm)->reservada = true;
+            return (int)sm;
+        }
+    }
+    assert(!required);
+    return -1;
+}
+
+void pio_sm_claim(PIO pio, uint sm) {
+    maquina(pio, sm)->reservada = true;
+}
+
+void pio_sm_unclaim(PIO pio, uint sm) {
+    maquina(pio, sm)->reservada = false;
+}
+
+void pio_sm_set_enabled(PIO pio, uint sm, bool enabled) {
+    maquina(pio, sm)->habilitada = enabled;
+}
+
+uint pio_get_dreq(PIO pio, uint sm, bool is_tx) {
+    return indice_pio(pio) * 8 + (is_tx ? 0 : 4) + sm;
+}
+
+void pio_sm_put_blocking(PIO pio, uint sm, uint32_t data) {
+    np_pio_mock_push(pio, sm, data);
+}
+
+// ---------------------------------------------------------------- máquina ws2818b
+
+void np_pio_mock_config(PIO pio, uint sm, uint pin, bool shift_right, uint autopull_bits) {
+    maquina_mock_t *m = maquina(pio, sm);
+    m->pino = pin;
+    m->shift_right = shift_right;
+    m->autopull_bits = autopull_bits ? autopull_bits : 32;
+    m->n_bits = 0;
+}
+
+// Autopull: a palavra inteira vai para o OSR e os primeiros autopull_bits saem, um por vez
+void np_pio_mock_push(PIO pio, uint sm, uint32_t palavra) {
+    maquina_mock_t *m = maquina(pio, sm);
+
+    for (uint i = 0; i < m->autopull_bits && m->n_bits < NP_PIO_MOCK_MAX_BITS; i++) {
+        uint bit = m->shift_right ? i : 31 - i;
+        m->bits[m->n_bits++] = (uint8_t)((palavra >> bit) & 1u);
+    }
+}
+
+void np_pio_mock_clear(PIO pio, uint sm) {
+    maquina(pio, sm)->n_bits = 0;
+}
+
+uint np_pio_mock_bits(PIO pio, uint sm) {
+    return maquina(pio, sm)->n_bits;
+}
+
+uint np_pio_mock_pin(PIO pio, uint sm) {
+    return maquina(pio, sm)->pino;
+}
+
+// Agrupa os bits do fio em LEDs de 24 bits, com o primeiro bit recebido no bit 23
+uint np_pio_mock_leds(PIO pio, uint sm, uint32_t *recebido, uint max) {
+    const maquina_mock_t *m = maquina(pio, sm);
+    uint n = m->n_bits / 24;
+    if (n > max) {
+        n = max;
+    }
+
+    for (uint led = 0; led < n; led++) {
+        uint32_t valor = 0;
+        for (uint b = 0; b < 24; b++) {
+            valor = (valor << 1) | m->bits[led * 24 + b];
+        }
+        recebido[led] = valor;
+    }
+    return n;
+}
+
+// ---------------------------------------------------------------- DMA
+
+int dma_claim_unused_channel(bool required) {
+    for (uint c = 0; c < NUM_DMA_CHANNELS; c++) {
+        if (!canais[c].reservado) {
+            canais[c].reservado = true;
+            return (int)c;
+        }
+    }
+    assert(!required);
+    return -1;
+}
+
+void dma_channel_unclaim(uint channel) {
+    canais[channel].reservado = false;
+}
+
+dma_channel_config dma_channel_get_default_config(uint channel) {
+    (void)channel;
+    dma_channel_config c = { .ctrl = DMA_SIZE_32 | CTRL_INCR_LEITURA };
+    return c;
+}
+
+void channel_config_set_transfer_data_size(dma_channel_config *c, enum dma_channel_transfer_size size) {
+    c->ctrl = (c->ctrl & ~CTRL_TAMANHO_MASK) | (uint32_t)size;
+}
+
+void channel_config_set_read_increment(dma_channel_config *c, bool incr) {
+    c->ctrl = incr ? (c->ctrl | CTRL_INCR_LEITURA) : (c->ctrl & ~CTRL_INCR_LEITURA);
+}
+
+void channel_config_set_write_increment(dma_channel_config *c, bool incr) {
+    c->ctrl = incr ? (c->ctrl | CTRL_INCR_ESCRITA) : (c->ctrl & ~CTRL_INCR_ESCRITA);
+}
+
+void channel_config_set_dreq(dma_channel_config *c, uint dreq) {
+    (void)c;
+    (void)dreq;
+}
+
+// Localiza o TX FIFO correspondente ao endereço de escrita, se for um
+static bool endereco_fifo(volatile void *endereco, PIO *pio, uint *sm) {
+    PIO pios[2] = { pio0, pio1 };
+    for (int i = 0; i < 2; i++) {
+        for (uint s = 0; s < NUM_PIO_STATE_MACHINES; s++) {
+            if (endereco == (volatile void *)&pios[i]->txf[s]) {
+                *pio = pios[i];
+                *sm = s;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+static void executar(canal_mock_t *canal) {
+    uint tamanho = 1u << (canal->cfg.ctrl & CTRL_TAMANHO_MASK);
+    const volatile uint8_t *origem = canal->leitura;
+    volatile uint8_t *destino = canal->escrita;
+    PIO pio;
+    uint sm;
+    bool fifo = endereco_fifo(canal->escrita, &pio, &sm);
+
+    for (uint32_t i = 0; i < canal->contagem; i++) {
+        uint32_t valor = 0;
+        memcpy(&valor, (const void *)origem, tamanho);
+
+        if (fifo) {
+            np_pio_mock_push(pio, sm, valor);
+        }
+        else {
+            memcpy((void *)destino, &valor, tamanho);
+        }
+
+        if (canal->cfg.ctrl & CTRL_INCR_LEITURA) origem += tamanho;
+        if (canal->cfg.ctrl & CTRL_INCR_ESCRITA) destino += tamanho;
+    }
+}
+
+void dma_channel_configure(uint channel, const dma_channel_config *config, volatile void *write_addr,
+                           const volatile void *read_addr, uint transfer_count, bool trigger) {
+    canal_mock_t *canal = &canais[channel];
+    canal->cfg = *config;
+    canal->escrita = write_addr;
+    canal->leitura = read_addr;
+    canal->contagem = transfer_count;
+    if (trigger) {
+        executar(canal);
+    }
+}
+
+void dma_channel_transfer_from_buffer_now(uint channel, const volatile void *read_addr, uint32_t transfer_count) {
+    canais[channel].leitura = read_addr;
+    canais[channel].contagem = transfer_count;
+    executar(&canais[channel]);
+}
+
+void dma_channel_set_read_addr(uint channel, const volatile void *read_addr, bool trigger) {
+    canais[channel].leitura = read_addr;
+    if (trigger) {
+        executar(&canais[channel]);
+    }
+}
+
+void dma_channel_set_trans_count(uint channel, uint32_t trans_count, bool trigger) {
+    canais[channel].contagem = trans_count;
+    if (trigger) {
+        executar(&canais[channel]);
+    }
+}
+
+void dma_channel_start(uint channel) {
+    executar(&canais[channel]);
+}
+
+void dma_start_channel_mask(uint32_t chan_mask) {
+    for (uint c = 0; c < NUM_DMA_CHANNELS; c++) {
+        if (chan_mask & (1u << c)) {
+            executar(&canais[c]);
+        }
+    }
+}
+
+bool dma_channel_is_busy(uint channel) {
+    (void)channel;
+    return false;
+}
+
+void dma_channel_wait_for_finish_blocking(uint channel) {
+    (void)channel;
+}
@@ -0,0 +1,29 @@
+/**
+ * @file np_pio_mock.h
+ * @brief Mock da máquina de estados ws2818b e dos TX FIFOs do PIO para testes no PC.
+ *
+ * Cada palavra que chega a um TX FIFO é deslocada como no registrador OSR do RP2040 (direção
+ * e limiar de autopull configurados em `np_pio_mock_config()`), e os bits resultantes são
+ * gravados na ordem em que sairiam no fio. `np_pio_mock_leds()` agrupa esses bits de 24 em 24,
+ * como um LED WS2812 os recebe (primeiro bit = bit 23), o que permite comparar o empacotamento
+ * do quadro com o envio antigo byte a byte.
+ */
+
+#ifndef NP_PIO_MOCK_H
+#define NP_PIO_MOCK_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "pico/types.h"
+#include "hardware/pio.h"
+
+#define NP_PIO_MOCK_MAX_BITS (24 * 1024)
+
+void np_pio_mock_config(PIO pio, uint sm, uint pin, bool shift_right, uint autopull_bits);
+void np_pio_mock_push(PIO pio, uint sm, uint32_t palavra);
+void np_pio_mock_clear(PIO pio, uint sm);
+uint np_pio_mock_bits(PIO pio, uint sm);
+uint np_pio_mock_leds(PIO pio, uint sm, uint32_t *recebido, uint max);
+uint np_pio_mock_pin(PIO pio, uint sm);
+
+#endif
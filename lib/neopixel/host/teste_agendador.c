@@ -0,0 +1,242 @@
+/**
+ * @file teste_agendador.c
+ * @brief Agendador de efeitos tocado em tempo acelerado no PC, com os quadros gravados em PPM.
+ *
+ * Toca todos os efeitos de np_efeitos.h em sequência por `np_agendador_simular()` e confere o
+ * número de quadros e os instantes (um quadro por intervalo, sem buraco na troca de efeito), o
+ * conteúdo das espirais e do texto, a repetição de uma sequência e a composição de duas camadas
+ * com cadências diferentes (soma com saturação e mistura com alfa), comparada com cada camada
+ * tocada sozinha. Também confere o avanço por prazo com o callback de apresentação. Os quadros da
+ * sequência completa vão para teste_agendador.ppm, 16 por linha, para inspeção visual.
+ */
+
+#include <string.h>
+#include "teste.h"
+#include "np_agendador.h"
+#include "np_brilho.h"
+
+#define LEDS NP_EFEITO_LEDS
+#define LADO NP_EFEITO_LADO
+#define INTERVALO_MS 100
+#define MAX_QUADROS 512
+#define POR_LINHA 16
+#define ESCALA_PPM 8
+#define CAPTURA "teste_agendador.ppm"
+
+typedef struct {
+    uint32_t n;
+    uint64_t instante[MAX_QUADROS];
+    np_cor_t quadro[MAX_QUADROS][LEDS];
+} gravacao_t;
+
+static np_agendador_t agendador;
+static np_cor_t quadro[LEDS];
+
+static void gravar(uint64_t instante_us, const np_cor_t *q, void *dados) {
+    gravacao_t *g = dados;
+    if (g->n < MAX_QUADROS) {
+        g->instante[g->n] = instante_us;
+        memcpy(g->quadro[g->n], q, sizeof(g->quadro[0]));
+    }
+    g->n++;
+}
+
+static int acesos(const np_cor_t *q) {
+    int n = 0;
+    for (int i = 0; i < LEDS; i++) {
+        n += q[i].R || q[i].G || q[i].B;
+    }
+    return n;
+}
+
+// Toca uma sequência sozinha numa camada do zero até o fim (ou até duracao_us)
+static uint32_t tocar(gravacao_t *g, np_efeito_t *const *sequencia, uint8_t n, bool repetir, uint64_t duracao_us) {
+    g->n = 0;
+    np_agendador_init(&agendador, quadro, NULL, NULL);
+    np_agendador_definir_camada(&agendador, 0, sequencia, n, repetir);
+    return np_agendador_simular(&agendador, 0, duracao_us, gravar, g);
+}
+
+// Quadro de uma camada tocada sozinha no instante t: o último desenhado até t, ou apagado se a
+// sequência já acabou (fim_us = instante do último quadro + intervalo)
+static const np_cor_t *quadro_em(const gravacao_t *g, uint64_t t, uint64_t fim_us) {
+    static const np_cor_t apagado[LEDS];
+    const np_cor_t *q = apagado;
+    if (t >= fim_us) {
+        return apagado;
+    }
+    for (uint32_t i = 0; i < g->n && g->instante[i] <= t; i++) {
+        q = g->quadro[i];
+    }
+    return q;
+}
+
+static bool gravar_ppm(const gravacao_t *g) {
+    FILE *f = fopen(CAPTURA, "wb");
+    if (!f) {
+        return false;
+    }
+    int linhas = (int)(g->n + POR_LINHA - 1) / POR_LINHA;
+    int largura = POR_LINHA * (LADO + 1) * ESCALA_PPM, altura = linhas * (LADO + 1) * ESCALA_PPM;
+
+    fprintf(f, "P6\n%d %d\n255\n", largura, altura);
+    for (int y = 0; y < altura; y++) {
+        for (int x = 0; x < largura; x++) {
+            // Cada quadro ocupa (LADO + 1) x (LADO + 1) células, com uma de separação em cinza
+            int cx = x / ESCALA_PPM, cy = y / ESCALA_PPM;
+            uint32_t k = (uint32_t)((cy / (LADO + 1)) * POR_LINHA + cx / (LADO + 1));
+            np_cor_t c = NP_COR(40, 40, 40);
+            if (cx % (LADO + 1) < LADO && cy % (LADO + 1) < LADO) {
+                c = k < g->n ? g->quadro[k][(cy % (LADO + 1)) * LADO + cx % (LADO + 1)] : NP_COR(0, 0, 0);
+            }
+            fputc(c.R, f);
+            fputc(c.G, f);
+            fputc(c.B, f);
+        }
+    }
+    bool ok = !ferror(f);
+    fclose(f);
+    return ok;
+}
+
+static uint32_t apresentados;
+
+static void apresentar(uint64_t instante_us, const np_cor_t *q, void *dados) {
+    (void)instante_us;
+    VERIFICA(q == quadro && dados == &apresentados, "apresentar recebeu outro quadro ou outros dados");
+    apresentados++;
+}
+
+int main(void) {
+    static gravacao_t seq, a, b, comp;
+    static const char texto[] = "OI 25";
+
+    // Sequência com todos os efeitos
+    np_efeito_t efeitos[10];
+    np_efeito_iniciar(&efeitos[0], np_efeito_espiral, 0, 0, 200, INTERVALO_MS);
+    np_efeito_iniciar(&efeitos[1], np_efeito_espiral_inversa, 200, 0, 0, INTERVALO_MS);
+    np_efeito_iniciar(&efeitos[2], np_efeito_onda_vertical, 0, 200, 0, INTERVALO_MS);
+    np_efeito_iniciar(&efeitos[3], np_efeito_onda_vertical_brilho, 200, 200, 0, INTERVALO_MS);
+    np_efeito_iniciar(&efeitos[4], np_efeito_fileiras, 0, 200, 200, INTERVALO_MS);
+    np_efeito_iniciar(&efeitos[5], np_efeito_fileiras_reverso, 200, 0, 200, INTERVALO_MS);
+    np_efeito_iniciar(&efeitos[6], np_efeito_colunas, 200, 100, 0, INTERVALO_MS);
+    np_efeito_iniciar(&efeitos[7], np_efeito_colunas_reverso, 0, 100, 200, INTERVALO_MS);
+    np_efeito_iniciar(&efeitos[8], np_efeito_paleta, 0, 0, 0, INTERVALO_MS);
+    efeitos[8].dados = &NP_PALETA_CALOR;
+    np_efeito_iniciar(&efeitos[9], np_efeito_texto_rolante, 255, 255, 255, INTERVALO_MS);
+    efeitos[9].dados = texto;
+    np_efeito_t *const sequencia[] = {
+        &efeitos[0], &efeitos[1], &efeitos[2], &efeitos[3], &efeitos[4],
+        &efeitos[5], &efeitos[6], &efeitos[7], &efeitos[8], &efeitos[9],
+    };
+    const uint32_t quadros_por_efeito[] = {
+        LEDS, LEDS, LADO + 3, LADO, LADO, LADO, LADO, LADO, 64, (uint32_t)(np_texto_largura(texto) + LADO),
+    };
+
+    // Mais um quadro no fim: a camada que termina some da composição e a matriz é apagada
+    uint32_t esperado = 1;
+    for (int i = 0; i < 10; i++) {
+        esperado += quadros_por_efeito[i];
+    }
+    double t0 = teste_agora();
+    uint32_t n = tocar(&seq, sequencia, 10, false, UINT64_MAX);
+    double segundos = teste_agora() - t0;
+    VERIFICA(n == esperado && seq.n == n, "sequência com %u quadros (%u gravados), esperados %u", n, seq.n, esperado);
+    VERIFICA(!np_agendador_ativo(&agendador), "camada ativa depois da sequência");
+    VERIFICA(acesos(seq.quadro[esperado - 1]) == 0, "último quadro não apagou a matriz");
+    VERIFICA(np_agendador_proximo_prazo(&agendador) == NP_EFEITO_FIM, "prazo pendente depois da sequência");
+    for (uint32_t k = 0; k < seq.n && k < MAX_QUADROS; k++) {
+        VERIFICA(seq.instante[k] == (uint64_t)k * INTERVALO_MS * 1000, "quadro %u em %llu us", k,
+                 (unsigned long long)seq.instante[k]);
+    }
+
+    // Espirais: um LED a mais por quadro, do canto ao centro e do centro ao canto
+    for (int k = 0; k < LEDS; k++) {
+        VERIFICA(acesos(seq.quadro[k]) == k + 1, "espiral, quadro %d: %d LEDs", k, acesos(seq.quadro[k]));
+        VERIFICA(acesos(seq.quadro[LEDS + k]) == k + 1, "espiral inversa, quadro %d: %d LEDs", k,
+                 acesos(seq.quadro[LEDS + k]));
+    }
+    VERIFICA(seq.quadro[0][0].B == 200 && seq.quadro[LEDS][2 * LADO + 2].R == 200,
+             "espirais não começam no canto e no centro");
+
+    // Texto: entra pela direita (primeiro quadro apagado) e sai pela esquerda
+    uint32_t fim_texto = esperado - 1, inicio_texto = fim_texto - quadros_por_efeito[9];
+    VERIFICA(acesos(seq.quadro[inicio_texto]) == 0 && acesos(seq.quadro[fim_texto - 1]) <= LADO,
+             "texto rolante não entra pela direita ou não sai pela esquerda");
+    uint32_t glifo = np_glifo('O');
+    int colunas_o = 0;
+    for (uint32_t k = inicio_texto; k < fim_texto; k++) {
+        uint32_t bits = 0;
+        for (int i = 0; i < LEDS; i++) {
+            bits |= (uint32_t)(seq.quadro[k][i].R != 0) << (LEDS - 1 - i);
+        }
+        colunas_o += bits == glifo;
+    }
+    VERIFICA(colunas_o == 1, "o glifo 'O' apareceu inteiro em %d quadros", colunas_o);
+
+    // Repetição: 10 s de espiral em loop dão um quadro por intervalo, e a camada segue ativa
+    n = tocar(&a, sequencia, 1, true, 10000000);
+    VERIFICA(n == 10000 / INTERVALO_MS, "espiral em loop: %u quadros em 10 s", n);
+    VERIFICA(np_agendador_ativo(&agendador), "camada em loop parou");
+    VERIFICA(acesos(a.quadro[LEDS]) == 1, "espiral não recomeçou depois do último quadro");
+
+    // Duas camadas com cadências diferentes: fileiras a 100 ms embaixo, colunas a 150 ms em cima
+    np_efeito_t fileiras, colunas;
+    np_efeito_iniciar(&fileiras, np_efeito_fileiras, 200, 60, 0, 100);
+    np_efeito_iniciar(&colunas, np_efeito_colunas, 100, 0, 255, 150);
+    np_efeito_t *const so_fileiras[] = { &fileiras }, *const so_colunas[] = { &colunas };
+    tocar(&a, so_fileiras, 1, false, UINT64_MAX);
+    tocar(&b, so_colunas, 1, false, UINT64_MAX);
+    const uint64_t fim_a = 5 * 100000, fim_b = 5 * 150000;
+
+    for (int modo = 0; modo < 2; modo++) {
+        uint16_t alfa = modo ? NP_BRILHO_MAX / 2 : NP_AGENDADOR_ADITIVA;
+        comp.n = 0;
+        np_agendador_init(&agendador, quadro, NULL, NULL);
+        np_agendador_definir_camada(&agendador, 0, so_fileiras, 1, false);
+        np_agendador_definir_camada(&agendador, 1, so_colunas, 1, false);
+        np_agendador_misturar_camada(&agendador, 1, alfa);
+        np_agendador_simular(&agendador, 0, UINT64_MAX, gravar, &comp);
+
+        // Um quadro em cada instante em que alguma camada desenhou ou terminou
+        VERIFICA(comp.n == 10, "%s: %u quadros compostos", modo ? "mistura" : "soma", comp.n);
+        for (uint32_t k = 0; k < comp.n; k++) {
+            uint64_t t = comp.instante[k];
+            np_cor_t ref[LEDS];
+            memcpy(ref, quadro_em(&a, t, fim_a), sizeof(ref));
+            if (modo) {
+                if (t < fim_b) {
+                    np_misturar(ref, quadro_em(&b, t, fim_b), LEDS, alfa);
+                }
+            }
+            else {
+                np_somar(ref, quadro_em(&b, t, fim_b), LEDS);
+            }
+            VERIFICA(memcmp(ref, comp.quadro[k], sizeof(ref)) == 0, "%s em %llu us difere das camadas sozinhas",
+                     modo ? "mistura" : "soma", (unsigned long long)t);
+        }
+    }
+
+    // Avanço por prazo: só apresenta quando alguma camada venceu
+    np_agendador_init(&agendador, quadro, apresentar, &apresentados);
+    np_agendador_definir_camada(&agendador, 0, so_fileiras, 1, false);
+    VERIFICA(np_agendador_avancar(&agendador, 1000), "primeiro quadro não saiu");
+    VERIFICA(!np_agendador_avancar(&agendador, 50000), "apresentou antes do prazo");
+    VERIFICA(np_agendador_proximo_prazo(&agendador) == 101000, "prazo %llu us",
+             (unsigned long long)np_agendador_proximo_prazo(&agendador));
+    VERIFICA(np_agendador_avancar(&agendador, 101000), "não apresentou no prazo");
+    VERIFICA(apresentados == 2, "%u quadros apresentados", apresentados);
+    np_agendador_parar(&agendador, 0);
+    VERIFICA(!np_agendador_ativo(&agendador), "camada parada segue ativa");
+
+    VERIFICA(np_agendador_iniciar_timer(&agendador, 50) && agendador.timer.user_data == &agendador,
+             "timer não ficou com o agendador");
+    np_agendador_parar_timer(&agendador);
+    VERIFICA(!agendador.timer_ativo, "timer ativo depois de parar");
+
+    VERIFICA(gravar_ppm(&seq), "não gravou " CAPTURA);
+
+    printf("%u quadros (%.1f s de efeitos) simulados em %.2f ms; quadros em " CAPTURA "\n", seq.n,
+           seq.n * INTERVALO_MS / 1000.0, segundos * 1e3);
+    return TESTE_FIM();
+}
@@ -0,0 +1,173 @@
+/**
+ * @file teste_np_tx.c
+ * @brief Empacotamento GRB de np_tx e sequência de bits no fio contra o envio antigo byte a byte.
+ *
+ * O envio antigo (`pio_sm_put_blocking()` de G, R e B, com o ws2818b em autopull de 8 bits) é
+ * reproduzido numa máquina de estados do mock; o quadro empacotado passa pelo DMA mockado até a
+ * máquina configurada por `np_tx_init()` (autopull de 24 bits). Os bits que sairiam no fio
+ * precisam ser os mesmos. Também confere o buffer duplo, o envio em grupo e o limite de fitas.
+ */
+
+#include <string.h>
+#include "teste.h"
+#include "neopixel_tx.h"
+#include "np_pio_mock.h"
+
+#define N_LEDS 25
+#define N_LONGO 1000
+#define N_FITAS 8
+
+static uint32_t quadro[N_LEDS];
+static uint32_t longo[2][N_LONGO];
+
+typedef struct {
+    uint8_t r, g, b;
+} cor_t;
+
+// LED que a fita recebe para a cor (primeiro bit no bit 23): G, depois R, depois B, cada byte
+// saindo pelo bit menos significativo (shift à direita)
+static uint32_t reverter8(uint8_t v) {
+    uint32_t r = 0;
+    for (int i = 0; i < 8; i++) {
+        r |= ((v >> i) & 1u) << (7 - i);
+    }
+    return r;
+}
+
+static uint32_t recebido_esperado(cor_t c) {
+    return (reverter8(c.g) << 16) | (reverter8(c.r) << 8) | reverter8(c.b);
+}
+
+static bool leds_iguais(PIO pio, uint sm, const cor_t *cores, uint n) {
+    uint32_t recebido[N_LEDS];
+
+    if (np_pio_mock_bits(pio, sm) != n * 24 || np_pio_mock_leds(pio, sm, recebido, N_LEDS) != n) {
+        return false;
+    }
+    for (uint i = 0; i < n; i++) {
+        if (recebido[i] != recebido_esperado(cores[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(void) {
+    static cor_t cores[N_LEDS];
+    uint32_t semente = 7;
+
+    for (int i = 0; i < N_LEDS; i++) {
+        semente = semente * 1103515245u + 12345u;
+        cores[i] = (cor_t){ (uint8_t)(semente >> 8), (uint8_t)(semente >> 16), (uint8_t)(semente >> 24) };
+    }
+    cores[0] = (cor_t){ 0x80, 0x01, 0x00 };     // bits das pontas de cada byte
+    cores[1] = (cor_t){ 0x00, 0x00, 0xFF };
+
+    // Palavra de um LED: G no byte 0, R no 1, B no 2, byte 3 livre
+    VERIFICA(np_tx_word(0x12, 0x34, 0x56) == 0x00561234u, "np_tx_word = 0x%08X",
+             (unsigned)np_tx_word(0x12, 0x34, 0x56));
+
+    // Envio antigo: três palavras de 8 bits por LED numa máquina de estados própria
+    int sm_antiga = pio_claim_unused_sm(pio1, true);
+    np_pio_mock_config(pio1, (uint)sm_antiga, 7, true, 8);
+    for (int i = 0; i < N_LEDS; i++) {
+        pio_sm_put_blocking(pio1, (uint)sm_antiga, cores[i].g);
+        pio_sm_put_blocking(pio1, (uint)sm_antiga, cores[i].r);
+        pio_sm_put_blocking(pio1, (uint)sm_antiga, cores[i].b);
+    }
+    VERIFICA(leds_iguais(pio1, (uint)sm_antiga, cores, N_LEDS), "referência antiga fora do formato WS2812");
+
+    // Envio por DMA do quadro empacotado
+    np_tx_t tx;
+    VERIFICA(np_tx_init(&tx, 7, quadro, N_LEDS), "np_tx_init() falhou");
+    VERIFICA(np_pio_mock_pin(tx.pio, tx.sm) == 7, "pino %u", np_pio_mock_pin(tx.pio, tx.sm));
+    for (int i = 0; i < N_LEDS; i++) {
+        quadro[i] = np_tx_word(cores[i].r, cores[i].g, cores[i].b);
+    }
+    np_tx_start(&tx);
+    VERIFICA(np_tx_busy(&tx), "np_tx_start() não deixou a fita ocupada (reset de %d us)", NP_TX_RESET_US);
+    VERIFICA(leds_iguais(tx.pio, tx.sm, cores, N_LEDS), "quadro empacotado difere do envio byte a byte");
+
+    uint32_t antigo[N_LEDS], novo[N_LEDS];
+    np_pio_mock_leds(pio1, (uint)sm_antiga, antigo, N_LEDS);
+    np_pio_mock_leds(tx.pio, tx.sm, novo, N_LEDS);
+    VERIFICA(memcmp(antigo, novo, sizeof(antigo)) == 0, "bits no fio diferentes do envio antigo");
+
+    np_tx_wait(&tx);
+    VERIFICA(!np_tx_busy(&tx), "ocupada depois de np_tx_wait()");
+    np_tx_release(&tx);
+
+    // Buffer duplo: o quadro de trás nunca é o que está no fio; present com o fio ocupado fica
+    // pendente e sai sozinho depois do reset, e o mais recente substitui o pendente. A fita
+    // longa (30 ms de fio) deixa folga para as verificações antes do fim do reset
+    VERIFICA(np_tx_init(&tx, 8, longo[0], N_LONGO), "np_tx_init() da fita longa falhou");
+    np_tx_set_double_buffer(&tx, longo[1]);
+
+    uint32_t *fundo = np_tx_back_buffer(&tx);
+    VERIFICA(fundo == longo[1], "primeiro quadro de trás não é o segundo buffer");
+    for (int i = 0; i < N_LONGO; i++) {
+        fundo[i] = np_tx_word(0xFF, 0, 0);
+    }
+    np_tx_present(&tx);
+    VERIFICA(np_pio_mock_bits(tx.pio, tx.sm) == N_LONGO * 24, "present com o fio livre não enviou");
+
+    fundo = np_tx_back_buffer(&tx);
+    VERIFICA(fundo == longo[0], "quadro de trás é o que está no fio");
+    for (int i = 0; i < N_LONGO; i++) {
+        fundo[i] = np_tx_word(0, 0, 0xFF);
+    }
+    np_tx_present(&tx);
+    VERIFICA(tx.pendente, "present com o fio ocupado não ficou pendente");
+
+    fundo = np_tx_back_buffer(&tx);
+    VERIFICA(fundo == longo[0], "quadro pendente trocou de buffer");
+    for (int i = 0; i < N_LONGO; i++) {
+        fundo[i] = np_tx_word(0, 0xFF, 0);
+    }
+    np_tx_present(&tx);
+    VERIFICA(np_pio_mock_bits(tx.pio, tx.sm) == N_LONGO * 24, "quadro pendente saiu antes do reset");
+
+    np_pio_mock_clear(tx.pio, tx.sm);
+    np_tx_wait(&tx);
+    VERIFICA(!tx.pendente && np_pio_mock_bits(tx.pio, tx.sm) == N_LONGO * 24,
+             "pendente não saiu depois do reset (%u bits)", np_pio_mock_bits(tx.pio, tx.sm));
+    static uint32_t recebido[N_LONGO];
+    np_pio_mock_leds(tx.pio, tx.sm, recebido, N_LONGO);
+    VERIFICA(recebido[0] == recebido_esperado((cor_t){ 0, 0xFF, 0 }) &&
+             recebido[N_LONGO - 1] == recebido_esperado((cor_t){ 0, 0xFF, 0 }),
+             "segundo quadro com 0x%06X em vez do present mais recente", (unsigned)recebido[0]);
+    np_tx_release(&tx);
+
+    // Várias fitas: uma máquina de estados e um canal por fita, disparadas juntas. Há 8 máquinas
+    // nos dois PIOs; a de referência ocupa uma, então cabem 7
+    static np_tx_t fitas[N_FITAS];
+    static uint32_t quadros[N_FITAS][N_LEDS];
+    np_tx_t *grupo[N_FITAS];
+    uint n_fitas = 0;
+    while (n_fitas < N_FITAS && np_tx_init(&fitas[n_fitas], 10 + n_fitas, quadros[n_fitas], N_LEDS)) {
+        for (int i = 0; i < N_LEDS; i++) {
+            quadros[n_fitas][i] = np_tx_word((uint8_t)n_fitas, (uint8_t)i, 0);
+        }
+        grupo[n_fitas] = &fitas[n_fitas];
+        n_fitas++;
+    }
+    VERIFICA(n_fitas == N_FITAS - 1, "%u fitas inicializadas com uma máquina ocupada", n_fitas);
+
+    for (uint f = 0; f < n_fitas; f++) {
+        np_pio_mock_clear(fitas[f].pio, fitas[f].sm);
+    }
+    np_tx_present_grupo(grupo, n_fitas);
+    for (uint f = 0; f < n_fitas; f++) {
+        np_pio_mock_leds(fitas[f].pio, fitas[f].sm, recebido, N_LEDS);
+        VERIFICA(np_pio_mock_bits(fitas[f].pio, fitas[f].sm) == N_LEDS * 24 &&
+                 recebido[3] == recebido_esperado((cor_t){ (uint8_t)f, 3, 0 }),
+                 "fita %u (pino %u) recebeu outro quadro", f, np_pio_mock_pin(fitas[f].pio, fitas[f].sm));
+    }
+    np_tx_wait_grupo(grupo, n_fitas);
+    for (uint f = 0; f < n_fitas; f++) {
+        np_tx_release(&fitas[f]);
+    }
+
+    printf("%d LEDs iguais ao envio antigo; %u fitas em grupo\n", N_LEDS, n_fitas);
+    return TESTE_FIM();
+}
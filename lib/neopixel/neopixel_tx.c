@@ -0,0 +1,240 @@
+/**
+ * @file neopixel_tx.c
+ * @brief Implementação da transmissão NeoPixel por DMA para a máquina de estados `ws2818b`.
+ *
+ * Dependências:
+ * - `ws2818b.pio.h`, gerado a partir de `ws2818b.pio` (autopull de 24 bits por LED).
+ * - Pico SDK: `hardware/pio.h`, `hardware/dma.h`, `pico/time.h`.
+ */
+
+#include "pico/stdlib.h"
+#include "pico/time.h"
+#include "hardware/pio.h"
+#include "hardware/dma.h"
+#include "ws2818b.pio.h"
+#include "neopixel_tx.h"
+
+// Offset do programa ws2818b em cada PIO (-1 = ainda não carregado); várias máquinas
+// de estados do mesmo PIO compartilham a mesma cópia do programa
+static int offset_programa[2] = { -1, -1 };
+
+// Procura uma máquina de estados livre em pio0 e depois em pio1, carregando o programa
+// no PIO escolhido se necessário
+static bool reservar_maquina(np_tx_t *tx) {
+    PIO pios[2] = { pio0, pio1 };
+
+    for (int i = 0; i < 2; i++) {
+        int sm = pio_claim_unused_sm(pios[i], false);
+        if (sm < 0) {
+            continue;
+        }
+
+        if (offset_programa[i] < 0) {
+            if (!pio_can_add_program(pios[i], &ws2818b_program)) {
+                pio_sm_unclaim(pios[i], (uint)sm);
+                continue;
+            }
+            offset_programa[i] = (int)pio_add_program(pios[i], &ws2818b_program);
+        }
+
+        tx->pio = pios[i];
+        tx->sm = (uint)sm;
+        return true;
+    }
+    return false;
+}
+
+// Prepara a transmissão de n_leds palavras de quadro pelo pino indicado.
+// Retorna false se não houver máquina de estados ou canal DMA livre.
+bool np_tx_init(np_tx_t *tx, uint pin, uint32_t *quadro, uint n_leds) {
+    if (!reservar_maquina(tx)) {
+        return false;
+    }
+
+    tx->dma_chan = dma_claim_unused_channel(false);
+    if (tx->dma_chan < 0) {
+        pio_sm_unclaim(tx->pio, tx->sm);
+        return false;
+    }
+
+    int indice_pio = (tx->pio == pio0) ? 0 : 1;
+    ws2818b_program_init(tx->pio, tx->sm, (uint)offset_programa[indice_pio], pin, (float)NP_TX_FREQ_HZ);
+
+    // 32 bits por transferência, lendo o quadro em sequência e escrevendo sempre no TX FIFO,
+    // no ritmo em que a máquina de estados consome as palavras
+    dma_channel_config cfg = dma_channel_get_default_config(tx->dma_chan);
+    channel_config_set_transfer_data_size(&cfg, DMA_SIZE_32);
+    channel_config_set_read_increment(&cfg, true);
+    channel_config_set_write_increment(&cfg, false);
+    channel_config_set_dreq(&cfg, pio_get_dreq(tx->pio, tx->sm, true));
+    dma_channel_configure(tx->dma_chan, &cfg, &tx->pio->txf[tx->sm], quadro, n_leds, false);
+
+    tx->quadros[0] = quadro;
+    tx->quadros[1] = NULL;
+    tx->n_leds = n_leds;
+    tx->em_envio = 0;
+    tx->pendente = false;
+    tx->alarme_ativo = false;
+    tx->fim_us = 0;
+    critical_section_init(&tx->trava);
+    return true;
+}
+
+// Ativa o buffer duplo: segundo precisa ter n_leds palavras, como o quadro do init
+void np_tx_set_double_buffer(np_tx_t *tx, uint32_t *segundo) {
+    np_tx_wait(tx);
+    tx->quadros[1] = segundo;
+}
+
+// Libera a máquina de estados e o canal DMA (aguarda a transmissão em andamento)
+void np_tx_release(np_tx_t *tx) {
+    np_tx_wait(tx);
+    pio_sm_set_enabled(tx->pio, tx->sm, false);
+    pio_sm_unclaim(tx->pio, tx->sm);
+    dma_channel_unclaim((uint)tx->dma_chan);
+    critical_section_deinit(&tx->trava);
+    tx->dma_chan = -1;
+}
+
+static inline bool transmitindo(const np_tx_t *tx) {
+    return dma_channel_is_busy((uint)tx->dma_chan) || time_us_64() < tx->fim_us;
+}
+
+// Aponta o canal DMA para um dos quadros sem dispará-lo (chamar com a trava e o fio livre)
+static void armar(np_tx_t *tx, uint8_t indice) {
+    tx->em_envio = indice;
+    tx->fim_us = time_us_64() + (uint64_t)tx->n_leds * NP_TX_US_POR_LED + NP_TX_RESET_US;
+    dma_channel_set_read_addr((uint)tx->dma_chan, tx->quadros[indice], false);
+    dma_channel_set_trans_count((uint)tx->dma_chan, tx->n_leds, false);
+}
+
+// Inicia a transmissão de um dos quadros (chamar com a trava e o fio livre)
+static void iniciar(np_tx_t *tx, uint8_t indice) {
+    armar(tx, indice);
+    dma_channel_start((uint)tx->dma_chan);
+}
+
+// Se o fio ficou livre e há quadro pendente, inicia o envio dele. Chamado pelo alarme e por
+// quem consulta o estado, para que o pendente saia mesmo com o alarme atrasado (por exemplo,
+// quando se espera dentro de outro callback de alarme)
+static void avancar(np_tx_t *tx) {
+    critical_section_enter_blocking(&tx->trava);
+    if (tx->pendente && !transmitindo(tx)) {
+        iniciar(tx, tx->em_envio ^ 1);
+        tx->pendente = false;
+    }
+    critical_section_exit(&tx->trava);
+}
+
+static int64_t alarme_pendente(alarm_id_t id, void *dados) {
+    (void)id;
+    np_tx_t *tx = (np_tx_t *)dados;
+
+    tx->alarme_ativo = false;
+    avancar(tx);
+    return 0;
+}
+
+// Dispara o envio do quadro único e retorna sem esperar o fim da transmissão
+void np_tx_start(np_tx_t *tx) {
+    np_tx_wait(tx);
+
+    critical_section_enter_blocking(&tx->trava);
+    iniciar(tx, 0);
+    critical_section_exit(&tx->trava);
+}
+
+// Buffer onde montar o próximo quadro. Com buffer duplo é sempre o que não está no fio; um
+// quadro pendente nele é descartado (será substituído pelo próximo present). Com buffer único
+// espera o fim da transmissão atual.
+uint32_t *np_tx_back_buffer(np_tx_t *tx) {
+    if (tx->quadros[1] == NULL) {
+        np_tx_wait(tx);
+        return tx->quadros[0];
+    }
+
+    avancar(tx);
+    critical_section_enter_blocking(&tx->trava);
+    tx->pendente = false;
+    uint32_t *fundo = tx->quadros[tx->em_envio ^ 1];
+    critical_section_exit(&tx->trava);
+    return fundo;
+}
+
+// Entrega o buffer de trás: com o fio livre, arma o DMA e devolve true (quem chama dispara o
+// canal); senão deixa o quadro pendente, agenda o alarme se preciso e devolve false. Com
+// buffer único espera o fio e sempre arma.
+static bool entregar(np_tx_t *tx) {
+    if (tx->quadros[1] == NULL) {
+        np_tx_wait(tx);
+        critical_section_enter_blocking(&tx->trava);
+        armar(tx, 0);
+        critical_section_exit(&tx->trava);
+        return true;
+    }
+
+    bool armado = false;
+    bool agendar = false;
+
+    critical_section_enter_blocking(&tx->trava);
+    if (!transmitindo(tx)) {
+        armar(tx, tx->em_envio ^ 1);
+        tx->pendente = false;
+        armado = true;
+    }
+    else {
+        tx->pendente = true;
+        agendar = !tx->alarme_ativo;
+        tx->alarme_ativo = true;
+    }
+    uint64_t fim_us = tx->fim_us;
+    critical_section_exit(&tx->trava);
+
+    if (agendar) {
+        add_alarm_at(from_us_since_boot(fim_us), alarme_pendente, tx, true);
+    }
+    return armado;
+}
+
+// Entrega o buffer de trás ao transmissor, sem esperar
+void np_tx_present(np_tx_t *tx) {
+    if (entregar(tx)) {
+        dma_channel_start((uint)tx->dma_chan);
+    }
+}
+
+// Present de várias fitas de uma vez: os canais cujo fio está livre são armados e disparados
+// juntos por dma_start_channel_mask(), então as transmissões correm em paralelo e o grupo
+// termina quando termina a fita mais longa (e não na soma dos tempos). As fitas ainda
+// ocupadas ficam com o quadro pendente, como no np_tx_present().
+void np_tx_present_grupo(np_tx_t *const *txs, uint n) {
+    uint32_t mascara = 0;
+
+    for (uint i = 0; i < n; i++) {
+        if (entregar(txs[i])) {
+            mascara |= 1u << (uint)txs[i]->dma_chan;
+        }
+    }
+    if (mascara) {
+        dma_start_channel_mask(mascara);
+    }
+}
+
+// Espera todas as fitas do grupo terminarem (o tempo total é o da mais longa)
+void np_tx_wait_grupo(np_tx_t *const *txs, uint n) {
+    for (uint i = 0; i < n; i++) {
+        np_tx_wait(txs[i]);
+    }
+}
+
+// true enquanto há quadro no fio (DMA, bits saindo ou reset) ou aguardando para sair
+bool np_tx_busy(np_tx_t *tx) {
+    avancar(tx);
+    return tx->pendente || transmitindo(tx);
+}
+
+void np_tx_wait(np_tx_t *tx) {
+    while (np_tx_busy(tx)) {
+        tight_loop_contents();
+    }
+}
@@ -0,0 +1,73 @@
+/**
+ * @file neopixel_tx.h
+ * @brief Transmissão assíncrona para LEDs WS2812/WS2818B (NeoPixel) via PIO + DMA.
+ *
+ * Substitui o laço de `pio_sm_put_blocking()` (três palavras por LED, com a CPU presa durante
+ * todo o tempo de fio) por um quadro de palavras empacotadas entregue à máquina de estados
+ * `ws2818b` por um canal DMA.
+ *
+ * Funcionamento:
+ * - Cada LED ocupa uma palavra de 32 bits do quadro, montada com `np_tx_word()`: G no byte 0,
+ *   R no byte 1 e B no byte 2. O programa PIO faz autopull de 24 bits, então os bits chegam
+ *   ao fio na mesma ordem de antes.
+ * - `np_tx_start()` dispara o DMA e retorna imediatamente; o quadro não pode ser alterado até
+ *   `np_tx_busy()` indicar o fim. Se uma transmissão anterior ainda estiver em andamento, a
+ *   função espera por ela primeiro.
+ * - Com buffer duplo (`np_tx_set_double_buffer()`), o quadro é montado no buffer de trás
+ *   (`np_tx_back_buffer()`) e entregue com `np_tx_present()`, que nunca espera: se o fio estiver
+ *   livre a transmissão começa na hora; senão o quadro fica pendente e é enviado logo após o
+ *   reset do atual (um alarme dispara o envio). Apresentar de novo antes disso substitui o
+ *   quadro pendente (vale sempre o mais recente, como num vsync). Outro núcleo pode montar e
+ *   apresentar quadros enquanto este transmite: o estado é protegido por uma seção crítica.
+ * - O fim da transmissão inclui o último LED saindo do FIFO e o tempo de reset (linha em nível
+ *   baixo) que faz os LEDs aplicarem as cores; como o PIO envia a uma taxa fixa de 800 kHz,
+ *   esse instante é calculado no disparo, sem depender da interrupção do DMA.
+ *
+ * Cada `np_tx_t` usa uma máquina de estados livre (pio0 ou pio1) e um canal DMA próprios, então
+ * até oito fitas podem transmitir ao mesmo tempo. `np_tx_present_grupo()` dispara os canais de
+ * várias fitas no mesmo ciclo: a atualização do grupo dura o tempo da fita mais longa.
+ */
+
+#ifndef NEOPIXEL_TX_H
+#define NEOPIXEL_TX_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "pico/types.h"
+#include "pico/critical_section.h"
+#include "hardware/pio.h"
+
+#define NP_TX_FREQ_HZ 800000
+#define NP_TX_US_POR_LED 30     // 24 bits x 1,25 us
+#define NP_TX_RESET_US 100      // linha em nível baixo para os LEDs aplicarem as cores
+
+typedef struct {
+    PIO pio;
+    uint sm;
+    int dma_chan;
+    uint32_t *quadros[2];       // uma palavra GRB por LED; [1] só existe com buffer duplo
+    uint n_leds;
+    uint8_t em_envio;           // quadro transmitido por último (ou em transmissão)
+    volatile bool pendente;     // o outro quadro aguarda o fim da transmissão atual
+    volatile bool alarme_ativo;
+    volatile uint64_t fim_us;   // instante em que a transmissão atual (com reset) termina
+    critical_section_t trava;
+} np_tx_t;
+
+// Palavra de um LED no formato do quadro (G no byte menos significativo)
+static inline uint32_t np_tx_word(uint8_t r, uint8_t g, uint8_t b) {
+    return (uint32_t)g | ((uint32_t)r << 8) | ((uint32_t)b << 16);
+}
+
+bool np_tx_init(np_tx_t *tx, uint pin, uint32_t *quadro, uint n_leds);
+void np_tx_set_double_buffer(np_tx_t *tx, uint32_t *segundo);
+void np_tx_release(np_tx_t *tx);
+void np_tx_start(np_tx_t *tx);
+uint32_t *np_tx_back_buffer(np_tx_t *tx);
+void np_tx_present(np_tx_t *tx);
+void np_tx_present_grupo(np_tx_t *const *txs, uint n);
+void np_tx_wait_grupo(np_tx_t *const *txs, uint n);
+bool np_tx_busy(np_tx_t *tx);
+void np_tx_wait(np_tx_t *tx);
+
+#endif
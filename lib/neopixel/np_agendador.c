@@ -0,0 +1,177 @@
+/**
+ * @file np_agendador.c
+ * @brief Camadas de efeitos, composição e avanço por prazo, timer ou tempo simulado.
+ */
+
+#include <string.h>
+#include "np_agendador.h"
+
+static void limpar_tela(np_cor_t *tela) {
+    memset(tela, 0, NP_EFEITO_LEDS * sizeof(np_cor_t));
+}
+
+// Prepara o efeito atual da camada para desenhar na tela dela, a partir do primeiro quadro
+static void carregar_efeito(np_camada_t *c) {
+    np_efeito_t *e = c->sequencia[c->atual];
+    e->tela = c->tela;
+    np_efeito_reiniciar(e);
+}
+
+// Agendador sem camadas ativas, compondo em quadro (NP_EFEITO_LEDS LEDs). apresentar recebe
+// cada quadro novo de np_agendador_avancar(); pode ser NULL.
+void np_agendador_init(np_agendador_t *a, np_cor_t *quadro, np_agendador_quadro_t apresentar, void *dados) {
+    memset(a, 0, sizeof(*a));
+    a->quadro = quadro;
+    a->apresentar = apresentar;
+    a->dados = dados;
+}
+
+// Troca a sequência tocada por uma camada (n = 0 desliga a camada). Para efeitos em loop
+// contínuo, repetir = true volta ao primeiro efeito depois do último.
+void np_agendador_definir_camada(np_agendador_t *a, uint8_t camada, np_efeito_t *const *sequencia, uint8_t n,
+                                 bool repetir) {
+    if (camada >= NP_AGENDADOR_CAMADAS) return;
+    np_camada_t *c = &a->camadas[camada];
+
+    c->ativa = false;
+    c->sequencia = sequencia;
+    c->n = n;
+    c->atual = 0;
+    c->repetir = repetir;
+    c->prazo = 0;
+    limpar_tela(c->tela);
+    if (n == 0) return;
+
+    carregar_efeito(c);
+    c->ativa = true;
+}
+
+// Modo de composição da camada sobre as de índice menor: NP_AGENDADOR_ADITIVA (padrão) soma os
+// canais com saturação; um alfa 8.8 (0..NP_BRILHO_MAX) mistura a tela por cima com essa
+// opacidade, inclusive onde ela está apagada (serve para transições entre camadas)
+void np_agendador_misturar_camada(np_agendador_t *a, uint8_t camada, uint16_t alfa) {
+    if (camada >= NP_AGENDADOR_CAMADAS) return;
+    a->camadas[camada].misturar = alfa != NP_AGENDADOR_ADITIVA;
+    a->camadas[camada].alfa = alfa;
+}
+
+void np_agendador_parar(np_agendador_t *a, uint8_t camada) {
+    np_agendador_definir_camada(a, camada, NULL, 0, false);
+}
+
+bool np_agendador_ativo(const np_agendador_t *a) {
+    for (int i = 0; i < NP_AGENDADOR_CAMADAS; ++i) {
+        if (a->camadas[i].ativa) return true;
+    }
+    return false;
+}
+
+// Roda o passo da camada; se o efeito acabou, segue para o próximo da sequência
+static void passo_camada(np_camada_t *c, uint64_t agora_us) {
+    for (int tentativas = 0; tentativas <= c->n; ++tentativas) {
+        np_efeito_t *e = c->sequencia[c->atual];
+        uint64_t prazo = e->passo(e, agora_us);
+        if (prazo != NP_EFEITO_FIM) {
+            c->prazo = prazo;
+            return;
+        }
+
+        if (++c->atual >= c->n) {
+            if (!c->repetir) break;
+            c->atual = 0;
+        }
+        carregar_efeito(c);
+    }
+
+    // Sequência encerrada (ou só com efeitos vazios): a camada some da composição
+    c->ativa = false;
+    limpar_tela(c->tela);
+}
+
+// Avança as camadas vencidas e, se algo mudou, compõe todas as telas no quadro
+static bool avancar_camadas(np_agendador_t *a, uint64_t agora_us) {
+    bool mudou = false;
+
+    for (int i = 0; i < NP_AGENDADOR_CAMADAS; ++i) {
+        np_camada_t *c = &a->camadas[i];
+        if (c->ativa && agora_us >= c->prazo) {
+            passo_camada(c, agora_us);
+            mudou = true;
+        }
+    }
+    if (!mudou) return false;
+
+    limpar_tela(a->quadro);
+    for (int i = 0; i < NP_AGENDADOR_CAMADAS; ++i) {
+        np_camada_t *c = &a->camadas[i];
+        if (!c->ativa) continue;
+        if (c->misturar) {
+            np_misturar(a->quadro, c->tela, NP_EFEITO_LEDS, c->alfa);
+        }
+        else {
+            np_somar(a->quadro, c->tela, NP_EFEITO_LEDS);
+        }
+    }
+    return true;
+}
+
+// Avança o que venceu até agora_us e apresenta o quadro composto. Retorna true se um quadro
+// novo foi entregue.
+bool np_agendador_avancar(np_agendador_t *a, uint64_t agora_us) {
+    if (!avancar_camadas(a, agora_us)) return false;
+    if (a->apresentar) {
+        a->apresentar(agora_us, a->quadro, a->dados);
+    }
+    return true;
+}
+
+// Menor prazo entre as camadas ativas (NP_EFEITO_FIM se nenhuma)
+uint64_t np_agendador_proximo_prazo(const np_agendador_t *a) {
+    uint64_t prazo = NP_EFEITO_FIM;
+    for (int i = 0; i < NP_AGENDADOR_CAMADAS; ++i) {
+        if (a->camadas[i].ativa && a->camadas[i].prazo < prazo) {
+            prazo = a->camadas[i].prazo;
+        }
+    }
+    return prazo;
+}
+
+static bool callback_timer(repeating_timer_t *t) {
+    np_agendador_avancar((np_agendador_t *)t->user_data, time_us_64());
+    return true;
+}
+
+// Avança o agendador a cada periodo_ms por um timer repetitivo (a resolução dos efeitos fica
+// limitada a esse período)
+bool np_agendador_iniciar_timer(np_agendador_t *a, uint32_t periodo_ms) {
+    if (a->timer_ativo) np_agendador_parar_timer(a);
+    a->timer_ativo = add_repeating_timer_us(-(int64_t)periodo_ms * 1000, callback_timer, a, &a->timer);
+    return a->timer_ativo;
+}
+
+void np_agendador_parar_timer(np_agendador_t *a) {
+    if (a->timer_ativo) {
+        cancel_repeating_timer(&a->timer);
+        a->timer_ativo = false;
+    }
+}
+
+// Toca as camadas em tempo acelerado, saltando de prazo em prazo sem esperar e sem apresentar:
+// cada quadro composto é entregue a quadro(). Serve para verificar efeitos no PC (ou na placa,
+// sem a matriz). Retorna o número de quadros gerados.
+uint32_t np_agendador_simular(np_agendador_t *a, uint64_t inicio_us, uint64_t duracao_us, np_agendador_quadro_t quadro,
+                              void *dados) {
+    uint32_t quadros = 0;
+    uint64_t agora = inicio_us;
+
+    while (np_agendador_ativo(a) && agora - inicio_us < duracao_us) {
+        if (avancar_camadas(a, agora)) {
+            quadro(agora, a->quadro, dados);
+            quadros++;
+        }
+        uint64_t prazo = np_agendador_proximo_prazo(a);
+        if (prazo == NP_EFEITO_FIM) break;
+        if (prazo > agora) agora = prazo;
+    }
+    return quadros;
+}
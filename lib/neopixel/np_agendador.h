@@ -0,0 +1,67 @@
+/**
+ * @file np_agendador.h
+ * @brief Agendador de efeitos sem bloqueio: camadas de sequências de efeitos compostas num quadro.
+ *
+ * Cada camada toca uma sequência de efeitos (np_efeitos.h) em sua própria tela; quando o prazo
+ * de alguma camada vence, o passo dela desenha o próximo quadro, as telas de todas as camadas
+ * ativas são compostas no quadro do agendador (somadas com saturação, ou misturadas com um alfa
+ * fixo, veja `np_agendador_misturar_camada()`) e o resultado vai para o callback `apresentar`,
+ * que no driver da matriz é o present sem espera da fita. Enquanto o agendador roda, ele é o
+ * dono do quadro.
+ *
+ * `np_agendador_avancar()` pode ser chamada do laço principal, de uma tarefa FreeRTOS ou do timer
+ * repetitivo de `np_agendador_iniciar_timer()`; cada chamada custa no máximo um quadro por
+ * camada. `np_agendador_simular()` toca as camadas em tempo acelerado, sem esperar nem
+ * apresentar, e entrega cada quadro composto a um callback: é o que os testes no PC usam.
+ */
+
+#ifndef NP_AGENDADOR_H
+#define NP_AGENDADOR_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "pico/time.h"
+#include "np_cor.h"
+#include "np_efeitos.h"
+
+#define NP_AGENDADOR_CAMADAS 3
+#define NP_AGENDADOR_ADITIVA 0xFFFF     // modo de composição padrão das camadas
+
+// Recebe um quadro composto de NP_EFEITO_LEDS LEDs e o instante em que ele foi desenhado
+typedef void (*np_agendador_quadro_t)(uint64_t instante_us, const np_cor_t *quadro, void *dados);
+
+typedef struct {
+    np_efeito_t *const *sequencia;
+    uint8_t n;
+    uint8_t atual;              // índice do efeito em andamento na sequência
+    bool repetir;
+    volatile bool ativa;        // só vira true depois da camada toda preenchida
+    uint64_t prazo;             // 0 = desenhar o primeiro quadro na próxima chamada
+    bool misturar;              // false = composição aditiva (padrão)
+    uint16_t alfa;              // opacidade 8.8 sobre as camadas de baixo, quando misturar
+    np_cor_t tela[NP_EFEITO_LEDS];
+} np_camada_t;
+
+typedef struct {
+    np_camada_t camadas[NP_AGENDADOR_CAMADAS];
+    np_cor_t *quadro;           // destino da composição (leds[] do driver)
+    np_agendador_quadro_t apresentar;
+    void *dados;                // repassado a apresentar
+    repeating_timer_t timer;
+    bool timer_ativo;
+} np_agendador_t;
+
+void np_agendador_init(np_agendador_t *a, np_cor_t *quadro, np_agendador_quadro_t apresentar, void *dados);
+void np_agendador_definir_camada(np_agendador_t *a, uint8_t camada, np_efeito_t *const *sequencia, uint8_t n,
+                                 bool repetir);
+void np_agendador_misturar_camada(np_agendador_t *a, uint8_t camada, uint16_t alfa);
+void np_agendador_parar(np_agendador_t *a, uint8_t camada);
+bool np_agendador_ativo(const np_agendador_t *a);
+bool np_agendador_avancar(np_agendador_t *a, uint64_t agora_us);
+uint64_t np_agendador_proximo_prazo(const np_agendador_t *a);
+bool np_agendador_iniciar_timer(np_agendador_t *a, uint32_t periodo_ms);
+void np_agendador_parar_timer(np_agendador_t *a);
+uint32_t np_agendador_simular(np_agendador_t *a, uint64_t inicio_us, uint64_t duracao_us, np_agendador_quadro_t quadro,
+                              void *dados);
+
+#endif
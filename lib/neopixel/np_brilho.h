@@ -0,0 +1,63 @@
+/**
+ * @file np_brilho.h
+ * @brief Brilho global e correção gama para NeoPixel em ponto fixo 8.8, sem float por canal.
+ *
+ * O RP2040 não tem FPU: `canal * brilho` em float vira uma chamada de soft-float para cada
+ * R, G e B de cada LED. Aqui o brilho é uma escala 8.8 (`NP_BRILHO_MAX` = 256 = 100 %) e a
+ * correção gama vem de uma tabela pronta em flash.
+ *
+ * Funcionamento:
+ * - `np_escalar()` multiplica um canal por uma escala 8.8 com arredondamento; serve para os
+ *   degradês dos efeitos (`np_escala_fracao(y + 1, NUM_LINHAS)` no lugar de `(y + 1.0f) / 5`).
+ * - `np_brilho_t` guarda a tabela de saída de 256 entradas do nível de brilho atual, já com a
+ *   gama aplicada (se ativada). Ela é recalculada só quando o nível muda (`np_brilho_set()`),
+ *   então o envio de um quadro custa uma consulta à tabela por canal.
+ * - As entradas da tabela também são 8.8: `np_brilho_aplicar()` usa só a parte inteira, e
+ *   `np_brilho_pontilhar()` acumula a parte fracionária de cada canal entre quadros (dithering
+ *   temporal), para que fades em brilho baixo não andem em degraus visíveis.
+ */
+
+#ifndef NP_BRILHO_H
+#define NP_BRILHO_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define NP_BRILHO_MAX 256       // escala 8.8 de 100 %
+
+typedef struct {
+    uint16_t escala;            // nível atual, 0..NP_BRILHO_MAX
+    bool gama;                  // aplica a curva gama antes da escala
+    uint16_t tabela[256];       // saída em 8.8 para cada valor de canal
+} np_brilho_t;
+
+// Escala 8.8 equivalente a num / den (arredondada, limitada a 100 %)
+static inline uint16_t np_escala_fracao(uint32_t num, uint32_t den) {
+    if (den == 0 || num >= den) {
+        return NP_BRILHO_MAX;
+    }
+    return (uint16_t)((num * NP_BRILHO_MAX + den / 2) / den);
+}
+
+// valor x escala 8.8, arredondado
+static inline uint8_t np_escalar(uint8_t valor, uint16_t escala) {
+    return (uint8_t)(((uint32_t)valor * escala + 128u) >> 8);
+}
+
+void np_brilho_init(np_brilho_t *b, bool gama);
+void np_brilho_set(np_brilho_t *b, uint16_t escala);
+void np_brilho_set_gama(np_brilho_t *b, bool gama);
+
+static inline uint8_t np_brilho_aplicar(const np_brilho_t *b, uint8_t valor) {
+    return (uint8_t)((b->tabela[valor] + 128u) >> 8);
+}
+
+// Como np_brilho_aplicar(), mas guardando em *resto a fração que não coube no byte; no quadro
+// seguinte ela é somada de volta, de modo que a média no tempo reproduz o valor 8.8 exato
+static inline uint8_t np_brilho_pontilhar(const np_brilho_t *b, uint8_t valor, uint8_t *resto) {
+    uint32_t soma = (uint32_t)b->tabela[valor] + *resto;
+    *resto = (uint8_t)soma;
+    return (uint8_t)(soma >> 8);
+}
+
+#endif
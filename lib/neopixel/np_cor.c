@@ -0,0 +1,74 @@
+/**
+ * @file np_cor.c
+ * @brief Conversão HSV → RGB e paletas prontas.
+ */
+
+#include "np_cor.h"
+
+// Arco-íris em 16 passos de matiz (np_hsv(i * 96, 255, 255))
+const np_paleta_t NP_PALETA_ARCO_IRIS = {{
+    NP_COR(255,   0,   0), NP_COR(255,  96,   0), NP_COR(255, 192,   0), NP_COR(223, 255,   0),
+    NP_COR(127, 255,   0), NP_COR( 31, 255,   0), NP_COR(  0, 255,  64), NP_COR(  0, 255, 160),
+    NP_COR(  0, 255, 255), NP_COR(  0, 159, 255), NP_COR(  0,  63, 255), NP_COR( 32,   0, 255),
+    NP_COR(128,   0, 255), NP_COR(224,   0, 255), NP_COR(255,   0, 191), NP_COR(255,   0,  95),
+}};
+
+// Preto → vermelho → amarelo → branco, e de volta ao vermelho escuro
+const np_paleta_t NP_PALETA_CALOR = {{
+    NP_COR(  0,   0,   0), NP_COR( 48,   0,   0), NP_COR( 96,   0,   0), NP_COR(160,   0,   0),
+    NP_COR(224,   0,   0), NP_COR(255,  32,   0), NP_COR(255,  96,   0), NP_COR(255, 160,   0),
+    NP_COR(255, 224,   0), NP_COR(255, 255,  64), NP_COR(255, 255, 160), NP_COR(255, 255, 255),
+    NP_COR(255, 192,  96), NP_COR(224,  96,   0), NP_COR(160,  32,   0), NP_COR( 80,   0,   0),
+}};
+
+// Azul escuro → azul → ciano → quase branco, e de volta
+const np_paleta_t NP_PALETA_OCEANO = {{
+    NP_COR(  0,   0,  32), NP_COR(  0,   0,  64), NP_COR(  0,   0, 112), NP_COR(  0,  16, 160),
+    NP_COR(  0,  48, 208), NP_COR(  0,  96, 255), NP_COR(  0, 160, 255), NP_COR(  0, 208, 224),
+    NP_COR( 32, 255, 224), NP_COR(128, 255, 255), NP_COR(192, 255, 255), NP_COR( 64, 208, 255),
+    NP_COR(  0, 128, 224), NP_COR(  0,  64, 176), NP_COR(  0,  16, 128), NP_COR(  0,   0,  64),
+}};
+
+// HSV → RGB sem divisão: setor = matiz / 256, posição no setor = byte baixo
+np_cor_t np_hsv(uint16_t matiz, uint8_t saturacao, uint8_t valor) {
+    matiz %= NP_MATIZ_MAX;
+    uint8_t setor = (uint8_t)(matiz >> 8);
+    uint8_t f = (uint8_t)matiz;
+
+    uint8_t p = np_mul8(valor, (uint8_t)(255 - saturacao));
+    uint8_t q = np_mul8(valor, (uint8_t)(255 - np_mul8(saturacao, f)));
+    uint8_t t = np_mul8(valor, (uint8_t)(255 - np_mul8(saturacao, (uint8_t)(255 - f))));
+
+    switch (setor) {
+    case 0:  return NP_COR(valor, t, p);
+    case 1:  return NP_COR(q, valor, p);
+    case 2:  return NP_COR(p, valor, t);
+    case 3:  return NP_COR(p, q, valor);
+    case 4:  return NP_COR(t, p, valor);
+    default: return NP_COR(valor, p, q);
+    }
+}
+
+// Preenche a paleta com um gradiente linear passando pelos n pontos (n >= 2), igualmente
+// espaçados da primeira à última entrada
+void np_paleta_gradiente(np_paleta_t *p, const np_cor_t *pontos, uint8_t n) {
+    if (n < 2) {
+        for (uint8_t i = 0; i < NP_PALETA_CORES; i++) {
+            p->cor[i] = n ? pontos[0] : NP_COR(0, 0, 0);
+        }
+        return;
+    }
+
+    for (uint32_t i = 0; i < NP_PALETA_CORES; i++) {
+        // posição da entrada i entre os pontos, em 1/256 de intervalo
+        uint32_t pos = i * (n - 1u) * 256u / (NP_PALETA_CORES - 1);
+        uint32_t k = pos >> 8;
+        uint32_t f = pos & 255u;
+        np_cor_t a = pontos[k];
+        np_cor_t b = pontos[k + 1 < n ? k + 1 : k];
+
+        p->cor[i] = NP_COR((uint8_t)((a.R * (256u - f) + b.R * f + 128u) >> 8),
+                           (uint8_t)((a.G * (256u - f) + b.G * f + 128u) >> 8),
+                           (uint8_t)((a.B * (256u - f) + b.B * f + 128u) >> 8));
+    }
+}
@@ -0,0 +1,115 @@
+/**
+ * @file np_cor.h
+ * @brief Cores para NeoPixel em inteiros: HSV → RGB, paletas de 16 cores com interpolação e
+ * mistura de quadros (alfa global, alfa por pixel e soma com saturação).
+ *
+ * `np_cor_t` tem o mesmo layout do `npLED_t` dos drivers (G, R, B: a ordem do fio), então os
+ * quadros dos efeitos (leds[] e as telas do agendador) são passados direto, sem cópia.
+ *
+ * - Matiz vai de 0 a `NP_MATIZ_MAX` - 1 (1536): seis setores de 256 passos, então a posição
+ *   dentro do setor é o byte baixo e a conversão não precisa de divisão. Saturação e valor são
+ *   0..255; os produtos x/255 são arredondados exatamente por `np_mul8()`.
+ * - Uma paleta tem 16 cores ao longo de um índice de 0 a 255; entre duas entradas a cor é
+ *   interpolada, e depois da última o gradiente volta à primeira (paletas cíclicas).
+ * - As misturas percorrem os quadros como 3·n bytes, com ponteiros `restrict`, conta fixa e sem
+ *   desvio no corpo do laço. São `static inline`: com n constante (LED_COUNT) o compilador
+ *   desenrola o laço no ponto de chamada.
+ */
+
+#ifndef NP_COR_H
+#define NP_COR_H
+
+#include <stdint.h>
+
+typedef struct {
+    uint8_t G, R, B;
+} np_cor_t;
+
+_Static_assert(sizeof(np_cor_t) == 3, "np_cor_t precisa ter 3 bytes (quadros vistos como bytes)");
+
+#define NP_COR(r, g, b) ((np_cor_t){ .G = (g), .R = (r), .B = (b) })
+
+#define NP_MATIZ_SETOR 256
+#define NP_MATIZ_MAX (6 * NP_MATIZ_SETOR)
+
+#define NP_PALETA_CORES 16
+
+typedef struct {
+    np_cor_t cor[NP_PALETA_CORES];
+} np_paleta_t;
+
+extern const np_paleta_t NP_PALETA_ARCO_IRIS;
+extern const np_paleta_t NP_PALETA_CALOR;
+extern const np_paleta_t NP_PALETA_OCEANO;
+
+// a * b / 255, arredondado (exato para todos os pares de bytes)
+static inline uint8_t np_mul8(uint8_t a, uint8_t b) {
+    uint32_t x = (uint32_t)a * b + 128u;
+    return (uint8_t)((x + (x >> 8)) >> 8);
+}
+
+np_cor_t np_hsv(uint16_t matiz, uint8_t saturacao, uint8_t valor);
+void np_paleta_gradiente(np_paleta_t *p, const np_cor_t *pontos, uint8_t n);
+
+// Cor da paleta no índice (0..255): entrada indice / 16, interpolada em direção à seguinte
+static inline np_cor_t np_paleta_cor(const np_paleta_t *p, uint8_t indice) {
+    np_cor_t a = p->cor[indice >> 4];
+    np_cor_t b = p->cor[((indice >> 4) + 1) & (NP_PALETA_CORES - 1)];
+    uint32_t f = (uint32_t)(indice & 15) << 4;     // 0..240 em 1/256
+    uint32_t g = 256u - f;
+
+    return NP_COR((uint8_t)((a.R * g + b.R * f + 128u) >> 8),
+                  (uint8_t)((a.G * g + b.G * f + 128u) >> 8),
+                  (uint8_t)((a.B * g + b.B * f + 128u) >> 8));
+}
+
+// destino = destino · (1 - alfa) + origem · alfa, com alfa em 8.8 (0..256 = 0..100 %)
+static inline void np_misturar(np_cor_t *restrict destino, const np_cor_t *restrict origem, uint32_t n,
+                               uint16_t alfa) {
+    uint8_t *restrict d = (uint8_t *)destino;
+    const uint8_t *restrict o = (const uint8_t *)origem;
+    uint32_t beta = 256u - alfa;
+
+    for (uint32_t i = 0; i < 3 * n; i++) {
+        d[i] = (uint8_t)((d[i] * beta + o[i] * (uint32_t)alfa + 128u) >> 8);
+    }
+}
+
+// Como np_misturar(), com um alfa (0..255) por pixel
+static inline void np_misturar_alfas(np_cor_t *restrict destino, const np_cor_t *restrict origem,
+                                     const uint8_t *restrict alfas, uint32_t n) {
+    uint8_t *restrict d = (uint8_t *)destino;
+    const uint8_t *restrict o = (const uint8_t *)origem;
+
+    for (uint32_t i = 0; i < n; i++) {
+        uint32_t a = alfas[i];
+        uint32_t x0 = d[3 * i] * (255u - a) + o[3 * i] * a + 128u;
+        uint32_t x1 = d[3 * i + 1] * (255u - a) + o[3 * i + 1] * a + 128u;
+        uint32_t x2 = d[3 * i + 2] * (255u - a) + o[3 * i + 2] * a + 128u;
+        d[3 * i] = (uint8_t)((x0 + (x0 >> 8)) >> 8);
+        d[3 * i + 1] = (uint8_t)((x1 + (x1 >> 8)) >> 8);
+        d[3 * i + 2] = (uint8_t)((x2 + (x2 >> 8)) >> 8);
+    }
+}
+
+// destino += origem, canal a canal, saturando em 255 (composição aditiva)
+static inline void np_somar(np_cor_t *restrict destino, const np_cor_t *restrict origem, uint32_t n) {
+    uint8_t *restrict d = (uint8_t *)destino;
+    const uint8_t *restrict o = (const uint8_t *)origem;
+
+    for (uint32_t i = 0; i < 3 * n; i++) {
+        uint32_t s = (uint32_t)d[i] + o[i];
+        d[i] = (uint8_t)(s > 255u ? 255u : s);
+    }
+}
+
+// Multiplica todos os canais por uma escala 8.8 (fades, rastros)
+static inline void np_escurecer(np_cor_t *quadro, uint32_t n, uint16_t escala) {
+    uint8_t *q = (uint8_t *)quadro;
+
+    for (uint32_t i = 0; i < 3 * n; i++) {
+        q[i] = (uint8_t)((q[i] * (uint32_t)escala + 128u) >> 8);
+    }
+}
+
+#endif
@@ -0,0 +1,194 @@
+/**
+ * @file np_efeitos.c
+ * @brief Passos dos efeitos da matriz 5x5.
+ *
+ * Degradês usam escalas 8.8 (np_brilho.h) em vez de multiplicar cada canal por um float.
+ */
+
+#include <stdlib.h>
+#include "np_efeitos.h"
+#include "np_brilho.h"
+
+#define LADO NP_EFEITO_LADO
+#define LEDS NP_EFEITO_LEDS
+
+static const uint8_t ordem_espiral[LEDS][2] = {
+    {0,0},{1,0},{2,0},{3,0},{4,0},
+    {4,1},{4,2},{4,3},{4,4},
+    {3,4},{2,4},{1,4},{0,4},
+    {0,3},{0,2},{0,1},
+    {1,1},{2,1},{3,1},
+    {3,2},{3,3},
+    {2,3},{1,3},
+    {1,2},{2,2}
+};
+
+static const uint8_t ordem_espiral_inversa[LEDS][2] = {
+    {2,2},{1,2},{1,3},{2,3},{3,3},
+    {3,2},{3,1},{2,1},{1,1},
+    {0,1},{0,2},{0,3},{0,4},
+    {1,4},{2,4},{3,4},
+    {4,4},{4,3},{4,2},
+    {4,1},{4,0},
+    {3,0},{2,0},
+    {1,0},{0,0}
+};
+
+static void limpar(np_cor_t *tela) {
+    for (int i = 0; i < LEDS; ++i) {
+        tela[i] = NP_COR(0, 0, 0);
+    }
+}
+
+// A tela está em ordem lógica: uma fileira é um trecho contíguo, uma coluna é um passo de LADO
+static void preencher_fileira(np_cor_t *tela, int y, np_cor_t cor) {
+    for (int x = 0; x < LADO; x++) {
+        tela[y * LADO + x] = cor;
+    }
+}
+
+static void preencher_coluna(np_cor_t *tela, int x, np_cor_t cor) {
+    for (int y = 0; y < LADO; y++) {
+        tela[y * LADO + x] = cor;
+    }
+}
+
+static np_cor_t cor_escalada(const np_efeito_t *e, uint16_t escala) {
+    return NP_COR(np_escalar(e->r, escala), np_escalar(e->g, escala), np_escalar(e->b, escala));
+}
+
+// Fecha o passo: avança o quadro e devolve o prazo do próximo
+static uint64_t proximo_quadro(np_efeito_t *e, uint64_t agora_us) {
+    e->quadro++;
+    return agora_us + e->intervalo_us;
+}
+
+// Prepara o efeito a partir do primeiro quadro; a tela fica a cargo de quem toca (o agendador
+// aponta para a camada, um laço bloqueante para leds[])
+void np_efeito_iniciar(np_efeito_t *e, np_efeito_passo_t passo, uint8_t r, uint8_t g, uint8_t b, uint16_t delay_ms) {
+    e->passo = passo;
+    e->r = r;
+    e->g = g;
+    e->b = b;
+    e->intervalo_us = (uint32_t)delay_ms * 1000u;
+    e->quadro = 0;
+    e->tela = NULL;
+    e->dados = NULL;
+}
+
+void np_efeito_reiniciar(np_efeito_t *e) {
+    e->quadro = 0;
+}
+
+static uint64_t espiral(np_efeito_t *e, uint64_t agora_us, const uint8_t (*ordem)[2]) {
+    if (e->quadro >= LEDS) return NP_EFEITO_FIM;
+
+    limpar(e->tela);
+    for (int i = 0; i <= e->quadro; ++i) {
+        e->tela[ordem[i][1] * LADO + ordem[i][0]] = NP_COR(e->r, e->g, e->b);
+    }
+    return proximo_quadro(e, agora_us);
+}
+
+// Preenche a matriz em espiral do canto superior esquerdo ao centro (um LED a mais por quadro)
+uint64_t np_efeito_espiral(np_efeito_t *e, uint64_t agora_us) {
+    return espiral(e, agora_us, ordem_espiral);
+}
+
+// Preenche a matriz em espiral do centro ao canto superior esquerdo
+uint64_t np_efeito_espiral_inversa(np_efeito_t *e, uint64_t agora_us) {
+    return espiral(e, agora_us, ordem_espiral_inversa);
+}
+
+// Onda vertical: 100 % na linha da fase, 25 % a menos por linha de distância
+uint64_t np_efeito_onda_vertical(np_efeito_t *e, uint64_t agora_us) {
+    int fase = e->quadro;
+    if (fase >= LADO + 3) return NP_EFEITO_FIM;
+
+    limpar(e->tela);
+    for (int y = 0; y < LADO; ++y) {
+        int distancia = abs(fase - y);
+        if (distancia >= 4) continue;
+        preencher_fileira(e->tela, y, cor_escalada(e, (uint16_t)(NP_BRILHO_MAX - distancia * (NP_BRILHO_MAX / 4))));
+    }
+    return proximo_quadro(e, agora_us);
+}
+
+// Onda vertical com brilho progressivo proporcional à linha
+uint64_t np_efeito_onda_vertical_brilho(np_efeito_t *e, uint64_t agora_us) {
+    int passo = e->quadro;
+    if (passo >= LADO) return NP_EFEITO_FIM;
+
+    limpar(e->tela);
+    for (int y = 0; y <= passo; ++y) {
+        preencher_fileira(e->tela, y, cor_escalada(e, np_escala_fracao((uint32_t)y + 1, LADO)));
+    }
+    return proximo_quadro(e, agora_us);
+}
+
+uint64_t np_efeito_fileiras(np_efeito_t *e, uint64_t agora_us) {
+    int y = e->quadro;
+    if (y >= LADO) return NP_EFEITO_FIM;
+
+    limpar(e->tela);
+    preencher_fileira(e->tela, y, cor_escalada(e, np_escala_fracao((uint32_t)y + 1, LADO)));
+    return proximo_quadro(e, agora_us);
+}
+
+uint64_t np_efeito_fileiras_reverso(np_efeito_t *e, uint64_t agora_us) {
+    if (e->quadro >= LADO) return NP_EFEITO_FIM;
+    int y = LADO - 1 - e->quadro;
+
+    limpar(e->tela);
+    preencher_fileira(e->tela, y, cor_escalada(e, np_escala_fracao((uint32_t)(LADO - y), LADO)));
+    return proximo_quadro(e, agora_us);
+}
+
+uint64_t np_efeito_colunas(np_efeito_t *e, uint64_t agora_us) {
+    int x = e->quadro;
+    if (x >= LADO) return NP_EFEITO_FIM;
+
+    limpar(e->tela);
+    preencher_coluna(e->tela, x, cor_escalada(e, np_escala_fracao((uint32_t)x + 1, LADO)));
+    return proximo_quadro(e, agora_us);
+}
+
+uint64_t np_efeito_colunas_reverso(np_efeito_t *e, uint64_t agora_us) {
+    if (e->quadro >= LADO) return NP_EFEITO_FIM;
+    int x = LADO - 1 - e->quadro;
+
+    limpar(e->tela);
+    preencher_coluna(e->tela, x, cor_escalada(e, np_escala_fracao((uint32_t)(LADO - x), LADO)));
+    return proximo_quadro(e, agora_us);
+}
+
+// Paleta (e->dados, ou o arco-íris se NULL) correndo na diagonal: cada LED pega o índice
+// (x + y) * 24 + 4 * quadro, então em 64 quadros o gradiente dá uma volta completa. O quadro sai
+// a 1/4 da intensidade, como as cores de teste dos projetos.
+uint64_t np_efeito_paleta(np_efeito_t *e, uint64_t agora_us) {
+    const np_paleta_t *paleta = e->dados ? (const np_paleta_t *)e->dados : &NP_PALETA_ARCO_IRIS;
+    if (e->quadro >= 64) return NP_EFEITO_FIM;
+
+    for (int y = 0; y < LADO; y++) {
+        for (int x = 0; x < LADO; x++) {
+            e->tela[y * LADO + x] = np_paleta_cor(paleta, (uint8_t)((x + y) * 24 + e->quadro * 4));
+        }
+    }
+    np_escurecer(e->tela, LEDS, NP_BRILHO_MAX / 4);
+    return proximo_quadro(e, agora_us);
+}
+
+// Texto (e->dados) entrando pela direita e saindo pela esquerda, uma coluna por quadro
+uint64_t np_efeito_texto_rolante(np_efeito_t *e, uint64_t agora_us) {
+    const char *texto = (const char *)e->dados;
+    int coluna = (int)e->quadro - LADO;
+    if (texto == NULL || coluna >= np_texto_largura(texto)) return NP_EFEITO_FIM;
+
+    uint32_t restante = np_texto_janela(texto, coluna);
+    int bit;
+    limpar(e->tela);
+    while ((bit = np_glifo_proximo(&restante)) >= 0) {
+        e->tela[LEDS - 1 - bit] = NP_COR(e->r, e->g, e->b);
+    }
+    return proximo_quadro(e, agora_us);
+}
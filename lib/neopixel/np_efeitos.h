@@ -0,0 +1,54 @@
+/**
+ * @file np_efeitos.h
+ * @brief Efeitos da matriz 5x5 como passos sem bloqueio, para o agendador ou para laços próprios.
+ *
+ * Um efeito é um passo (`np_efeito_passo_t`) que desenha o quadro atual inteiro, a partir do
+ * zero, em `e->tela` e devolve o instante (us) em que o próximo quadro deve ser desenhado, ou
+ * `NP_EFEITO_FIM` se não há mais quadros. O passo não envia nada à fita nem espera: quem chama
+ * (`np_agendador` ou um laço com sleep) decide quando apresentar.
+ *
+ * A tela tem `NP_EFEITO_LEDS` LEDs em ordem lógica, como a imagem de np_matriz.h: linha a linha,
+ * de cima para baixo, com x crescendo para a direita (tela[y * NP_EFEITO_LADO + x]).
+ */
+
+#ifndef NP_EFEITOS_H
+#define NP_EFEITOS_H
+
+#include <stdint.h>
+#include "np_cor.h"
+#include "np_glifos.h"
+
+#define NP_EFEITO_LADO NP_GLIFO_LADO
+#define NP_EFEITO_LEDS NP_GLIFO_LEDS
+
+// Prazo devolvido pelo passo de um efeito que já terminou
+#define NP_EFEITO_FIM UINT64_MAX
+
+typedef struct np_efeito np_efeito_t;
+
+typedef uint64_t (*np_efeito_passo_t)(np_efeito_t *e, uint64_t agora_us);
+
+struct np_efeito {
+    np_efeito_passo_t passo;
+    uint8_t r, g, b;
+    uint32_t intervalo_us;      // tempo entre quadros
+    uint16_t quadro;            // próximo quadro a desenhar
+    np_cor_t *tela;             // NP_EFEITO_LEDS LEDs onde desenhar (leds[] ou uma camada)
+    const void *dados;          // parâmetro extra do efeito (texto, paleta)
+};
+
+void np_efeito_iniciar(np_efeito_t *e, np_efeito_passo_t passo, uint8_t r, uint8_t g, uint8_t b, uint16_t delay_ms);
+void np_efeito_reiniciar(np_efeito_t *e);
+
+uint64_t np_efeito_espiral(np_efeito_t *e, uint64_t agora_us);
+uint64_t np_efeito_espiral_inversa(np_efeito_t *e, uint64_t agora_us);
+uint64_t np_efeito_onda_vertical(np_efeito_t *e, uint64_t agora_us);
+uint64_t np_efeito_onda_vertical_brilho(np_efeito_t *e, uint64_t agora_us);
+uint64_t np_efeito_fileiras(np_efeito_t *e, uint64_t agora_us);
+uint64_t np_efeito_fileiras_reverso(np_efeito_t *e, uint64_t agora_us);
+uint64_t np_efeito_colunas(np_efeito_t *e, uint64_t agora_us);
+uint64_t np_efeito_colunas_reverso(np_efeito_t *e, uint64_t agora_us);
+uint64_t np_efeito_texto_rolante(np_efeito_t *e, uint64_t agora_us);
+uint64_t np_efeito_paleta(np_efeito_t *e, uint64_t agora_us);
+
+#endif
@@ -0,0 +1,148 @@
+/**
+ * @file np_glifos.c
+ * @brief Atlas de glifos 5x5 e composição de texto rolante em bits.
+ */
+
+#include <stdbool.h>
+#include "np_glifos.h"
+
+#define NP_GLIFO_PRIMEIRO ' '
+#define NP_GLIFO_ULTIMO 'o'
+
+// Máscara da coluna 0 (um bit por linha, a cada 5 bits); a coluna x é ela >> x
+#define COLUNA_0 (0x108421u << 4)
+
+static const uint32_t atlas[NP_GLIFO_ULTIMO - NP_GLIFO_PRIMEIRO + 1] = {
+    ['0' - NP_GLIFO_PRIMEIRO] = NP_GLIFO(0b01110, 0b01010, 0b01010, 0b01010, 0b01110),
+    ['1' - NP_GLIFO_PRIMEIRO] = NP_GLIFO(0b00100, 0b01100, 0b00100, 0b00100, 0b01110),
+    ['2' - NP_GLIFO_PRIMEIRO] = NP_GLIFO(0b01110, 0b00010, 0b01110, 0b01000, 0b01110),
+    ['3' - NP_GLIFO_PRIMEIRO] = NP_GLIFO(0b01110, 0b00010, 0b01110, 0b00010, 0b01110),
+    ['4' - NP_GLIFO_PRIMEIRO] = NP_GLIFO(0b01010, 0b01010, 0b01110, 0b00010, 0b00010),
+    ['5' - NP_GLIFO_PRIMEIRO] = NP_GLIFO(0b01110, 0b01000, 0b01110, 0b00010, 0b01110),
+    ['6' - NP_GLIFO_PRIMEIRO] = NP_GLIFO(0b01110, 0b01000, 0b01110, 0b01010, 0b01110),
+    ['7' - NP_GLIFO_PRIMEIRO] = NP_GLIFO(0b01110, 0b00010, 0b00100, 0b00100, 0b00100),
+    ['8' - NP_GLIFO_PRIMEIRO] = NP_GLIFO(0b01110, 0b01010, 0b01110, 0b01010, 0b01110),
+    ['9' - NP_GLIFO_PRIMEIRO] = NP_GLIFO(0b01110, 0b01010, 0b01110, 0b00010, 0b01110),
+    ['A' - NP_GLIFO_PRIMEIRO] = NP_GLIFO(0b01110, 0b10001, 0b11111, 0b10001, 0b10001),
+    ['B' - NP_GLIFO_PRIMEIRO] = NP_GLIFO(0b11110, 0b10001, 0b11110, 0b10001, 0b11110),
+    ['C' - NP_GLIFO_PRIMEIRO] = NP_GLIFO(0b01111, 0b10000, 0b10000, 0b10000, 0b01111),
+    ['D' - NP_GLIFO_PRIMEIRO] = NP_GLIFO(0b11110, 0b10001, 0b10001, 0b10001, 0b11110),
+    ['E' - NP_GLIFO_PRIMEIRO] = NP_GLIFO(0b11111, 0b10000, 0b11110, 0b10000, 0b11111),
+    ['F' - NP_GLIFO_PRIMEIRO] = NP_GLIFO(0b11111, 0b10000, 0b11110, 0b10000, 0b10000),
+    ['G' - NP_GLIFO_PRIMEIRO] = NP_GLIFO(0b01111, 0b10000, 0b10011, 0b10001, 0b01111),
+    ['H' - NP_GLIFO_PRIMEIRO] = NP_GLIFO(0b10001, 0b10001, 0b11111, 0b10001, 0b10001),
+    ['I' - NP_GLIFO_PRIMEIRO] = NP_GLIFO(0b01110, 0b00100, 0b00100, 0b00100, 0b01110),
+    ['J' - NP_GLIFO_PRIMEIRO] = NP_GLIFO(0b00111, 0b00010, 0b00010, 0b10010, 0b01100),
+    ['K' - NP_GLIFO_PRIMEIRO] = NP_GLIFO(0b10010, 0b10100, 0b11000, 0b10100, 0b10010),
+    ['L' - NP_GLIFO_PRIMEIRO] = NP_GLIFO(0b10000, 0b10000, 0b10000, 0b10000, 0b11111),
+    ['M' - NP_GLIFO_PRIMEIRO] = NP_GLIFO(0b10001, 0b11011, 0b10101, 0b10001, 0b10001),
+    ['N' - NP_GLIFO_PRIMEIRO] = NP_GLIFO(0b10001, 0b11001, 0b10101, 0b10011, 0b10001),
+    ['O' - NP_GLIFO_PRIMEIRO] = NP_GLIFO(0b01110, 0b10001, 0b10001, 0b10001, 0b01110),
+    ['P' - NP_GLIFO_PRIMEIRO] = NP_GLIFO(0b11110, 0b10001, 0b11110, 0b10000, 0b10000),
+    ['Q' - NP_GLIFO_PRIMEIRO] = NP_GLIFO(0b01110, 0b10001, 0b10101, 0b10010, 0b01101),
+    ['R' - NP_GLIFO_PRIMEIRO] = NP_GLIFO(0b11110, 0b10001, 0b11110, 0b10100, 0b10010),
+    ['S' - NP_GLIFO_PRIMEIRO] = NP_GLIFO(0b01111, 0b10000, 0b01110, 0b00001, 0b11110),
+    ['T' - NP_GLIFO_PRIMEIRO] = NP_GLIFO(0b11111, 0b00100, 0b00100, 0b00100, 0b00100),
+    ['U' - NP_GLIFO_PRIMEIRO] = NP_GLIFO(0b10001, 0b10001, 0b10001, 0b10001, 0b01110),
+    ['V' - NP_GLIFO_PRIMEIRO] = NP_GLIFO(0b10001, 0b10001, 0b10001, 0b01010, 0b00100),
+    ['W' - NP_GLIFO_PRIMEIRO] = NP_GLIFO(0b10001, 0b10001, 0b10101, 0b11011, 0b10001),
+    ['X' - NP_GLIFO_PRIMEIRO] = NP_GLIFO(0b10001, 0b01010, 0b00100, 0b01010, 0b10001),
+    ['Y' - NP_GLIFO_PRIMEIRO] = NP_GLIFO(0b10001, 0b01010, 0b00100, 0b00100, 0b00100),
+    ['Z' - NP_GLIFO_PRIMEIRO] = NP_GLIFO(0b11111, 0b00010, 0b00100, 0b01000, 0b11111),
+    ['+' - NP_GLIFO_PRIMEIRO] = NP_GLIFO(0b00000, 0b00100, 0b01110, 0b00100, 0b00000),
+    ['-' - NP_GLIFO_PRIMEIRO] = NP_GLIFO(0b00000, 0b00000, 0b01110, 0b00000, 0b00000),
+    ['.' - NP_GLIFO_PRIMEIRO] = NP_GLIFO(0b00000, 0b00000, 0b00000, 0b00000, 0b00100),
+    [':' - NP_GLIFO_PRIMEIRO] = NP_GLIFO(0b00000, 0b00100, 0b00000, 0b00100, 0b00000),
+    ['%' - NP_GLIFO_PRIMEIRO] = NP_GLIFO(0b11001, 0b11010, 0b00100, 0b01011, 0b10011),
+    ['o' - NP_GLIFO_PRIMEIRO] = NP_GLIFO(0b01100, 0b10010, 0b10010, 0b01100, 0b00000),
+    [' ' - NP_GLIFO_PRIMEIRO] = NP_GLIFO(0b00000, 0b00000, 0b00000, 0b00000, 0b00000),
+};
+
+uint32_t np_glifo(char c) {
+    if (c >= 'a' && c <= 'z' && c != 'o') {
+        c = (char)(c - 'a' + 'A');
+    }
+    if (c < NP_GLIFO_PRIMEIRO || c > NP_GLIFO_ULTIMO) {
+        return 0;
+    }
+    return atlas[c - NP_GLIFO_PRIMEIRO];
+}
+
+// Move a coluna x_origem do glifo para x_destino (na mesma linha de cada bit)
+static inline uint32_t mover_coluna(uint32_t glifo, int x_origem, int x_destino) {
+    uint32_t coluna = glifo & (COLUNA_0 >> x_origem);
+    return x_destino >= x_origem ? coluna >> (x_destino - x_origem) : coluna << (x_origem - x_destino);
+}
+
+// Desloca o glifo dx colunas para a direita e dy linhas para baixo (negativos: esquerda/cima);
+// o que sai da área 5x5 é descartado
+uint32_t np_glifo_deslocar(uint32_t glifo, int dx, int dy) {
+    if (dx <= -NP_GLIFO_LADO || dx >= NP_GLIFO_LADO || dy <= -NP_GLIFO_LADO || dy >= NP_GLIFO_LADO) {
+        return 0;
+    }
+
+    if (dy > 0) {
+        glifo >>= NP_GLIFO_LADO * dy;
+    }
+    else if (dy < 0) {
+        glifo = (glifo << (NP_GLIFO_LADO * -dy)) & NP_GLIFO_MASCARA;
+    }
+    if (dx == 0) {
+        return glifo;
+    }
+
+    uint32_t resultado = 0;
+    for (int x = 0; x < NP_GLIFO_LADO; x++) {
+        int destino = x + dx;
+        if (destino >= 0 && destino < NP_GLIFO_LADO) {
+            resultado |= mover_coluna(glifo, x, destino);
+        }
+    }
+    return resultado;
+}
+
+// Colunas ocupadas pelo glifo no texto: da primeira à última coluna acesa (espaço: 2 colunas)
+static void limites(uint32_t glifo, int *inicio, int *largura) {
+    uint32_t ocupadas = glifo | glifo >> 5 | glifo >> 10 | glifo >> 15 | glifo >> 20;
+    ocupadas &= 0x1Fu;      // bit 4 = coluna 0
+    if (ocupadas == 0) {
+        *inicio = 0;
+        *largura = 2;
+        return;
+    }
+    *inicio = __builtin_clz(ocupadas) - 27;
+    *largura = NP_GLIFO_LADO - *inicio - __builtin_ctz(ocupadas);
+}
+
+// Largura do texto em colunas, com uma coluna livre entre os caracteres
+int np_texto_largura(const char *texto) {
+    int largura = 0;
+    for (; *texto; texto++) {
+        int inicio, w;
+        limites(np_glifo(*texto), &inicio, &w);
+        largura += w + (texto[1] ? 1 : 0);
+    }
+    return largura;
+}
+
+// Janela 5x5 do texto a partir da coluna indicada (negativa = espaço antes do texto). Para
+// rolar da direita para a esquerda, basta mostrar as janelas -5, -4, ... até a largura.
+uint32_t np_texto_janela(const char *texto, int coluna) {
+    uint32_t janela = 0;
+    int x = 0;      // coluna do texto onde começa o caractere atual
+
+    for (; *texto && x < coluna + NP_GLIFO_LADO; texto++) {
+        uint32_t glifo = np_glifo(*texto);
+        int inicio, largura;
+        limites(glifo, &inicio, &largura);
+
+        for (int c = 0; c < largura; c++) {
+            int destino = x + c - coluna;
+            if (destino >= 0 && destino < NP_GLIFO_LADO) {
+                janela |= mover_coluna(glifo, inicio + c, destino);
+            }
+        }
+        x += largura + 1;
+    }
+    return janela;
+}
@@ -0,0 +1,54 @@
+/**
+ * @file np_glifos.h
+ * @brief Atlas de glifos 5x5 empacotados em 25 bits, para dígitos, letras e ícones na matriz.
+ *
+ * Cada glifo é um uint32_t com um bit por LED: a linha y ocupa os bits 24 - 5y .. 20 - 5y, com
+ * a coluna 0 (esquerda) no bit mais significativo da linha. Assim `NP_GLIFO()` se escreve
+ * como o desenho, uma linha binária por argumento, e o pixel (x, y) é o bit 24 - (5y + x):
+ * o mesmo que a posição y * 5 + x da imagem lógica da matriz lida de trás para frente.
+ *
+ * Desenhar um glifo é percorrer os bits acesos (`np_glifo_proximo()`) e pintar leds[24 - bit];
+ * deslocamentos e a janela de um texto rolando são feitos com shifts e máscaras sobre os
+ * 25 bits, sem tabelas de índices por símbolo.
+ *
+ * `np_glifo()` cobre os dígitos, as letras maiúsculas (minúsculas são convertidas), o espaço
+ * e + - . : %. Como na fonte grande do display, 'o' é o símbolo de grau.
+ */
+
+#ifndef NP_GLIFOS_H
+#define NP_GLIFOS_H
+
+#include <stdint.h>
+
+#define NP_GLIFO_LADO 5
+#define NP_GLIFO_LEDS 25
+#define NP_GLIFO_MASCARA 0x1FFFFFFu
+
+#define NP_GLIFO(l0, l1, l2, l3, l4) \
+    ((uint32_t)(l0) << 20 | (uint32_t)(l1) << 15 | (uint32_t)(l2) << 10 | (uint32_t)(l3) << 5 | (uint32_t)(l4))
+
+// Ícones
+#define NP_ICONE_X          NP_GLIFO(0b10001, 0b01010, 0b00100, 0b01010, 0b10001)
+#define NP_ICONE_CORACAO    NP_GLIFO(0b01010, 0b11111, 0b11111, 0b01110, 0b00100)
+#define NP_ICONE_SETA_CIMA  NP_GLIFO(0b00100, 0b01110, 0b10101, 0b00100, 0b00100)
+#define NP_ICONE_SETA_BAIXO NP_GLIFO(0b00100, 0b00100, 0b10101, 0b01110, 0b00100)
+#define NP_ICONE_OK         NP_GLIFO(0b00000, 0b00001, 0b00010, 0b10100, 0b01000)
+#define NP_ICONE_SORRISO    NP_GLIFO(0b01010, 0b01010, 0b00000, 0b10001, 0b01110)
+#define NP_ICONE_CHEIO      NP_GLIFO_MASCARA
+
+uint32_t np_glifo(char c);
+uint32_t np_glifo_deslocar(uint32_t glifo, int dx, int dy);
+int np_texto_largura(const char *texto);
+uint32_t np_texto_janela(const char *texto, int coluna);
+
+// Próximo bit aceso do glifo (posição lógica 24 - bit), apagando-o de *restante; -1 no fim
+static inline int np_glifo_proximo(uint32_t *restante) {
+    if (*restante == 0) {
+        return -1;
+    }
+    int bit = __builtin_ctz(*restante);
+    *restante &= *restante - 1;
+    return bit;
+}
+
+#endif
@@ -0,0 +1,16 @@
+/**
+ * @file np_matriz.c
+ * @brief Montagem da tabela de mapeamento de matrizes NeoPixel.
+ */
+
+#include "np_matriz.h"
+
+// Preenche mapa[y * largura + x] com o índice na fita de cada pixel (largura x altura entradas)
+void np_matriz_mapear(uint8_t *mapa, uint8_t largura, uint8_t altura, bool serpentina,
+                      np_matriz_rotacao_t rotacao) {
+    for (uint8_t y = 0; y < altura; y++) {
+        for (uint8_t x = 0; x < largura; x++) {
+            mapa[y * largura + x] = (uint8_t)np_matriz_indice(x, y, largura, altura, serpentina, rotacao);
+        }
+    }
+}
@@ -0,0 +1,61 @@
+/**
+ * @file np_matriz.h
+ * @brief Mapeamento (x, y) → índice na fita para matrizes de LEDs NeoPixel.
+ *
+ * Uma matriz é uma fita dobrada em linhas físicas. O índice de cada pixel depende de três
+ * coisas: as dimensões, se a fita volta em zigue-zague (serpentina: linhas ímpares correm ao
+ * contrário) e de quanto a imagem está girada em relação à fita.
+ *
+ * Coordenadas lógicas: (0, 0) no canto superior esquerdo da imagem, x para a direita, y para
+ * baixo. Sem rotação, a fita começa em (0, 0) e corre na direção de x; com rotação, a imagem
+ * é girada (no sentido horário) sobre a fita. Na BitDogLab (fita começando no canto inferior
+ * direito, em zigue-zague) a configuração é serpentina com rotação de 180°.
+ *
+ * `np_matriz_indice()` é só aritmética inteira e comparações, e `np_matriz_mapear()`
+ * a aplica uma vez para montar a tabela (índice lógico y * largura + x → índice na fita) que os
+ * drivers consultam no envio, no lugar de refazer a conta a cada pixel.
+ */
+
+#ifndef NP_MATRIZ_H
+#define NP_MATRIZ_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef enum {
+    NP_MATRIZ_ROT_0 = 0,
+    NP_MATRIZ_ROT_90,
+    NP_MATRIZ_ROT_180,
+    NP_MATRIZ_ROT_270,
+} np_matriz_rotacao_t;
+
+// Índice na fita do pixel lógico (x, y) de uma imagem largura x altura
+static inline uint16_t np_matriz_indice(uint8_t x, uint8_t y, uint8_t largura, uint8_t altura,
+                                        bool serpentina, np_matriz_rotacao_t rotacao) {
+    uint8_t fx, fy, por_linha;      // posição na fita, em linhas físicas de por_linha LEDs
+
+    switch (rotacao) {
+    case NP_MATRIZ_ROT_90:
+        fx = (uint8_t)(altura - 1 - y); fy = x; por_linha = altura;
+        break;
+    case NP_MATRIZ_ROT_180:
+        fx = (uint8_t)(largura - 1 - x); fy = (uint8_t)(altura - 1 - y); por_linha = largura;
+        break;
+    case NP_MATRIZ_ROT_270:
+        fx = y; fy = (uint8_t)(largura - 1 - x); por_linha = altura;
+        break;
+    default:
+        fx = x; fy = y; por_linha = largura;
+        break;
+    }
+
+    if (serpentina && (fy & 1)) {
+        fx = (uint8_t)(por_linha - 1 - fx);
+    }
+    return (uint16_t)(fy * por_linha + fx);
+}
+
+void np_matriz_mapear(uint8_t *mapa, uint8_t largura, uint8_t altura, bool serpentina,
+                      np_matriz_rotacao_t rotacao);
+
+#endif
@@ -0,0 +1,184 @@
+/**
+ * @file teste_sinal_ar.c
+ * @brief Estatística das séries AR(p) em Q15 contra a teoria e contra o mesmo modelo em double.
+ *
+ * Com a mesma sequência de ruído, a série Q15 acompanha o AR(5) da curva calculado em double
+ * (erro de poucos LSB, do truncamento de cada passo). Em 1 M amostras, o ruído puro é uniforme
+ * em [-amplitude, +amplitude) com média 0 e variância amplitude²/3, e as séries AR(1) e AR(2)
+ * têm a variância estacionária e as autocorrelações das equações de Yule-Walker. Também confere
+ * a semente (mesma semente, mesma série), os limites de ordem, a saturação da leitura de ADC e
+ * mede a vazão do gerador.
+ */
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include "teste.h"
+#include "sinal_ar.h"
+
+#define AMOSTRAS 1000000
+#define FAIXAS 16
+
+typedef struct {
+    double media, variancia, rho[3];
+} estatistica_t;
+
+// Média, variância e autocorrelações de atraso 1..3 de n amostras da série (em unidades de 1,0)
+static estatistica_t medir(sinal_ar_t *s, int n) {
+    estatistica_t e = { 0 };
+    double soma = 0, soma2 = 0, soma_lag[3] = { 0 };
+    double anteriores[3] = { 0 };
+
+    for (int t = 0; t < n; t++) {
+        double x = sinal_ar_proximo(s) / (double)SINAL_AR_Q15_UM;
+        soma += x;
+        soma2 += x * x;
+        for (int k = 0; k < 3; k++) {
+            soma_lag[k] += x * anteriores[k];
+        }
+        anteriores[2] = anteriores[1];
+        anteriores[1] = anteriores[0];
+        anteriores[0] = x;
+    }
+    e.media = soma / n;
+    e.variancia = soma2 / n - e.media * e.media;
+    for (int k = 0; k < 3; k++) {
+        e.rho[k] = (soma_lag[k] / (n - k - 1) - e.media * e.media) / e.variancia;
+    }
+    return e;
+}
+
+int main(void) {
+    static const int32_t coef_curva[5] = {
+        SINAL_AR_Q15(0.4), SINAL_AR_Q15(-0.2), SINAL_AR_Q15(0.15), SINAL_AR_Q15(0.1), SINAL_AR_Q15(0.05)
+    };
+    sinal_ar_t s, r;
+
+    // Mesma semente, mesma série; semente diferente, outra série; semear recomeça
+    sinal_ar_init(&s, coef_curva, 5, SINAL_AR_Q15_UM, 1234);
+    sinal_ar_init(&r, coef_curva, 5, SINAL_AR_Q15_UM, 1234);
+    int iguais = 0;
+    int32_t primeiras[64];
+    for (int t = 0; t < 10000; t++) {
+        int32_t v = sinal_ar_proximo(&s);
+        iguais += v == sinal_ar_proximo(&r);
+        if (t < 64) {
+            primeiras[t] = v;
+        }
+    }
+    VERIFICA(iguais == 10000, "mesma semente divergiu em %d amostras", 10000 - iguais);
+    sinal_ar_semear(&s, 1234);
+    iguais = 0;
+    for (int t = 0; t < 64; t++) {
+        iguais += sinal_ar_proximo(&s) == primeiras[t];
+    }
+    VERIFICA(iguais == 64, "sinal_ar_semear() não recomeçou a série (%d de 64 iguais)", iguais);
+    sinal_ar_init(&r, coef_curva, 5, SINAL_AR_Q15_UM, 4321);
+    iguais = 0;
+    for (int t = 0; t < 64; t++) {
+        iguais += sinal_ar_proximo(&r) == primeiras[t];
+    }
+    VERIFICA(iguais < 8, "semente diferente repetiu %d de 64 amostras", iguais);
+
+    // AR(5) da curva contra o mesmo modelo em double, com o mesmo ruído
+    sinal_ar_init(&s, coef_curva, 5, SINAL_AR_Q15_UM, 0x2545F491u);
+    uint32_t prng = 0x2545F491u;
+    double x[5] = { 0 };
+    double erro_max = 0;
+    for (int t = 0; t < AMOSTRAS; t++) {
+        double v = 0;
+        for (int i = 0; i < 5; i++) {
+            v += coef_curva[i] / (double)SINAL_AR_Q15_UM * x[i];
+        }
+        v += (int16_t)(sinal_ar_xorshift32(&prng) >> 16) / (double)SINAL_AR_Q15_UM;
+        for (int i = 4; i > 0; i--) {
+            x[i] = x[i - 1];
+        }
+        x[0] = v;
+
+        double erro = fabs(sinal_ar_proximo(&s) - v * SINAL_AR_Q15_UM);
+        erro_max = erro > erro_max ? erro : erro_max;
+    }
+    VERIFICA(erro_max <= 16, "AR(5) em Q15 difere do double em %.1f LSB", erro_max);
+
+    // Ruído puro (AR(1) com coeficiente 0): uniforme em [-amp, +amp), variância amp²/3
+    const int32_t zero = 0, amp = SINAL_AR_Q15(0.25);
+    sinal_ar_init(&s, &zero, 1, amp, 99);
+    int faixas[FAIXAS] = { 0 };
+    int32_t menor = INT32_MAX, maior = INT32_MIN;
+    for (int t = 0; t < AMOSTRAS; t++) {
+        int32_t v = sinal_ar_proximo(&s);
+        menor = v < menor ? v : menor;
+        maior = v > maior ? v : maior;
+        int f = (int)(((int64_t)v + amp) * FAIXAS / (2 * amp));
+        faixas[f < 0 ? 0 : f >= FAIXAS ? FAIXAS - 1 : f]++;
+    }
+    VERIFICA(menor >= -amp && maior < amp && menor < -amp + 64 && maior > amp - 64,
+             "ruído em [%d, %d], amplitude %d", menor, maior, amp);
+    for (int f = 0; f < FAIXAS; f++) {
+        VERIFICA(abs(faixas[f] - AMOSTRAS / FAIXAS) < AMOSTRAS / FAIXAS / 50, "faixa %d do ruído com %d amostras", f,
+                 faixas[f]);
+    }
+    sinal_ar_init(&s, &zero, 1, amp, 99);
+    estatistica_t e = medir(&s, AMOSTRAS);
+    double var_ruido = 0.25 * 0.25 / 3;
+    VERIFICA(fabs(e.media) < 0.002 && fabs(e.variancia / var_ruido - 1) < 0.01 && fabs(e.rho[0]) < 0.005,
+             "ruído: média %.4f, variância %.5f (teoria %.5f), rho1 %.4f", e.media, e.variancia, var_ruido,
+             e.rho[0]);
+
+    // AR(1), a = 0,5: variância σ²/(1 - a²), rho_k = a^k
+    const int32_t ar1 = SINAL_AR_Q15(0.5);
+    sinal_ar_init(&s, &ar1, 1, SINAL_AR_Q15_UM, 7);
+    estatistica_t e1 = medir(&s, AMOSTRAS);
+    double var1 = (1.0 / 3) / (1 - 0.25);
+    VERIFICA(fabs(e1.media) < 0.005 && fabs(e1.variancia / var1 - 1) < 0.02,
+             "AR(1): média %.4f, variância %.5f (teoria %.5f)", e1.media, e1.variancia, var1);
+    VERIFICA(fabs(e1.rho[0] - 0.5) < 0.01 && fabs(e1.rho[1] - 0.25) < 0.01 && fabs(e1.rho[2] - 0.125) < 0.01,
+             "AR(1): rho %.4f %.4f %.4f (teoria 0.5 0.25 0.125)", e1.rho[0], e1.rho[1], e1.rho[2]);
+
+    // AR(2), a1 = 0,6, a2 = -0,3: Yule-Walker dá rho1 = a1/(1 - a2), rho2 = a1 rho1 + a2
+    const int32_t ar2[2] = { SINAL_AR_Q15(0.6), SINAL_AR_Q15(-0.3) };
+    sinal_ar_init(&s, ar2, 2, SINAL_AR_Q15_UM, 11);
+    estatistica_t e2 = medir(&s, AMOSTRAS);
+    double rho1 = 0.6 / 1.3, rho2 = 0.6 * rho1 - 0.3, rho3 = 0.6 * rho2 - 0.3 * rho1;
+    double var2 = (1.0 / 3) * 1.3 / (0.7 * (1.3 * 1.3 - 0.6 * 0.6));
+    VERIFICA(fabs(e2.variancia / var2 - 1) < 0.02, "AR(2): variância %.5f (teoria %.5f)", e2.variancia, var2);
+    VERIFICA(fabs(e2.rho[0] - rho1) < 0.01 && fabs(e2.rho[1] - rho2) < 0.01 && fabs(e2.rho[2] - rho3) < 0.01,
+             "AR(2): rho %.4f %.4f %.4f (teoria %.4f %.4f %.4f)", e2.rho[0], e2.rho[1], e2.rho[2], rho1, rho2, rho3);
+
+    // Ordem fora dos limites e leitura de ADC saturada
+    sinal_ar_init(&s, coef_curva, 0, 0, 1);
+    VERIFICA(s.ordem == 1, "ordem 0 virou %u", s.ordem);
+    static const int32_t muitos[SINAL_AR_ORDEM_MAX + 2] = { 0 };
+    sinal_ar_init(&s, muitos, SINAL_AR_ORDEM_MAX + 2, 0, 1);
+    VERIFICA(s.ordem == SINAL_AR_ORDEM_MAX, "ordem %d virou %u", SINAL_AR_ORDEM_MAX + 2, s.ordem);
+
+    // AR(1) com a = 0,9 tem desvio de 1,3: a ±4096 contagens por unidade passa dos dois limites
+    const int32_t largo = SINAL_AR_Q15(0.9);
+    sinal_ar_init(&s, &largo, 1, SINAL_AR_Q15_UM, 5);
+    bool fora = false;
+    int no_topo = 0, no_fundo = 0;
+    for (int t = 0; t < 1000; t++) {
+        uint16_t leitura = sinal_ar_amostra_adc(&s, 2048, 4096);
+        fora |= leitura > 4095;
+        no_topo += leitura == 4095;
+        no_fundo += leitura == 0;
+    }
+    VERIFICA(!fora && no_topo > 0 && no_fundo > 0,
+             "leitura de ADC sem saturar em 0..4095 (%d no topo, %d no fundo)", no_topo, no_fundo);
+
+    // Vazão
+    sinal_ar_init(&s, coef_curva, 5, SINAL_AR_Q15_UM, 3);
+    volatile uint32_t soma = 0;
+    double t0 = teste_agora();
+    for (int t = 0; t < 10 * AMOSTRAS; t++) {
+        soma += (uint32_t)sinal_ar_proximo(&s);
+    }
+    double vazao = 10 * AMOSTRAS / (teste_agora() - t0);
+
+    printf("AR(5) Q15 contra double: erro máximo %.1f LSB em %d amostras\n", erro_max, AMOSTRAS);
+    printf("AR(1): variância %.4f (teoria %.4f), rho1 %.4f\n", e1.variancia, var1, e1.rho[0]);
+    printf("AR(2): variância %.4f (teoria %.4f), rho1 %.4f (teoria %.4f)\n", e2.variancia, var2, e2.rho[0], rho1);
+    printf("AR(5): %.1f M amostras/s\n", vazao / 1e6);
+    return TESTE_FIM();
+}
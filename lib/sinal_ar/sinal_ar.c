@@ -0,0 +1,66 @@
+/**
+ * @file sinal_ar.c
+ * @brief Implementação do gerador AR(p) em Q15.
+ */
+
+#include "sinal_ar.h"
+
+void sinal_ar_init(sinal_ar_t *s, const int32_t *coef_q15, uint8_t ordem, int32_t ruido_amp_q15, uint32_t semente) {
+    if (ordem > SINAL_AR_ORDEM_MAX) {
+        ordem = SINAL_AR_ORDEM_MAX;
+    }
+    if (ordem == 0) {
+        ordem = 1;
+    }
+
+    s->ordem = ordem;
+    s->ruido_amp = ruido_amp_q15;
+    for (uint8_t i = 0; i < SINAL_AR_ORDEM_MAX; i++) {
+        s->coef[i] = (coef_q15 && i < ordem) ? coef_q15[i] : 0;
+    }
+    sinal_ar_semear(s, semente);
+}
+
+// Reinicia a série: zera o histórico e recomeça o PRNG a partir da semente
+void sinal_ar_semear(sinal_ar_t *s, uint32_t semente) {
+    for (uint8_t i = 0; i < SINAL_AR_ORDEM_MAX; i++) {
+        s->historico[i] = 0;
+    }
+    s->pos = 0;
+    s->prng = semente ? semente : 0x9E3779B9u;   // xorshift não sai do zero
+}
+
+// Próxima amostra da série, em Q15
+int32_t sinal_ar_proximo(sinal_ar_t *s) {
+    int64_t acc = 0;
+    uint8_t j = s->pos;
+
+    // coef[0] multiplica a amostra mais recente, coef[1] a anterior, ... (andando para trás no anel)
+    for (uint8_t i = 0; i < s->ordem; i++) {
+        acc += (int64_t)s->coef[i] * s->historico[j];
+        j = j ? (uint8_t)(j - 1) : (uint8_t)(s->ordem - 1);
+    }
+
+    // 16 bits altos do xorshift como inteiro com sinal: uniforme em [-1, 1) em Q15
+    int32_t u = (int16_t)(sinal_ar_xorshift32(&s->prng) >> 16);
+    int32_t ruido = (int32_t)(((int64_t)u * s->ruido_amp) >> 15);
+
+    int32_t valor = (int32_t)(acc >> 15) + ruido;
+
+    s->pos = (uint8_t)(s->pos + 1 == s->ordem ? 0 : s->pos + 1);
+    s->historico[s->pos] = valor;
+    return valor;
+}
+
+// Próxima amostra convertida em leitura de ADC de 12 bits: centro + valor * contagens_por_unidade,
+// limitada a 0..4095. Serve de sensor sintético para os pipelines de ADC no host.
+uint16_t sinal_ar_amostra_adc(sinal_ar_t *s, uint16_t centro, uint16_t contagens_por_unidade) {
+    int64_t leitura = (int64_t)centro + (((int64_t)sinal_ar_proximo(s) * contagens_por_unidade) >> 15);
+    if (leitura < 0) {
+        return 0;
+    }
+    if (leitura > 4095) {
+        return 4095;
+    }
+    return (uint16_t)leitura;
+}
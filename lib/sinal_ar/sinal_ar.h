@@ -0,0 +1,53 @@
+/**
+ * @file sinal_ar.h
+ * @brief Gerador de séries autorregressivas AR(p) em ponto fixo Q15, com PRNG xorshift.
+ *
+ * x[t] = a1 * x[t-1] + a2 * x[t-2] + ... + ap * x[t-p] + ruído[t]
+ *
+ * - Coeficientes e amostras em Q15 (32768 = 1,0). As amostras ficam em int32_t, então a
+ *   série pode passar de ±1,0 sem saturar; a soma dos produtos usa 64 bits.
+ * - O histórico é um buffer circular: cada amostra nova sobrescreve a mais antiga, sem
+ *   copiar o vetor de estados.
+ * - O ruído é uniforme em [-amplitude, +amplitude], tirado de um xorshift32 com semente
+ *   explícita: a mesma semente gera sempre a mesma série, na placa e no PC.
+ *
+ * Serve tanto para efeitos (a curva da matriz NeoPixel) quanto como sensor sintético para
+ * exercitar os pipelines de ADC e tendência no build host (`sinal_ar_amostra_adc()`).
+ */
+
+#ifndef SINAL_AR_H
+#define SINAL_AR_H
+
+#include <stdint.h>
+
+#define SINAL_AR_ORDEM_MAX 8
+#define SINAL_AR_Q15_UM 32768
+
+// Converte uma constante em ponto flutuante para Q15 (para tabelas de coeficientes)
+#define SINAL_AR_Q15(v) ((int32_t)((v) * SINAL_AR_Q15_UM + ((v) < 0 ? -0.5 : 0.5)))
+
+typedef struct {
+    int32_t coef[SINAL_AR_ORDEM_MAX];       // a1..ap em Q15
+    int32_t historico[SINAL_AR_ORDEM_MAX];  // buffer circular das últimas p amostras (Q15)
+    uint8_t ordem;
+    uint8_t pos;                            // posição da amostra mais recente
+    int32_t ruido_amp;                      // amplitude do ruído em Q15
+    uint32_t prng;                          // estado do xorshift32 (nunca zero)
+} sinal_ar_t;
+
+// xorshift32 de Marsaglia: período 2^32 - 1, três shifts e três XOR por número
+static inline uint32_t sinal_ar_xorshift32(uint32_t *estado) {
+    uint32_t x = *estado;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *estado = x;
+    return x;
+}
+
+void sinal_ar_init(sinal_ar_t *s, const int32_t *coef_q15, uint8_t ordem, int32_t ruido_amp_q15, uint32_t semente);
+void sinal_ar_semear(sinal_ar_t *s, uint32_t semente);
+int32_t sinal_ar_proximo(sinal_ar_t *s);
+uint16_t sinal_ar_amostra_adc(sinal_ar_t *s, uint16_t centro, uint16_t contagens_por_unidade);
+
+#endif
@@ -0,0 +1,134 @@
+/**
+ * @file medicao_blit.c
+ * @brief Vazão de ssd1306_blit() e bytes no barramento por quadro de ssd1306_draw_bitmap().
+ *
+ * Antes de medir, confere o blit contra uma cópia pixel a pixel (mesmo layout do ram_buffer:
+ * endereçamento vertical, uma coluna de `pages` bytes após a outra) para sprites de vários
+ * tamanhos, posições alinhadas e deslocadas, parcialmente fora da tela e com as quatro
+ * operações raster. O envio passa pelo emulador, que conta os bytes e o tempo de I²C.
+ */
+
+#include <string.h>
+#include "teste.h"
+#include "ssd1306.h"
+#include "ssd1306_emulador.h"
+
+#define REPETICOES 200000
+
+static ssd1306_t display;
+static uint8_t referencia[ssd1306_buffer_length];
+
+static uint32_t semente = 12345;
+
+static uint8_t aleatorio(void) {
+    semente = semente * 1103515245u + 12345u;
+    return (uint8_t)(semente >> 16);
+}
+
+static bool ref_pixel(int x, int y) {
+    return referencia[x * display.pages + y / 8] & (1u << (y % 8));
+}
+
+static void ref_set(int x, int y, bool aceso) {
+    uint8_t *byte = &referencia[x * display.pages + y / 8];
+    *byte = aceso ? (*byte | (1u << (y % 8))) : (*byte & ~(1u << (y % 8)));
+}
+
+// Blit de referência: um pixel por vez, com recorte por pixel
+static void ref_blit(const uint8_t *sprite, int x, int y, int w, int h, ssd1306_rop_t rop) {
+    int sprite_pages = (h + 7) / 8;
+
+    for (int c = 0; c < w; c++) {
+        for (int r = 0; r < h; r++) {
+            int tx = x + c, ty = y + r;
+            if (tx < 0 || tx >= display.width || ty < 0 || ty >= display.height) {
+                continue;
+            }
+            bool src = sprite[c * sprite_pages + r / 8] & (1u << (r % 8));
+            bool dst = ref_pixel(tx, ty);
+            switch (rop) {
+                case SSD1306_ROP_OR:  dst = dst || src; break;
+                case SSD1306_ROP_AND: dst = dst && src; break;
+                case SSD1306_ROP_XOR: dst = dst != src; break;
+                default:              dst = src; break;
+            }
+            ref_set(tx, ty, dst);
+        }
+    }
+}
+
+static bool gddram_igual_ao_ram_buffer(void) {
+    const ssd1306_emu_t *emu = ssd1306_emu();
+
+    for (int x = 0; x < display.width; x++) {
+        for (int page = 0; page < display.pages; page++) {
+            if (emu->gddram[page][x] != display.ram_buffer[1 + x * display.pages + page]) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+int main(void) {
+    static uint8_t sprite[128 * 8];
+    static uint8_t bitmap[ssd1306_buffer_length];
+
+    ssd1306_emu_init(400000);
+    ssd1306_init_bm(&display, ssd1306_width, ssd1306_height, false, ssd1306_i2c_address, i2c1);
+    ssd1306_config(&display);
+
+    // Correção: blits aleatórios acumulados sobre o mesmo ram_buffer e a referência
+    int blits = 0;
+    for (int i = 0; i < 5000; i++) {
+        int w = 1 + aleatorio() % 40;
+        int h = 1 + aleatorio() % 40;
+        int x = (int)(aleatorio() % 180) - 30;
+        int y = (int)(aleatorio() % 110) - 30;
+        ssd1306_rop_t rop = (ssd1306_rop_t)(aleatorio() % 4);
+
+        for (int k = 0; k < w * ((h + 7) / 8); k++) {
+            sprite[k] = aleatorio();
+        }
+        ssd1306_blit(&display, sprite, x, y, w, h, rop);
+        ref_blit(sprite, x, y, w, h, rop);
+
+        if (memcmp(display.ram_buffer + 1, referencia, ssd1306_buffer_length) != 0) {
+            VERIFICA(false, "blit %d (%dx%d em %d,%d, rop %d) diferente da referência", i, w, h, x, y, rop);
+            memcpy(referencia, display.ram_buffer + 1, ssd1306_buffer_length);
+        }
+        blits++;
+    }
+    VERIFICA(display.ram_buffer[0] == 0x40, "blit sobrescreveu o byte de controle do ram_buffer");
+
+    // Bytes no barramento: o bitmap inteiro vai num único envio
+    for (size_t k = 0; k < ssd1306_buffer_length; k++) {
+        bitmap[k] = aleatorio();
+    }
+    ssd1306_emu_reset_stats();
+    ssd1306_draw_bitmap(&display, bitmap);
+    const ssd1306_emu_t *emu = ssd1306_emu();
+    uint32_t bytes_quadro = emu->bytes;
+    VERIFICA(emu->bytes_dados == (uint32_t)ssd1306_buffer_length, "%u bytes de dados num quadro", emu->bytes_dados);
+    VERIFICA(bytes_quadro <= ssd1306_buffer_length + 8, "%u bytes num quadro", bytes_quadro);
+    VERIFICA(gddram_igual_ao_ram_buffer(), "GDDRAM diferente do ram_buffer após draw_bitmap()");
+
+    // Vazão: sprite 16x16 em y alinhado (caminho por página) e deslocado (dividido em duas páginas)
+    for (int k = 0; k < 16 * 2; k++) {
+        sprite[k] = aleatorio();
+    }
+    double vazao[2];
+    for (int deslocado = 0; deslocado < 2; deslocado++) {
+        double t0 = teste_agora();
+        for (int i = 0; i < REPETICOES; i++) {
+            ssd1306_blit(&display, sprite, (i * 7) % 112, (i * 8) % 48 + deslocado * 3, 16, 16, SSD1306_ROP_XOR);
+        }
+        vazao[deslocado] = REPETICOES / (teste_agora() - t0);
+    }
+
+    printf("%d blits conferidos com a referência\n", blits);
+    printf("sprite 16x16: %.1f Mblits/s alinhado, %.1f Mblits/s deslocado\n", vazao[0] / 1e6, vazao[1] / 1e6);
+    printf("draw_bitmap: %u bytes (%llu us a 400 kHz) por quadro; um envio por byte seriam %u bytes\n",
+           bytes_quadro, (unsigned long long)ssd1306_emu_tempo_us(), bytes_quadro * ssd1306_buffer_length);
+    return TESTE_FIM();
+}
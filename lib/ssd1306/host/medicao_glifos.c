@@ -0,0 +1,158 @@
+/**
+ * @file medicao_glifos.c
+ * @brief Busca de glifos por font_index[] contra a antiga cadeia de comparações.
+ *
+ * A cadeia de `if` que ssd1306_get_font() usava antes da tabela está copiada aqui como
+ * referência: primeiro o teste confere que as duas dão o mesmo glifo para os 256 códigos
+ * Latin-1 e que uma tela cheia de texto em português fica igual desenhada dos dois jeitos;
+ * depois mede glifos por segundo na busca isolada e na tela inteira.
+ */
+
+#include <string.h>
+#include "teste.h"
+#include "ssd1306.h"
+#include "ssd1306_font.h"
+
+#define REPETICOES 20000
+
+// Tela cheia (16 × 8 caracteres de 8 px), com acentos
+static const char texto[] =
+    "Conexão estável."
+    "Temperatura: 27C"
+    "Umidade média 6."
+    "Ação às 14h: lê,"
+    "grava e envia já"
+    "PRÓXIMA LEITURA:"
+    "ÍNDICE ÓTIMO! Ê?"
+    "Não há água fria";
+
+static uint8_t framebuffer[ssd1306_framebuffer_length];
+static uint8_t *ssd = &framebuffer[ssd1306_buffer_prefix];
+
+// ssd1306_get_font() antes de font_index[]
+static int busca_antiga(uint8_t character) {
+    if (character >= 'A' && character <= 'Z') return character - 'A' + 1;
+    if (character >= '0' && character <= '9') return character - '0' + 27;
+    if (character >= 'a' && character <= 'z') return character - 'a' + 37;
+    if (character == '.') return 63;
+    if (character == ':') return 64;
+    if (character == 0x23) return 65;  // #
+    if (character == 0x21) return 66;  // !
+    if (character == 0x3F) return 67;  // ?
+    if (character == 0xC3) return 68;  // Ã
+    if (character == 0xC2) return 69;  // Â
+    if (character == 0xC1) return 70;  // Á
+    if (character == 0xC0) return 71;  // À
+    if (character == 0xC9) return 72;  // É
+    if (character == 0xCA) return 73;  // Ê
+    if (character == 0xCD) return 74;  // Í
+    if (character == 0xD3) return 75;  // Ó
+    if (character == 0xD4) return 76;  // Ô
+    if (character == 0xD5) return 77;  // Õ
+    if (character == 0xDA) return 78;  // Ú
+    if (character == 0xC7) return 79;  // Ç
+    if (character == 0xE7) return 80;  // ç
+    if (character == 0xE3) return 81;  // ã
+    if (character == 0xE1) return 82;  // á
+    if (character == 0xE0) return 83;  // à
+    if (character == 0xE2) return 84;  // â
+    if (character == 0xE9) return 85;  // é
+    if (character == 0xEA) return 86;  // ê
+    if (character == 0xED) return 87;  // í
+    if (character == 0xF3) return 88;  // ó
+    if (character == 0xF4) return 89;  // ô
+    if (character == 0xFA) return 90;  // ú
+    if (character == 0x2C) return 91;  // ,
+    if (character == '-')  return 92;  // -
+
+    return 0; // caractere vazio/inválido
+}
+
+// Texto convertido para Latin-1 como o antigo ssd1306_draw_utf8_multiline fazia, byte a byte
+static int para_latin1(const char *utf8, uint8_t *latin1) {
+    int n = 0;
+
+    while (*utf8) {
+        uint8_t c = (uint8_t)*utf8;
+        if ((c & 0x80) == 0) {
+            latin1[n++] = c;
+            utf8++;
+        }
+        else if ((c & 0xE0) == 0xC0) {
+            latin1[n++] = ((c & 0x1F) << 6) | ((uint8_t)utf8[1] & 0x3F);
+            utf8 += 2;
+        }
+        else {
+            utf8++;
+        }
+    }
+    return n;
+}
+
+// Tela desenhada com a busca antiga: 16 glifos por linha, 8 linhas
+static void desenhar_antigo(const uint8_t *latin1, int n) {
+    for (int i = 0; i < n && i < 16 * 8; i++) {
+        int idx = busca_antiga(latin1[i]);
+        uint8_t *dst = &ssd[(i / 16) * ssd1306_width + (i % 16) * 8];
+        for (int k = 0; k < 8; k++) {
+            dst[k] = font[idx * 8 + k];
+        }
+        ssd1306_mark_dirty((i % 16) * 8, (i / 16) * 8, (i % 16) * 8 + 7, (i / 16) * 8 + 7);
+    }
+}
+
+int main(void) {
+    static uint8_t referencia[ssd1306_buffer_length];
+    static uint8_t latin1[sizeof(texto)];
+
+    for (int c = 0; c < 256; c++) {
+        VERIFICA(font_index[c] == busca_antiga((uint8_t)c), "código 0x%02X: tabela %d, cadeia %d",
+                 c, font_index[c], busca_antiga((uint8_t)c));
+    }
+
+    int n = para_latin1(texto, latin1);
+    VERIFICA(n == 16 * 8, "texto com %d caracteres em vez de uma tela cheia", n);
+
+    desenhar_antigo(latin1, n);
+    memcpy(referencia, ssd, ssd1306_buffer_length);
+    memset(ssd, 0, ssd1306_buffer_length);
+    ssd1306_draw_utf8_multiline(ssd, 0, 0, texto);
+    VERIFICA(memcmp(ssd, referencia, ssd1306_buffer_length) == 0, "tela desenhada difere da busca antiga");
+
+    // Só a busca: uma consulta por caractere do texto já em Latin-1
+    volatile int soma = 0;
+    double t0 = teste_agora();
+    for (int r = 0; r < REPETICOES; r++) {
+        for (int i = 0; i < n; i++) {
+            soma += busca_antiga(latin1[i]);
+        }
+    }
+    double busca_cadeia = (double)REPETICOES * n / (teste_agora() - t0);
+
+    t0 = teste_agora();
+    for (int r = 0; r < REPETICOES; r++) {
+        for (int i = 0; i < n; i++) {
+            soma += font_index[latin1[i]];
+        }
+    }
+    double busca_tabela = (double)REPETICOES * n / (teste_agora() - t0);
+
+    // Tela inteira: decodificação UTF-8, busca e cópia dos 8 bytes de cada glifo
+    t0 = teste_agora();
+    for (int r = 0; r < REPETICOES; r++) {
+        desenhar_antigo(latin1, para_latin1(texto, latin1));
+    }
+    double tela_antiga = (double)REPETICOES * n / (teste_agora() - t0);
+
+    t0 = teste_agora();
+    for (int r = 0; r < REPETICOES; r++) {
+        ssd1306_draw_utf8_multiline(ssd, 0, 0, texto);
+    }
+    double tela_nova = (double)REPETICOES * n / (teste_agora() - t0);
+
+    printf("busca: %.1f Mglifos/s com a cadeia, %.1f Mglifos/s com font_index (%.1fx)\n",
+           busca_cadeia / 1e6, busca_tabela / 1e6, busca_tabela / busca_cadeia);
+    printf("tela cheia: %.1f Mglifos/s antes, %.1f Mglifos/s agora (%.1fx)\n",
+           tela_antiga / 1e6, tela_nova / 1e6, tela_nova / tela_antiga);
+    return TESTE_FIM();
+}
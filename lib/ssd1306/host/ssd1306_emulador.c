@@ -0,0 +1,345 @@
+/**
+ * @file ssd1306_emulador.c
+ * @brief Emulador do SSD1306 e backend de barramento do build host.
+ *
+ * Decodifica o subconjunto de comandos usado por `ssd1306_init()`, `render_on_display()`,
+ * `render_dirty_on_display()` e `ssd1306_config()`/`ssd1306_send_data()`. Comandos de
+ * configuração elétrica (contraste, charge pump, pré-carga etc.) são aceitos e descartados.
+ *
+ * Também simula o transporte assíncrono de `ssd1306_dma.c`: um quadro entregue fica "no DMA"
+ * até o relógio simulado passar do tempo que ele levaria no I²C, e só então é decodificado
+ * (como o DMA real, que lê o quadro durante a transmissão) e o fim é sinalizado ao driver.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "hardware/i2c.h"
+#include "ssd1306_bus.h"
+#include "ssd1306_emulador.h"
+
+// Instâncias referenciadas por i2c0/i2c1; o emulador não diferencia as portas
+struct i2c_inst {
+    uint8_t indice;
+};
+
+i2c_inst_t i2c0_inst = { 0 };
+i2c_inst_t i2c1_inst = { 1 };
+
+#define SSD1306_EMU_ENDERECO_A 0x3C
+#define SSD1306_EMU_ENDERECO_B 0x3D
+
+// Estado de power-on, para o emulador funcionar mesmo sem ssd1306_emu_init()
+static ssd1306_emu_t emu = {
+    .modo = SSD1306_EMU_PAGINA,
+    .col_fim = SSD1306_EMU_LARGURA - 1,
+    .pag_fim = SSD1306_EMU_PAGINAS - 1,
+    .clock_hz = 400000,
+};
+
+// Comando em andamento: o primeiro byte e os argumentos ainda esperados
+static uint8_t cmd_atual;
+static uint8_t cmd_args[6];
+static uint8_t cmd_recebidos;
+static uint8_t cmd_esperados;
+
+// Transporte assíncrono simulado: quadro em andamento e relógio simulado
+static ssd1306_bus_fim_t async_fim;
+static const uint16_t *async_palavras;
+static uint16_t async_n;
+static uint8_t async_endereco;
+static bool async_ativo;
+static uint64_t async_fim_ns;   // instante simulado em que o quadro em andamento termina
+static uint64_t agora_ns;       // relógio simulado
+
+void ssd1306_emu_init(uint32_t clock_hz) {
+    memset(&emu, 0, sizeof(emu));
+    // Valores de reset do datasheet: modo página, janela cheia
+    emu.modo = SSD1306_EMU_PAGINA;
+    emu.col_fim = SSD1306_EMU_LARGURA - 1;
+    emu.pag_fim = SSD1306_EMU_PAGINAS - 1;
+    emu.clock_hz = clock_hz ? clock_hz : 400000;
+    cmd_esperados = 0;
+    async_ativo = false;
+    agora_ns = 0;
+}
+
+const ssd1306_emu_t *ssd1306_emu(void) {
+    return &emu;
+}
+
+void ssd1306_emu_reset_stats(void) {
+    emu.tempo_ns = 0;
+    emu.transacoes = 0;
+    emu.bytes = 0;
+    emu.bytes_dados = 0;
+    emu.ignoradas = 0;
+    emu.quadros_async = 0;
+}
+
+uint64_t ssd1306_emu_tempo_us(void) {
+    return emu.tempo_ns / 1000u;
+}
+
+// START + endereço + dados (9 bits cada, com o ACK) + STOP
+static uint64_t ssd1306_emu_duracao_ns(size_t length) {
+    return ((uint64_t)(length + 1) * 9u + 2u) * 1000000000ull / emu.clock_hz;
+}
+
+// Quantos bytes de argumento seguem cada comando
+static uint8_t ssd1306_emu_n_args(uint8_t cmd) {
+    switch (cmd) {
+    case 0x20: case 0x81: case 0x8D: case 0xA8: case 0xD3:
+    case 0xD5: case 0xD9: case 0xDA: case 0xDB:
+        return 1;
+    case 0x21: case 0x22: case 0xA3:
+        return 2;
+    case 0x29: case 0x2A:
+        return 5;
+    case 0x26: case 0x27:
+        return 6;
+    default:
+        return 0;
+    }
+}
+
+// Executa um comando completo (com todos os argumentos já recebidos)
+static void ssd1306_emu_executar(uint8_t cmd, const uint8_t *args) {
+    if (cmd <= 0x0F) {                      // modo página: nibble baixo da coluna
+        emu.col = (emu.col & 0xF0) | cmd;
+    } else if (cmd <= 0x1F) {               // modo página: nibble alto da coluna
+        emu.col = (uint8_t)(((cmd & 0x0F) << 4) | (emu.col & 0x0F)) & (SSD1306_EMU_LARGURA - 1);
+    } else if (cmd == 0x20) {
+        if ((args[0] & 0x03) <= SSD1306_EMU_PAGINA)
+            emu.modo = (ssd1306_emu_modo_t)(args[0] & 0x03);
+    } else if (cmd == 0x21) {
+        emu.col_inicio = args[0] & (SSD1306_EMU_LARGURA - 1);
+        emu.col_fim = args[1] & (SSD1306_EMU_LARGURA - 1);
+        emu.col = emu.col_inicio;
+    } else if (cmd == 0x22) {
+        emu.pag_inicio = args[0] & (SSD1306_EMU_PAGINAS - 1);
+        emu.pag_fim = args[1] & (SSD1306_EMU_PAGINAS - 1);
+        emu.pag = emu.pag_inicio;
+    } else if (cmd >= 0x40 && cmd <= 0x7F) {
+        emu.linha_inicial = cmd & 0x3F;
+    } else if (cmd == 0xA0 || cmd == 0xA1) {
+        emu.remap_segmentos = cmd & 0x01;
+    } else if (cmd == 0xA4 || cmd == 0xA5) {
+        emu.tudo_aceso = cmd & 0x01;
+    } else if (cmd == 0xA6 || cmd == 0xA7) {
+        emu.invertido = cmd & 0x01;
+    } else if (cmd == 0xAE || cmd == 0xAF) {
+        emu.ligado = cmd & 0x01;
+    } else if (cmd >= 0xB0 && cmd <= 0xB7) { // modo página: página atual
+        emu.pag = cmd & 0x07;
+    } else if (cmd == 0xC0 || cmd == 0xC8) {
+        emu.com_invertido = cmd & 0x08;
+    } else if (cmd == 0xD3) {
+        emu.offset = args[0] & 0x3F;
+    }
+    // Demais comandos (contraste, scroll, clock, pré-carga...) não alteram a imagem emulada
+}
+
+static void ssd1306_emu_comando(uint8_t byte) {
+    if (cmd_esperados == 0) {
+        cmd_atual = byte;
+        cmd_recebidos = 0;
+        cmd_esperados = ssd1306_emu_n_args(byte);
+        if (cmd_esperados == 0)
+            ssd1306_emu_executar(cmd_atual, cmd_args);
+        return;
+    }
+
+    cmd_args[cmd_recebidos++] = byte;
+    if (--cmd_esperados == 0)
+        ssd1306_emu_executar(cmd_atual, cmd_args);
+}
+
+// Escreve um byte na GDDRAM e avança o ponteiro conforme o modo de endereçamento
+static void ssd1306_emu_dado(uint8_t byte) {
+    emu.gddram[emu.pag][emu.col] = byte;
+    emu.bytes_dados++;
+
+    switch (emu.modo) {
+    case SSD1306_EMU_HORIZONTAL:
+        if (emu.col++ >= emu.col_fim) {
+            emu.col = emu.col_inicio;
+            emu.pag = (emu.pag >= emu.pag_fim) ? emu.pag_inicio : emu.pag + 1;
+        }
+        break;
+    case SSD1306_EMU_VERTICAL:
+        if (emu.pag++ >= emu.pag_fim) {
+            emu.pag = emu.pag_inicio;
+            emu.col = (emu.col >= emu.col_fim) ? emu.col_inicio : emu.col + 1;
+        }
+        break;
+    case SSD1306_EMU_PAGINA:
+        // No modo página só a coluna avança e volta ao início ao passar do fim
+        emu.col = (emu.col + 1) & (SSD1306_EMU_LARGURA - 1);
+        break;
+    }
+}
+
+void ssd1306_emu_write(uint8_t address, const uint8_t *data, size_t length) {
+    emu.tempo_ns += ssd1306_emu_duracao_ns(length);
+    emu.transacoes++;
+    emu.bytes += (uint32_t)length;
+
+    if (address != SSD1306_EMU_ENDERECO_A && address != SSD1306_EMU_ENDERECO_B) {
+        emu.ignoradas++;
+        return;
+    }
+
+    // Byte de controle: bit 7 (Co) = só o próximo byte é desse tipo; bit 6 (D/C#) = dados
+    size_t i = 0;
+    while (i < length) {
+        uint8_t controle = data[i++];
+        bool continua = controle & 0x80;
+        bool dados = controle & 0x40;
+
+        if (!continua) {
+            for (; i < length; i++) {
+                if (dados) ssd1306_emu_dado(data[i]);
+                else ssd1306_emu_comando(data[i]);
+            }
+        } else if (i < length) {
+            if (dados) ssd1306_emu_dado(data[i]);
+            else ssd1306_emu_comando(data[i]);
+            i++;
+        }
+    }
+}
+
+bool ssd1306_emu_pixel(int x, int y) {
+    if (x < 0 || x >= SSD1306_EMU_LARGURA || y < 0 || y >= SSD1306_EMU_ALTURA)
+        return false;
+    if (!emu.ligado)
+        return false;
+    if (emu.tudo_aceso)
+        return true;
+
+    // Posição na GDDRAM da linha/coluna física mostrada em (x, y)
+    int coluna = emu.remap_segmentos ? x : (SSD1306_EMU_LARGURA - 1 - x);
+    int com = emu.com_invertido ? y : (SSD1306_EMU_ALTURA - 1 - y);
+    int linha = (com + emu.linha_inicial + emu.offset) % SSD1306_EMU_ALTURA;
+
+    bool aceso = (emu.gddram[linha / 8][coluna] >> (linha % 8)) & 1;
+    return aceso != emu.invertido;
+}
+
+bool ssd1306_emu_salvar_pbm(const char *caminho) {
+    FILE *f = fopen(caminho, "wb");
+    if (!f)
+        return false;
+
+    // P4: 1 bit por pixel, MSB à esquerda, 1 = preto; pixel aceso sai branco como no OLED
+    fprintf(f, "P4\n%d %d\n", SSD1306_EMU_LARGURA, SSD1306_EMU_ALTURA);
+    for (int y = 0; y < SSD1306_EMU_ALTURA; y++) {
+        uint8_t linha[SSD1306_EMU_LARGURA / 8];
+        for (int b = 0; b < SSD1306_EMU_LARGURA / 8; b++) {
+            uint8_t byte = 0;
+            for (int bit = 0; bit < 8; bit++)
+                if (!ssd1306_emu_pixel(b * 8 + bit, y))
+                    byte |= 0x80 >> bit;
+            linha[b] = byte;
+        }
+        fwrite(linha, 1, sizeof(linha), f);
+    }
+
+    bool ok = !ferror(f);
+    return (fclose(f) == 0) && ok;
+}
+
+static void ssd1306_bus_host_write(i2c_inst_t *i2c, uint8_t address, const uint8_t *data, size_t length) {
+    (void)i2c;
+    ssd1306_emu_write(address, data, length);
+}
+
+// ------------------------------------------------------------
+// Transporte assíncrono simulado
+// ------------------------------------------------------------
+
+// Decodifica o quadro em andamento (uma transação por STOP) e sinaliza o fim ao driver,
+// que pode iniciar o próximo quadro dentro de async_fim()
+static void ssd1306_emu_concluir_quadro(void) {
+    static uint8_t transacao[UINT16_MAX];
+    size_t n = 0;
+
+    for (uint16_t i = 0; i < async_n; i++) {
+        transacao[n++] = (uint8_t)async_palavras[i];
+        if (async_palavras[i] & SSD1306_BUS_STOP) {
+            ssd1306_emu_write(async_endereco, transacao, n);
+            n = 0;
+        }
+    }
+    if (n > 0) {
+        ssd1306_emu_write(async_endereco, transacao, n);
+    }
+
+    async_ativo = false;
+    emu.quadros_async++;
+    if (async_fim) {
+        async_fim();
+    }
+}
+
+void ssd1306_emu_avancar_us(uint64_t us) {
+    uint64_t alvo = agora_ns + us * 1000u;
+
+    while (async_ativo && async_fim_ns <= alvo) {
+        agora_ns = async_fim_ns;
+        ssd1306_emu_concluir_quadro();
+    }
+    agora_ns = alvo;
+}
+
+uint64_t ssd1306_emu_agora_us(void) {
+    return agora_ns / 1000u;
+}
+
+static void ssd1306_bus_host_async_init(i2c_inst_t *i2c, ssd1306_bus_fim_t fim) {
+    (void)i2c;
+    async_fim = fim;
+}
+
+static void ssd1306_bus_host_async_start(i2c_inst_t *i2c, uint8_t address, const uint16_t *words, uint16_t n) {
+    (void)i2c;
+    uint64_t duracao = 0;
+    size_t bytes = 0;
+
+    // Tempo de I²C do quadro inteiro, transação a transação
+    for (uint16_t i = 0; i < n; i++) {
+        bytes++;
+        if ((words[i] & SSD1306_BUS_STOP) || i == n - 1) {
+            duracao += ssd1306_emu_duracao_ns(bytes);
+            bytes = 0;
+        }
+    }
+
+    async_palavras = words;
+    async_n = n;
+    async_endereco = address;
+    async_fim_ns = agora_ns + duracao;
+    async_ativo = true;
+}
+
+static bool ssd1306_bus_host_async_idle(i2c_inst_t *i2c) {
+    (void)i2c;
+    return !async_ativo;
+}
+
+// O laço de espera do driver "dorme" até o fim do quadro em andamento
+static void ssd1306_bus_host_async_aguardar(i2c_inst_t *i2c) {
+    (void)i2c;
+    if (async_ativo) {
+        agora_ns = async_fim_ns;
+        ssd1306_emu_concluir_quadro();
+    }
+}
+
+const ssd1306_bus_t ssd1306_bus_default = {
+    .write = ssd1306_bus_host_write,
+    .async_init = ssd1306_bus_host_async_init,
+    .async_start = ssd1306_bus_host_async_start,
+    .async_idle = ssd1306_bus_host_async_idle,
+    .async_aguardar = ssd1306_bus_host_async_aguardar,
+};
@@ -0,0 +1,91 @@
+/**
+ * @file ssd1306_emulador.h
+ * @brief Emulador do SSD1306 para rodar o driver no PC (build host), sem o display.
+ *
+ * O emulador é o backend `ssd1306_bus_default` do build host: cada transação que o driver
+ * envia é decodificada como no controlador real (bytes de controle 0x00/0x40/0x80, modo de
+ * endereçamento, janelas de coluna/página, escrita de dados na GDDRAM) sobre um painel
+ * virtual de 128×64. Além do conteúdo da tela, acumula o tempo que as transações levariam
+ * no I²C com o clock configurado, o que permite medir o custo por quadro de rotinas como
+ * `tarefa2_exibir_oled()` ou `exibir_status_mqtt()` e comparar versões do código.
+ *
+ * Modelo de tempo por transação: START + (endereço + n bytes) × 9 bits (8 de dados + ACK)
+ * + STOP, tudo a 1/clock por bit. Não inclui clock stretching nem o tempo de CPU do Pico.
+ *
+ * O mesmo modelo dá o atraso do transporte assíncrono simulado (`ssd1306_dma.c`): um quadro
+ * entregue só chega à GDDRAM, e o driver só é avisado do fim, quando o relógio simulado passa
+ * do tempo de I²C dele. O relógio avança com `ssd1306_emu_avancar_us()` (o "trabalho" da CPU
+ * entre um envio e outro) e, sozinho, quando o driver espera (`ssd1306_dma_wait()`, ou um
+ * `ssd1306_dma_present()` com os dois quadros ocupados).
+ */
+
+#ifndef SSD1306_EMULADOR_H
+#define SSD1306_EMULADOR_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define SSD1306_EMU_LARGURA 128
+#define SSD1306_EMU_ALTURA 64
+#define SSD1306_EMU_PAGINAS (SSD1306_EMU_ALTURA / 8)
+
+// Modos de endereçamento do comando 0x20
+typedef enum {
+    SSD1306_EMU_HORIZONTAL = 0,
+    SSD1306_EMU_VERTICAL = 1,
+    SSD1306_EMU_PAGINA = 2,
+} ssd1306_emu_modo_t;
+
+// Estado do controlador emulado
+typedef struct {
+    uint8_t gddram[SSD1306_EMU_PAGINAS][SSD1306_EMU_LARGURA]; // memória de vídeo (página × coluna)
+    ssd1306_emu_modo_t modo;
+    uint8_t col_inicio, col_fim;    // janela do comando 0x21
+    uint8_t pag_inicio, pag_fim;    // janela do comando 0x22
+    uint8_t col, pag;               // ponteiro de escrita
+    uint8_t linha_inicial;          // 0x40..0x7F
+    uint8_t offset;                 // 0xD3
+    bool remap_segmentos;           // 0xA1: coluna 0 à esquerda
+    bool com_invertido;             // 0xC8: página 0 em cima
+    bool ligado;                    // 0xAF / 0xAE
+    bool invertido;                 // 0xA7 / 0xA6
+    bool tudo_aceso;                // 0xA5 / 0xA4
+
+    uint32_t clock_hz;              // clock do barramento usado no modelo de tempo
+    uint64_t tempo_ns;              // tempo acumulado de barramento
+    uint32_t transacoes;            // transações recebidas
+    uint32_t bytes;                 // bytes recebidos (sem o endereço)
+    uint32_t bytes_dados;           // bytes escritos na GDDRAM
+    uint32_t ignoradas;             // transações para outro endereço (sem ACK)
+    uint32_t quadros_async;         // quadros concluídos pelo transporte assíncrono
+} ssd1306_emu_t;
+
+// Reinicia o painel (estado de power-on) e define o clock do barramento em Hz (ex.: 400000)
+void ssd1306_emu_init(uint32_t clock_hz);
+
+// Acesso ao estado do emulador (leitura de contadores, GDDRAM etc.)
+const ssd1306_emu_t *ssd1306_emu(void);
+
+// Zera apenas os contadores de tempo/bytes, mantendo o conteúdo e a configuração do painel
+void ssd1306_emu_reset_stats(void);
+
+// Tempo de barramento acumulado desde o último reset, em microssegundos
+uint64_t ssd1306_emu_tempo_us(void);
+
+// Pixel visível na posição (x, y) do painel, já com remap, inversão e display ligado/desligado
+bool ssd1306_emu_pixel(int x, int y);
+
+// Grava a tela visível em PBM binário (P4); retorna false se o arquivo não puder ser escrito
+bool ssd1306_emu_salvar_pbm(const char *caminho);
+
+// Decodifica uma transação I²C (o backend `ssd1306_bus_default` do build host chama esta função)
+void ssd1306_emu_write(uint8_t address, const uint8_t *data, size_t length);
+
+// Avança o relógio simulado, concluindo os quadros assíncronos cujo tempo de I²C terminou
+void ssd1306_emu_avancar_us(uint64_t us);
+
+// Relógio simulado, em microssegundos desde ssd1306_emu_init()
+uint64_t ssd1306_emu_agora_us(void);
+
+#endif
@@ -0,0 +1,186 @@
+/**
+ * @file teste_emulador.c
+ * @brief Emulador de ponta a ponta: ssd1306_init() → render_on_display() → captura em PBM.
+ *
+ * O quadro de referência é calculado à parte, pixel a pixel, a partir das figuras desenhadas
+ * (moldura, retângulo cheio, pixels soltos em diagonal), e comparado com a tela visível do
+ * emulador (ssd1306_emu_pixel, que aplica remap, COM invertido e start line) e com os bits do
+ * PBM gravado. Também confere janelas parciais, o caminho do ssd1306_t (endereçamento vertical),
+ * a inversão do display e o modelo de tempo de I²C.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "teste.h"
+#include "ssd1306.h"
+#include "ssd1306_emulador.h"
+
+#define CAPTURA "teste_emulador.pbm"
+
+static uint8_t framebuffer[ssd1306_framebuffer_length];
+static uint8_t *ssd = &framebuffer[ssd1306_buffer_prefix];
+static bool esperado[ssd1306_height][ssd1306_width];
+
+// Quadro de referência, sem passar pelo driver
+static void calcular_esperado(void) {
+    for (int y = 0; y < ssd1306_height; y++) {
+        for (int x = 0; x < ssd1306_width; x++) {
+            bool moldura = x == 0 || y == 0 || x == ssd1306_width - 1 || y == ssd1306_height - 1;
+            bool retangulo = x >= 20 && x < 40 && y >= 10 && y < 26;
+            bool diagonal = x >= 50 && x < 110 && y == x / 2;
+            esperado[y][x] = moldura || retangulo || diagonal;
+        }
+    }
+}
+
+static void desenhar(void) {
+    memset(ssd, 0, ssd1306_buffer_length);
+    ssd1306_draw_box(ssd, 0, 0, ssd1306_width, ssd1306_height);
+    ssd1306_fill_rect(ssd, 20, 10, 20, 16);
+    for (int x = 50; x < 110; x++) {
+        ssd1306_set_pixel(ssd, x, x / 2, true);
+    }
+}
+
+// Quantos pixels visíveis diferem do quadro de referência (com `invertido`, do seu negativo)
+static int diferencas_na_tela(bool invertido) {
+    int n = 0;
+    for (int y = 0; y < ssd1306_height; y++) {
+        for (int x = 0; x < ssd1306_width; x++) {
+            n += ssd1306_emu_pixel(x, y) != (esperado[y][x] != invertido);
+        }
+    }
+    return n;
+}
+
+// Lê a captura e conta os pixels que diferem do quadro de referência (aceso = bit 0 no P4)
+static int diferencas_no_pbm(const char *caminho) {
+    FILE *f = fopen(caminho, "rb");
+    if (!f) {
+        return -1;
+    }
+
+    char cabecalho[16];
+    static const char esperado_cabecalho[] = "P4\n128 64\n";
+    size_t n_cab = fread(cabecalho, 1, sizeof(esperado_cabecalho) - 1, f);
+    uint8_t dados[ssd1306_height * ssd1306_width / 8];
+    size_t n_dados = fread(dados, 1, sizeof(dados), f);
+    int extra = fgetc(f);
+    fclose(f);
+
+    if (n_cab != sizeof(esperado_cabecalho) - 1 || memcmp(cabecalho, esperado_cabecalho, n_cab) != 0 ||
+        n_dados != sizeof(dados) || extra != EOF) {
+        return -1;
+    }
+
+    int n = 0;
+    for (int y = 0; y < ssd1306_height; y++) {
+        for (int x = 0; x < ssd1306_width; x++) {
+            bool preto = dados[y * (ssd1306_width / 8) + x / 8] & (0x80 >> (x % 8));
+            n += preto == esperado[y][x];
+        }
+    }
+    return n;
+}
+
+int main(void) {
+    struct render_area tela = {
+        .start_column = 0,
+        .end_column = ssd1306_width - 1,
+        .start_page = 0,
+        .end_page = ssd1306_n_pages - 1
+    };
+    calculate_render_area_buffer_length(&tela);
+    calcular_esperado();
+
+    // Power-on: painel desligado
+    ssd1306_emu_init(400000);
+    VERIFICA(!ssd1306_emu()->ligado && !ssd1306_emu_pixel(0, 0), "painel ligado antes do ssd1306_init()");
+
+    // Inicialização: display ligado, endereçamento horizontal, coluna 0 à esquerda, página 0 em cima
+    ssd1306_init();
+    const ssd1306_emu_t *emu = ssd1306_emu();
+    VERIFICA(emu->ligado, "display desligado depois do ssd1306_init()");
+    VERIFICA(emu->modo == SSD1306_EMU_HORIZONTAL, "modo de endereçamento %d", emu->modo);
+    VERIFICA(emu->remap_segmentos && emu->com_invertido, "orientação: remap %d, COM %d",
+             emu->remap_segmentos, emu->com_invertido);
+    VERIFICA(emu->ignoradas == 0, "%u transações ignoradas", emu->ignoradas);
+
+    // Quadro inteiro: tela visível igual à referência, pixel a pixel
+    desenhar();
+    ssd1306_emu_reset_stats();
+    render_on_display(ssd, &tela);
+    VERIFICA(emu->bytes_dados == (uint32_t)ssd1306_buffer_length, "%u bytes de dados no quadro", emu->bytes_dados);
+    int diferencas = diferencas_na_tela(false);
+    VERIFICA(diferencas == 0, "%d pixels diferentes da referência", diferencas);
+
+    // Tempo: START + (endereço + bytes) × 9 bits + STOP por transação, a 400 kHz
+    uint64_t bits = ((uint64_t)emu->bytes + emu->transacoes) * 9u + 2u * emu->transacoes;
+    uint64_t esperado_ns = bits * 1000000000ull / 400000u;
+    VERIFICA(emu->tempo_ns + emu->transacoes >= esperado_ns && emu->tempo_ns <= esperado_ns + emu->transacoes,
+             "tempo do quadro %llu ns, esperado %llu ns", (unsigned long long)emu->tempo_ns,
+             (unsigned long long)esperado_ns);
+    uint64_t us_400k = ssd1306_emu_tempo_us();
+
+    // Captura: o PBM traz os mesmos pixels
+    VERIFICA(ssd1306_emu_salvar_pbm(CAPTURA), "não gravou " CAPTURA);
+    diferencas = diferencas_no_pbm(CAPTURA);
+    VERIFICA(diferencas == 0, "PBM com %d pixels diferentes da referência (-1: formato inválido)", diferencas);
+
+    // Janela parcial: só as colunas 20–39 das páginas 1–3 chegam ao painel
+    ssd1306_fill_rect(ssd, 0, 0, ssd1306_width, ssd1306_height);
+    struct render_area janela = {.start_column = 20, .end_column = 39, .start_page = 1, .end_page = 3};
+    calculate_render_area_buffer_length(&janela);
+    static uint8_t janela_dados[ssd1306_buffer_prefix + 20 * 3];
+    for (int page = 1; page <= 3; page++) {
+        memcpy(&janela_dados[ssd1306_buffer_prefix + (page - 1) * 20], &ssd[page * ssd1306_width + 20], 20);
+    }
+    render_on_display(&janela_dados[ssd1306_buffer_prefix], &janela);
+    for (int y = 8; y < 32; y++) {
+        for (int x = 20; x < 40; x++) {
+            esperado[y][x] = true;
+        }
+    }
+    diferencas = diferencas_na_tela(false);
+    VERIFICA(diferencas == 0, "janela parcial: %d pixels diferentes", diferencas);
+
+    // Inversão do display (0xA7): todos os pixels visíveis trocam
+    ssd1306_send_command(ssd1306_set_inverse_display);
+    diferencas = diferencas_na_tela(true);
+    VERIFICA(diferencas == 0, "display invertido: %d pixels diferentes", diferencas);
+    ssd1306_send_command(ssd1306_set_normal_display);
+
+    // Mesmo quadro a 1 MHz: tempo proporcional ao clock
+    ssd1306_emu_init(1000000);
+    ssd1306_init();
+    desenhar();
+    ssd1306_emu_reset_stats();
+    render_on_display(ssd, &tela);
+    uint64_t us_1m = ssd1306_emu_tempo_us();
+    VERIFICA(llabs((long long)(us_1m * 1000) - (long long)(us_400k * 400)) <= 2000,
+             "quadro em %llu us a 1 MHz e %llu us a 400 kHz", (unsigned long long)us_1m,
+             (unsigned long long)us_400k);
+
+    // ssd1306_t (ssd1306_config + ssd1306_send_data): endereçamento vertical, mesma orientação
+    ssd1306_t display;
+    ssd1306_emu_init(400000);
+    ssd1306_init_bm(&display, ssd1306_width, ssd1306_height, false, ssd1306_i2c_address, i2c1);
+    ssd1306_config(&display);
+    VERIFICA(emu->modo == SSD1306_EMU_VERTICAL, "ssd1306_config(): modo de endereçamento %d", emu->modo);
+    calcular_esperado();
+    for (int y = 0; y < ssd1306_height; y++) {
+        for (int x = 0; x < ssd1306_width; x++) {
+            if (esperado[y][x]) {
+                display.ram_buffer[1 + x * display.pages + y / 8] |= 1u << (y % 8);
+            }
+        }
+    }
+    ssd1306_send_data(&display);
+    diferencas = diferencas_na_tela(false);
+    VERIFICA(diferencas == 0, "ssd1306_send_data(): %d pixels diferentes da referência", diferencas);
+    free(display.ram_buffer);
+
+    printf("quadro inteiro: %llu us a 400 kHz, %llu us a 1 MHz; captura em " CAPTURA "\n",
+           (unsigned long long)us_400k, (unsigned long long)us_1m);
+    return TESTE_FIM();
+}
@@ -0,0 +1,133 @@
+/**
+ * @file teste_envio_assincrono.c
+ * @brief Troca de quadros, fila e barreira de ssd1306_dma.c sobre o transporte simulado.
+ *
+ * O emulador só decodifica um quadro quando o relógio simulado passa do tempo de I²C dele, então
+ * o teste vê o que a CPU veria no Pico: o present() volta antes da transmissão, o segundo quadro
+ * fica na fila, o terceiro espera um quadro livre, e a GDDRAM só muda no fim de cada quadro. Se
+ * o driver reescrevesse um quadro em transmissão, a GDDRAM não bateria com o framebuffer da vez.
+ */
+
+#include <string.h>
+#include "teste.h"
+#include "ssd1306.h"
+#include "ssd1306_dma.h"
+#include "ssd1306_emulador.h"
+
+static uint8_t framebuffer[ssd1306_framebuffer_length];
+static uint8_t *ssd = &framebuffer[ssd1306_buffer_prefix];
+
+static ssd1306_dma_t display;
+static int quadros_concluidos;
+
+static void ao_concluir(void *contexto) {
+    (*(int *)contexto)++;
+}
+
+static bool gddram_igual(const uint8_t *imagem) {
+    const ssd1306_emu_t *emu = ssd1306_emu();
+
+    for (int page = 0; page < SSD1306_EMU_PAGINAS; page++) {
+        if (memcmp(emu->gddram[page], &imagem[page * ssd1306_width], ssd1306_width) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(void) {
+    static uint8_t imagem[3][ssd1306_buffer_length];
+    static uint8_t vazia[ssd1306_buffer_length];
+
+    ssd1306_emu_init(400000);
+    ssd1306_init();
+    ssd1306_dma_init(&display, i2c1, ssd1306_i2c_address);
+    ssd1306_dma_set_callback(&display, ao_concluir, &quadros_concluidos);
+    VERIFICA(!ssd1306_dma_busy(&display), "ocupado logo após a inicialização");
+    ssd1306_emu_reset_stats();
+
+    // 1º quadro: tela inteira. present() volta na hora, sem mexer na GDDRAM
+    ssd1306_fill_rect(ssd, 0, 0, ssd1306_width, ssd1306_height);
+    ssd1306_draw_string(ssd, 8, 8, "QUADRO 1");
+    memcpy(imagem[0], ssd, ssd1306_buffer_length);
+    uint64_t t0 = ssd1306_emu_agora_us();
+    VERIFICA(ssd1306_dma_present(&display, ssd), "present() do 1º quadro não enviou nada");
+    VERIFICA(ssd1306_emu_agora_us() == t0, "present() esperou o barramento com os quadros livres");
+    VERIFICA(ssd1306_dma_busy(&display), "não ocupado com o 1º quadro em transmissão");
+    VERIFICA(gddram_igual(vazia), "GDDRAM mudou antes do tempo de I²C do 1º quadro");
+
+    // 2º quadro desenhado durante a transmissão do 1º: vai para a fila
+    ssd1306_emu_avancar_us(1000);
+    ssd1306_clear_rect(ssd, 0, 16, ssd1306_width, 16);
+    ssd1306_draw_string(ssd, 8, 16, "QUADRO 2");
+    memcpy(imagem[1], ssd, ssd1306_buffer_length);
+    VERIFICA(ssd1306_dma_present(&display, ssd), "present() do 2º quadro não enviou nada");
+    VERIFICA(display.pendente, "2º quadro não ficou na fila");
+    VERIFICA(quadros_concluidos == 0, "%d quadros concluídos antes do tempo", quadros_concluidos);
+
+    // 3º quadro: os dois quadros de transmissão estão ocupados, então present() espera o fim do
+    // 1º (que põe o 2º no barramento) e usa o quadro que ele liberou
+    ssd1306_draw_string(ssd, 8, 40, "QUADRO 3");
+    memcpy(imagem[2], ssd, ssd1306_buffer_length);
+    uint64_t t1 = ssd1306_emu_agora_us();
+    VERIFICA(ssd1306_dma_present(&display, ssd), "present() do 3º quadro não enviou nada");
+    uint64_t fim_1 = ssd1306_emu_agora_us();
+    VERIFICA(fim_1 > t1, "present() com os dois quadros ocupados não esperou");
+    VERIFICA(quadros_concluidos == 1, "%d quadros concluídos na espera do 3º present()", quadros_concluidos);
+    VERIFICA(gddram_igual(imagem[0]), "GDDRAM diferente do 1º quadro no fim dele");
+    VERIFICA(ssd1306_dma_busy(&display), "não ocupado com o 2º em transmissão e o 3º na fila");
+
+    // Fim do 2º: o 3º entra no barramento, e o conteúdo do 2º não foi sobrescrito pelo 3º
+    while (quadros_concluidos < 2) {
+        ssd1306_emu_avancar_us(100);
+    }
+    VERIFICA(gddram_igual(imagem[1]), "GDDRAM diferente do 2º quadro no fim dele");
+    VERIFICA(ssd1306_dma_busy(&display), "não ocupado com o 3º em transmissão");
+
+    // Barreira: tudo transmitido
+    ssd1306_dma_wait(&display);
+    VERIFICA(!ssd1306_dma_busy(&display), "ocupado depois de ssd1306_dma_wait()");
+    VERIFICA(quadros_concluidos == 3, "%d quadros concluídos depois da barreira", quadros_concluidos);
+    VERIFICA(gddram_igual(imagem[2]), "GDDRAM diferente do 3º quadro depois da barreira");
+    VERIFICA(ssd1306_emu()->quadros_async == 3, "emulador concluiu %u quadros", ssd1306_emu()->quadros_async);
+
+    // O tempo simulado cobre o I²C dos três quadros, que rodaram em sequência sem folga
+    uint64_t total_us = ssd1306_emu_agora_us() - t0;
+    VERIFICA(total_us + 1 >= ssd1306_emu_tempo_us() && total_us <= ssd1306_emu_tempo_us() + 1,
+             "relógio (%llu us) diferente do tempo de barramento (%llu us)", (unsigned long long)total_us,
+             (unsigned long long)ssd1306_emu_tempo_us());
+
+    // Nada alterado: nada a enviar
+    VERIFICA(!ssd1306_dma_present(&display, ssd), "present() sem alterações enviou um quadro");
+
+    // Backend de barramento assíncrono: render_on_display() volta antes da transmissão
+    struct render_area tela = {
+        .start_column = 0,
+        .end_column = ssd1306_width - 1,
+        .start_page = 0,
+        .end_page = ssd1306_n_pages - 1
+    };
+    calculate_render_area_buffer_length(&tela);
+    memset(ssd, 0x55, ssd1306_buffer_length);
+    ssd1306_set_bus(&ssd1306_bus_dma);
+    uint64_t t2 = ssd1306_emu_agora_us();
+    render_on_display(ssd, &tela);
+    VERIFICA(ssd1306_emu_agora_us() == t2, "render_on_display() pelo DMA esperou o barramento");
+    VERIFICA(gddram_igual(imagem[2]), "GDDRAM mudou antes do tempo de I²C no backend DMA");
+    ssd1306_dma_wait(&display);
+    VERIFICA(gddram_igual(ssd), "GDDRAM diferente do framebuffer depois da barreira no backend DMA");
+
+    // Uma transação para outro endereço do barramento sai por DMA para esse endereço, não
+    // para o display configurado no init.
+    static const uint8_t outro[] = {0x40, 0xff, 0xff, 0xff};
+    uint32_t ignoradas = ssd1306_emu()->ignoradas;
+    ssd1306_bus_dma.write(i2c1, 0x50, outro, sizeof(outro));
+    ssd1306_dma_wait(&display);
+    VERIFICA(ssd1306_emu()->ignoradas == ignoradas + 1, "transação para 0x50 não saiu para 0x50");
+    VERIFICA(gddram_igual(ssd), "transação para 0x50 chegou ao display");
+    ssd1306_set_bus(NULL);
+
+    printf("3 quadros em %llu us simulados; barreira do backend DMA em %llu us\n",
+           (unsigned long long)total_us, (unsigned long long)(ssd1306_emu_agora_us() - t2));
+    return TESTE_FIM();
+}
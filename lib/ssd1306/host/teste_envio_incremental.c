@@ -0,0 +1,95 @@
+/**
+ * @file teste_envio_incremental.c
+ * @brief Bytes por envio com render_dirty_on_display() contra o envio da tela inteira.
+ *
+ * O barramento é o emulador (backend padrão do build host): além dos bytes contados pelo
+ * driver, confere que a GDDRAM emulada termina igual ao framebuffer depois de cada envio.
+ */
+
+#include <string.h>
+#include "teste.h"
+#include "ssd1306.h"
+#include "ssd1306_emulador.h"
+
+static uint8_t framebuffer[ssd1306_framebuffer_length];
+static uint8_t *ssd = &framebuffer[ssd1306_buffer_prefix];
+
+static bool gddram_igual_ao_framebuffer(void) {
+    const ssd1306_emu_t *emu = ssd1306_emu();
+
+    for (int page = 0; page < SSD1306_EMU_PAGINAS; page++) {
+        if (memcmp(emu->gddram[page], &ssd[page * ssd1306_width], ssd1306_width) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Tela de status como a do MQTT: título, três linhas de valores e a linha de estado embaixo
+static void desenhar_tela(void) {
+    memset(ssd, 0, ssd1306_buffer_length);
+    ssd1306_draw_string(ssd, 0, 0, "STATUS MQTT");
+    ssd1306_draw_string(ssd, 0, 16, "IP 10.0.0.7");
+    ssd1306_draw_string(ssd, 0, 24, "PING 5000ms");
+    ssd1306_draw_string(ssd, 0, 32, "TEMP 27.4C");
+    ssd1306_draw_string(ssd, 0, 56, "CONECTANDO");
+}
+
+int main(void) {
+    struct render_area tela = {
+        .start_column = 0,
+        .end_column = ssd1306_width - 1,
+        .start_page = 0,
+        .end_page = ssd1306_n_pages - 1
+    };
+
+    ssd1306_emu_init(400000);
+    ssd1306_init();
+    calculate_render_area_buffer_length(&tela);
+
+    // Envio completo: janela + 1024 bytes de dados
+    desenhar_tela();
+    ssd1306_emu_reset_stats();
+    uint32_t antes = ssd1306_bytes_sent();
+    render_on_display(ssd, &tela);
+    uint32_t bytes_completo = ssd1306_bytes_sent() - antes;
+    uint64_t us_completo = ssd1306_emu_tempo_us();
+    VERIFICA(bytes_completo >= ssd1306_buffer_length, "envio completo com %u bytes", bytes_completo);
+    VERIFICA(gddram_igual_ao_framebuffer(), "GDDRAM diferente após o envio completo");
+
+    // Nada mudou: nada a enviar
+    VERIFICA(render_dirty_on_display(ssd) == 0, "envio sem alterações colocou bytes no barramento");
+
+    // Só a linha de estado muda
+    ssd1306_clear_area(ssd, 0, 56, ssd1306_width - 1, 63);
+    ssd1306_draw_string(ssd, 0, 56, "CONECTADO");
+    ssd1306_emu_reset_stats();
+    int bytes_status = render_dirty_on_display(ssd);
+    uint64_t us_status = ssd1306_emu_tempo_us();
+    VERIFICA(bytes_status > 0, "linha de estado alterada não foi enviada");
+    // No máximo uma página: janela (7 bytes), byte de controle e 128 colunas
+    VERIFICA(bytes_status <= 7 + 1 + ssd1306_width, "linha de estado custou %d bytes (completo: %u)",
+             bytes_status, bytes_completo);
+    VERIFICA((uint32_t)bytes_status == ssd1306_emu()->bytes, "driver contou %d bytes, barramento recebeu %u",
+             bytes_status, ssd1306_emu()->bytes);
+    VERIFICA(gddram_igual_ao_framebuffer(), "GDDRAM diferente após o envio da linha de estado");
+
+    // Um valor curto no meio da tela: só as colunas tocadas, numa página
+    ssd1306_draw_string(ssd, 40, 24, "1000");
+    int bytes_valor = render_dirty_on_display(ssd);
+    VERIFICA(bytes_valor > 0 && bytes_valor <= 7 + 1 + 4 * 8, "valor de 4 caracteres custou %d bytes", bytes_valor);
+    VERIFICA(gddram_igual_ao_framebuffer(), "GDDRAM diferente após o envio do valor");
+
+    // Duas linhas em páginas distantes: duas janelas, ainda bem menos que a tela inteira
+    ssd1306_draw_string(ssd, 0, 0, "STATUS  MQTT");
+    ssd1306_draw_string(ssd, 0, 32, "TEMP 27.5C");
+    int bytes_duas = render_dirty_on_display(ssd);
+    VERIFICA(bytes_duas > 0 && (uint32_t)bytes_duas * 4 <= bytes_completo, "duas linhas custaram %d bytes",
+             bytes_duas);
+    VERIFICA(gddram_igual_ao_framebuffer(), "GDDRAM diferente após o envio das duas linhas");
+
+    printf("tela inteira: %u bytes (%llu us a 400 kHz)\n", bytes_completo, (unsigned long long)us_completo);
+    printf("linha de estado: %d bytes (%llu us)\n", bytes_status, (unsigned long long)us_status);
+    printf("valor de 4 caracteres: %d bytes; duas linhas: %d bytes\n", bytes_valor, bytes_duas);
+    return TESTE_FIM();
+}
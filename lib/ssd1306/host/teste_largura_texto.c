@@ -0,0 +1,138 @@
+/**
+ * @file teste_largura_texto.c
+ * @brief ssd1306_text_width() contra a largura que o texto ocupa ao ser desenhado.
+ *
+ * A largura desenhada é medida no framebuffer: da primeira à última coluna com algum pixel aceso
+ * na página do texto. Vale para cada glifo da fonte sozinho, para frases com acentos e para as
+ * rotinas de alinhamento e quebra de linha, que posicionam o texto a partir da largura medida.
+ */
+
+#include <string.h>
+#include "teste.h"
+#include "ssd1306.h"
+#include "ssd1306_font.h"
+
+static uint8_t framebuffer[ssd1306_framebuffer_length];
+static uint8_t *ssd = &framebuffer[ssd1306_buffer_prefix];
+
+// Tela com duas páginas de guarda logo antes, onde cairiam linhas desenhadas com y < 0
+static struct {
+    uint8_t guarda[2 * ssd1306_width];
+    uint8_t tela[ssd1306_buffer_length];
+} rolado;
+
+// Primeira e última coluna acesa da página; retorna false se a página está apagada
+static bool colunas_acesas(int page, int *primeira, int *ultima) {
+    *primeira = -1;
+    for (int x = 0; x < ssd1306_width; x++) {
+        if (ssd[page * ssd1306_width + x]) {
+            if (*primeira < 0) {
+                *primeira = x;
+            }
+            *ultima = x;
+        }
+    }
+    return *primeira >= 0;
+}
+
+// Codifica um código Latin-1 em UTF-8
+static void para_utf8(uint8_t c, char *utf8) {
+    if (c < 0x80) {
+        utf8[0] = (char)c;
+        utf8[1] = '\0';
+    }
+    else {
+        utf8[0] = (char)(0xC0 | (c >> 6));
+        utf8[1] = (char)(0x80 | (c & 0x3F));
+        utf8[2] = '\0';
+    }
+}
+
+int main(void) {
+    int primeira, ultima;
+
+    // Cada glifo com pixels: largura medida = colunas acesas, avanço = largura + 1
+    int glifos = 0;
+    for (int c = 1; c < 256; c++) {
+        if (font_index[c] == 0) {
+            continue;
+        }
+        char utf8[3];
+        para_utf8((uint8_t)c, utf8);
+
+        memset(ssd, 0, ssd1306_buffer_length);
+        int fim = ssd1306_draw_text(ssd, 10, 8, utf8);
+        int largura = ssd1306_text_width(utf8);
+        VERIFICA(colunas_acesas(1, &primeira, &ultima), "glifo 0x%02X não acendeu nada", c);
+        VERIFICA(primeira == 10 && ultima - primeira + 1 == largura,
+                 "glifo 0x%02X: medido %d, desenhado de %d a %d", c, largura, primeira, ultima);
+        VERIFICA(fim == 10 + largura + 1, "glifo 0x%02X: retorno %d com largura %d", c, fim, largura);
+        glifos++;
+    }
+
+    // Frases (sem espaço nas pontas, que não acende pixels)
+    static const char *frases[] = {
+        "Temperatura: 27.4",
+        "Ação às 14h",
+        "PRÓXIMA LEITURA",
+        "Não há conexão!",
+        "iiii,llll.IIII",
+        "MQTT: OK",
+        "ÍNDICE ÚNICO - ÊXITO?",
+    };
+    for (size_t i = 0; i < sizeof(frases) / sizeof(frases[0]); i++) {
+        memset(ssd, 0, ssd1306_buffer_length);
+        int largura = ssd1306_text_width(frases[i]);
+        int fim = ssd1306_draw_text(ssd, 0, 24, frases[i]);
+        colunas_acesas(3, &primeira, &ultima);
+        VERIFICA(primeira == 0 && ultima + 1 == largura, "\"%s\": medido %d, desenhado até a coluna %d",
+                 frases[i], largura, ultima);
+        VERIFICA(fim == largura + 1, "\"%s\": retorno %d com largura %d", frases[i], fim, largura);
+        VERIFICA(largura < 8 * (int)strlen(frases[i]), "\"%s\": %d px, não menor que a largura fixa",
+                 frases[i], largura);
+    }
+
+    // Só a primeira linha conta; texto vazio tem largura 0
+    VERIFICA(ssd1306_text_width("AB\nCDEF") == ssd1306_text_width("AB"), "'\\n' não encerrou a medida");
+    VERIFICA(ssd1306_text_width("") == 0, "texto vazio com largura %d", ssd1306_text_width(""));
+
+    // Alinhamento: à direita termina na última coluna da faixa, centralizado sobra igual dos lados
+    const char *valor = "27.4 C";
+    int largura = ssd1306_text_width(valor);
+    memset(ssd, 0, ssd1306_buffer_length);
+    ssd1306_draw_text_aligned(ssd, 20, 0, 100, valor, SSD1306_ALIGN_RIGHT);
+    colunas_acesas(0, &primeira, &ultima);
+    VERIFICA(ultima == 20 + 100 - 1 && ultima - primeira + 1 == largura,
+             "à direita: colunas %d a %d, largura %d", primeira, ultima, largura);
+
+    memset(ssd, 0, ssd1306_buffer_length);
+    ssd1306_draw_text_aligned(ssd, 0, 0, ssd1306_width, valor, SSD1306_ALIGN_CENTER);
+    colunas_acesas(0, &primeira, &ultima);
+    int sobra = (ssd1306_width - 1 - ultima) - primeira;
+    VERIFICA(sobra == 0 || sobra == 1, "centralizado: colunas %d a %d", primeira, ultima);
+
+    // Quebra de linha: cada linha cabe na faixa e fica alinhada pela própria largura
+    const char *paragrafo = "Leitura concluída com sucesso: temperatura média estável às 14h";
+    memset(ssd, 0, ssd1306_buffer_length);
+    int16_t y = ssd1306_draw_text_wrapped(ssd, 8, 0, 80, paragrafo, SSD1306_ALIGN_RIGHT);
+    int linhas = 0;
+    for (int page = 0; page < y / 8; page++) {
+        if (colunas_acesas(page, &primeira, &ultima)) {
+            VERIFICA(primeira >= 8 && ultima == 8 + 80 - 1, "linha %d: colunas %d a %d", page, primeira, ultima);
+            linhas++;
+        }
+    }
+    VERIFICA(linhas >= 3, "parágrafo em %d linhas", linhas);
+
+    // Rolagem: com y = -16 as duas primeiras linhas ficam fora da tela e o resto sobe duas páginas
+    int16_t y_rolado = ssd1306_draw_text_wrapped(rolado.tela, 8, -16, 80, paragrafo, SSD1306_ALIGN_RIGHT);
+    VERIFICA(y_rolado == y - 16, "y final %d rolado, %d sem rolar", y_rolado, y);
+    for (size_t i = 0; i < sizeof(rolado.guarda); i++) {
+        VERIFICA(rolado.guarda[i] == 0, "linha acima da tela escrita antes do framebuffer (byte %zu)", i);
+    }
+    VERIFICA(memcmp(rolado.tela, &ssd[2 * ssd1306_width], ssd1306_buffer_length - 2 * ssd1306_width) == 0,
+             "linhas visíveis diferentes do parágrafo sem rolagem");
+
+    printf("%d glifos, %zu frases e alinhamentos conferidos\n", glifos, sizeof(frases) / sizeof(frases[0]));
+    return TESTE_FIM();
+}
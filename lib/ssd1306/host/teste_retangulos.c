@@ -0,0 +1,146 @@
+/**
+ * @file teste_retangulos.c
+ * @brief Retângulos de máscaras por página e escritas de 32 bits contra um laço pixel a pixel.
+ *
+ * Retângulos aleatórios (inclusive com largura/altura nulas ou negativas, parcialmente ou
+ * totalmente fora da tela e começando em colunas que não são múltiplas de 4) são aplicados ao
+ * framebuffer do driver e a uma cópia de referência, que liga, apaga ou inverte um pixel por vez.
+ * O framebuffer fica entre bytes-guarda para pegar escritas de palavra fora do lugar.
+ */
+
+#include <string.h>
+#include "teste.h"
+#include "ssd1306.h"
+
+#define GUARDA 8
+
+static uint8_t memoria[GUARDA + ssd1306_framebuffer_length + GUARDA];
+static uint8_t *ssd = &memoria[GUARDA + ssd1306_buffer_prefix];
+static uint8_t referencia[ssd1306_buffer_length];
+
+static uint32_t semente = 2024;
+
+static int aleatorio(int n) {
+    semente = semente * 1103515245u + 12345u;
+    return (int)((semente >> 16) % (uint32_t)n);
+}
+
+// op: 0 = acende, 1 = apaga, 2 = inverte
+static void ref_rect(int x, int y, int w, int h, int op) {
+    for (int py = y; py < y + h; py++) {
+        for (int px = x; px < x + w; px++) {
+            if (px < 0 || px >= ssd1306_width || py < 0 || py >= ssd1306_height) {
+                continue;
+            }
+            uint8_t *byte = &referencia[(py / 8) * ssd1306_width + px];
+            uint8_t bit = 1u << (py % 8);
+            *byte = op == 0 ? (*byte | bit) : op == 1 ? (*byte & ~bit) : (*byte ^ bit);
+        }
+    }
+}
+
+static void ref_box(int x, int y, int w, int h) {
+    ref_rect(x + 1, y + 1, w - 2, h - 2, 1);
+    ref_rect(x, y, w, 1, 0);
+    ref_rect(x, y + h - 1, w, 1, 0);
+    ref_rect(x, y + 1, 1, h - 2, 0);
+    ref_rect(x + w - 1, y + 1, 1, h - 2, 0);
+}
+
+static bool guardas_intactas(void) {
+    for (int i = 0; i < GUARDA + ssd1306_buffer_prefix; i++) {
+        if (memoria[i] != 0xA5) {
+            return false;
+        }
+    }
+    for (int i = 0; i < GUARDA; i++) {
+        if (memoria[GUARDA + ssd1306_framebuffer_length + i] != 0xA5) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(void) {
+    memset(memoria, 0xA5, sizeof(memoria));
+    memset(ssd, 0, ssd1306_buffer_length);
+
+    // Casos de borda fixos: tela inteira, uma página, um pixel, colunas e linhas das bordas
+    static const int casos[][5] = {
+        {0, 0, ssd1306_width, ssd1306_height, 0},
+        {0, 0, ssd1306_width, ssd1306_height, 2},
+        {0, 8, ssd1306_width, 8, 1},
+        {127, 63, 1, 1, 2},
+        {0, 0, 1, 64, 1},
+        {3, 5, 1, 1, 0},
+        {1, 7, 9, 2, 0},        // atravessa a divisa de páginas
+        {5, 1, 6, 6, 2},        // dentro de uma página
+        {-10, -10, 20, 20, 0},  // recorte no canto superior esquerdo
+        {120, 60, 50, 50, 2},   // recorte no canto inferior direito
+        {-5, 3, 200, 1, 1},     // mais larga que a tela
+        {10, 10, 0, 5, 0},      // largura nula
+        {10, 10, 5, -3, 0},     // altura negativa
+        {200, 10, 5, 5, 0},     // totalmente fora
+        {10, -20, 5, 10, 0},    // totalmente acima
+    };
+
+    int aplicados = 0;
+    for (size_t i = 0; i < sizeof(casos) / sizeof(casos[0]); i++) {
+        const int *c = casos[i];
+        if (c[4] == 0) ssd1306_fill_rect(ssd, c[0], c[1], c[2], c[3]);
+        if (c[4] == 1) ssd1306_clear_rect(ssd, c[0], c[1], c[2], c[3]);
+        if (c[4] == 2) ssd1306_invert_rect(ssd, c[0], c[1], c[2], c[3]);
+        ref_rect(c[0], c[1], c[2], c[3], c[4]);
+        VERIFICA(memcmp(ssd, referencia, ssd1306_buffer_length) == 0,
+                 "caso %zu (%d,%d %dx%d op %d) diferente da referência", i, c[0], c[1], c[2], c[3], c[4]);
+        memcpy(referencia, ssd, ssd1306_buffer_length);
+        aplicados++;
+    }
+
+    // Retângulos aleatórios, caixas e clear_area acumulados sobre a mesma tela
+    for (int i = 0; i < 20000; i++) {
+        int x = aleatorio(180) - 30;
+        int y = aleatorio(100) - 20;
+        int w = aleatorio(150) - 5;
+        int h = aleatorio(80) - 5;
+        int op = aleatorio(5);
+
+        if (op == 0) ssd1306_fill_rect(ssd, x, y, w, h);
+        if (op == 1) ssd1306_clear_rect(ssd, x, y, w, h);
+        if (op == 2) ssd1306_invert_rect(ssd, x, y, w, h);
+        if (op < 3) ref_rect(x, y, w, h, op);
+
+        if (op == 3 && w >= 2 && h >= 2) {
+            ssd1306_draw_box(ssd, x, y, w, h);
+            ref_box(x, y, w, h);
+        }
+        if (op == 4) {
+            // Coordenadas inclusivas dentro da tela, como nas linhas de status
+            int x_0 = aleatorio(ssd1306_width), x_1 = x_0 + aleatorio(ssd1306_width - x_0);
+            int y_0 = aleatorio(ssd1306_height), y_1 = y_0 + aleatorio(ssd1306_height - y_0);
+            ssd1306_clear_area(ssd, x_0, y_0, x_1, y_1);
+            ref_rect(x_0, y_0, x_1 - x_0 + 1, y_1 - y_0 + 1, 1);
+        }
+
+        if (memcmp(ssd, referencia, ssd1306_buffer_length) != 0) {
+            VERIFICA(false, "operação %d (%d,%d %dx%d op %d) diferente da referência", i, x, y, w, h, op);
+            memcpy(referencia, ssd, ssd1306_buffer_length);
+        }
+        aplicados++;
+    }
+
+    VERIFICA(guardas_intactas(), "escrita fora do framebuffer");
+
+    // A área suja cobre o retângulo desenhado
+    struct render_area area;
+    while (ssd1306_take_dirty_area(&area)) {
+    }
+    ssd1306_fill_rect(ssd, 37, 19, 10, 20);
+    VERIFICA(ssd1306_take_dirty_area(&area), "fill_rect não marcou área suja");
+    VERIFICA(area.start_column <= 37 && area.end_column >= 46 && area.start_page <= 2 && area.end_page >= 4,
+             "área suja colunas %u-%u, páginas %u-%u", area.start_column, area.end_column,
+             area.start_page, area.end_page);
+
+    printf("%d retângulos conferidos com a referência\n", aplicados);
+    return TESTE_FIM();
+}
@@ -10,7 +10,10 @@
  * - Controle e envio de comandos (`ssd1306_send_command`, `ssd1306_command`, `ssd1306_scroll`)
  * - Envio de dados gráficos (`ssd1306_send_buffer`, `ssd1306_send_data`)
  * - Manipulação gráfica de alto nível (`ssd1306_set_pixel`, `ssd1306_draw_line`, `ssd1306_draw_char`, `ssd1306_draw_string`, `ssd1306_draw_bitmap`)
+ * - Cópia de sprites 1bpp com operações OR/AND/XOR para o `ram_buffer` (`ssd1306_blit`)
  * - Renderização direta de regiões de memória (`render_on_display`, `calculate_render_area_buffer_length`)
+ * - Envio incremental apenas das regiões alteradas (`ssd1306_mark_dirty`, `render_dirty_on_display`)
+ * - Escolha do backend de barramento (`ssd1306_set_bus`, ver `ssd1306_bus.h`)
  *
  * Este módulo assume o uso de um barramento I²C para comunicação com o display e depende da estrutura `ssd1306_t`
  * definida em arquivos complementares, como `ssd1306_i2c.h`.
@@ -21,6 +24,7 @@
 
 
 #include "ssd1306_i2c.h"
+#include "ssd1306_bus.h"
 extern void calculate_render_area_buffer_length(struct render_area *area);
 extern void ssd1306_send_command(uint8_t cmd);
 extern void ssd1306_send_command_list(uint8_t *ssd, int number);
@@ -28,12 +32,18 @@ extern void ssd1306_send_buffer(uint8_t ssd[], int buffer_length);
 extern void ssd1306_init();
 extern void ssd1306_scroll(bool set);
 extern void render_on_display(uint8_t *ssd, struct render_area *area);
+extern void ssd1306_mark_dirty(int x_0, int y_0, int x_1, int y_1);
+extern bool ssd1306_take_dirty_area(struct render_area *area);
+extern int render_dirty_on_display(uint8_t *ssd);
+extern uint32_t ssd1306_bytes_sent(void);
 extern void ssd1306_set_pixel(uint8_t *ssd, int x, int y, bool set);
 extern void ssd1306_draw_line(uint8_t *ssd, int x_0, int y_0, int x_1, int y_1, bool set);
 extern void ssd1306_draw_char(uint8_t *ssd, int16_t x, int16_t y, uint8_t character);
-extern void ssd1306_draw_string(uint8_t *ssd, int16_t x, int16_t y, char *string);
+extern void ssd1306_draw_string(uint8_t *ssd, int16_t x, int16_t y, const char *string);
+extern void ssd1306_clear_display(uint8_t *ssd);
 extern void ssd1306_command(ssd1306_t *ssd, uint8_t command);
 extern void ssd1306_config(ssd1306_t *ssd);
 extern void ssd1306_init_bm(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_vcc, uint8_t address, i2c_inst_t *i2c);
 extern void ssd1306_send_data(ssd1306_t *ssd);
-extern void ssd1306_draw_bitmap(ssd1306_t *ssd, const uint8_t *bitmap);
\ No newline at end of file
+extern void ssd1306_draw_bitmap(ssd1306_t *ssd, const uint8_t *bitmap);
+extern void ssd1306_blit(ssd1306_t *ssd, const uint8_t *sprite, int16_t x, int16_t y, uint8_t w, uint8_t h, ssd1306_rop_t rop);
\ No newline at end of file
@@ -0,0 +1,58 @@
+/**
+ * @file ssd1306_bus.h
+ * @brief Interface de barramento (backend) usada pelo driver SSD1306 para falar com o display.
+ *
+ * Todas as escritas do driver (comandos, janelas e dados do framebuffer) passam por um único
+ * ponto, que chama o backend selecionado com `ssd1306_set_bus()`. Assim o mesmo código de
+ * desenho funciona sobre diferentes transportes:
+ *
+ * - `ssd1306_bus_default`: I²C bloqueante do Pico SDK (`i2c_write_blocking`), em `ssd1306_bus_pico.c`;
+ *   no build host, o emulador (`host/ssd1306_emulador.c`).
+ * - `ssd1306_bus_dma`: cada transação é copiada para um quadro e enviada por DMA, em `ssd1306_dma.c`
+ *   (requer `ssd1306_dma_init()` antes de `ssd1306_set_bus(&ssd1306_bus_dma)`).
+ *
+ * Cada chamada de `write` corresponde a uma transação I²C completa (START, endereço, bytes, STOP).
+ * O ponteiro `data` só é válido durante a chamada: backends assíncronos devem copiar os bytes.
+ *
+ * Os campos `async_*` são o transporte assíncrono usado por `ssd1306_dma.c` (NULL em backends só
+ * bloqueantes). Um quadro é uma sequência de palavras no formato do `IC_DATA_CMD` do RP2040: o
+ * byte nos bits 0–7 e `SSD1306_BUS_STOP` no último byte de cada transação. O backend chama `fim`
+ * (no Pico, na interrupção do DMA) quando o último byte do quadro foi entregue ao I²C:
+ *
+ * - No Pico (`ssd1306_bus_pico.c`) o quadro é lido pelo DMA direto para o `IC_DATA_CMD`.
+ * - No host o emulador simula a transmissão: o quadro só é decodificado, e `fim` chamado, depois
+ *   do tempo que ele levaria no I²C, num relógio simulado que avança com `ssd1306_emu_avancar_us()`
+ *   e nas esperas do driver (`async_aguardar`).
+ */
+
+#ifndef SSD1306_BUS_H
+#define SSD1306_BUS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "hardware/i2c.h"
+
+#define SSD1306_BUS_STOP 0x200u     // bit STOP do IC_DATA_CMD: encerra a transação após o byte
+
+typedef void (*ssd1306_bus_fim_t)(void);
+
+typedef struct {
+    void (*write)(i2c_inst_t *i2c, uint8_t address, const uint8_t *data, size_t length);
+
+    // Prepara o transporte assíncrono; fim é chamado ao término de cada quadro
+    void (*async_init)(i2c_inst_t *i2c, ssd1306_bus_fim_t fim);
+    // Começa a transmitir n palavras de words para address (sem outro quadro em andamento)
+    void (*async_start)(i2c_inst_t *i2c, uint8_t address, const uint16_t *words, uint16_t n);
+    // Barramento parado: nenhum quadro em andamento e o último STOP já emitido
+    bool (*async_idle)(i2c_inst_t *i2c);
+    // Uma volta dos laços de espera do driver (no host, avança o relógio simulado)
+    void (*async_aguardar)(i2c_inst_t *i2c);
+} ssd1306_bus_t;
+
+extern const ssd1306_bus_t ssd1306_bus_default;
+extern const ssd1306_bus_t ssd1306_bus_dma;
+
+void ssd1306_set_bus(const ssd1306_bus_t *bus);
+
+#endif
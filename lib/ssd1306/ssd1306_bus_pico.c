@@ -0,0 +1,90 @@
+/**
+ * @file ssd1306_bus_pico.c
+ * @brief Backend padrão do driver SSD1306: escrita bloqueante no I²C do Pico SDK e transporte
+ * assíncrono por DMA (usado por `ssd1306_dma.c`).
+ *
+ * O canal DMA alimenta o registrador `IC_DATA_CMD` no ritmo da FIFO de transmissão (DREQ do I²C);
+ * a interrupção de fim do canal (DMA_IRQ_1, compartilhada) avisa o driver. Um display por projeto.
+ */
+
+#include "pico/stdlib.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/i2c.h"
+#include "ssd1306_bus.h"
+
+static int dma_chan = -1;
+static ssd1306_bus_fim_t fim_quadro = NULL;
+
+static void ssd1306_bus_pico_write(i2c_inst_t *i2c, uint8_t address, const uint8_t *data, size_t length) {
+    i2c_write_blocking(i2c, address, data, length, false);
+}
+
+// Interrupção de fim do DMA: o último byte do quadro já está na FIFO do I²C
+static void ssd1306_bus_pico_irq(void) {
+    if (dma_chan < 0 || !dma_channel_get_irq1_status(dma_chan)) {
+        return;
+    }
+    dma_channel_acknowledge_irq1(dma_chan);
+
+    if (fim_quadro) {
+        fim_quadro();
+    }
+}
+
+static void ssd1306_bus_pico_async_init(i2c_inst_t *i2c, ssd1306_bus_fim_t fim) {
+    fim_quadro = fim;
+    if (dma_chan >= 0) {
+        return;
+    }
+
+    dma_chan = dma_claim_unused_channel(true);
+    dma_channel_config cfg = dma_channel_get_default_config(dma_chan);
+    channel_config_set_transfer_data_size(&cfg, DMA_SIZE_16);      // dado + bits de controle
+    channel_config_set_read_increment(&cfg, true);                 // percorre o quadro
+    channel_config_set_write_increment(&cfg, false);               // IC_DATA_CMD fixo
+    channel_config_set_dreq(&cfg, i2c_get_dreq(i2c, true));        // ritmo da FIFO de TX
+    dma_channel_configure(dma_chan, &cfg, &i2c_get_hw(i2c)->data_cmd, NULL, 0, false);
+
+    dma_channel_set_irq1_enabled(dma_chan, true);
+    irq_add_shared_handler(DMA_IRQ_1, ssd1306_bus_pico_irq, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_1, true);
+}
+
+// Barramento ocioso: FIFO de transmissão vazia e mestre sem atividade (STOP já emitido)
+static bool ssd1306_bus_pico_async_idle(i2c_inst_t *i2c) {
+    uint32_t status = i2c_get_hw(i2c)->status;
+    return (status & I2C_IC_STATUS_TFE_BITS) && !(status & I2C_IC_STATUS_MST_ACTIVITY_BITS);
+}
+
+static void ssd1306_bus_pico_async_start(i2c_inst_t *i2c, uint8_t address, const uint16_t *words, uint16_t n) {
+    i2c_hw_t *hw = i2c_get_hw(i2c);
+
+    (void)hw->clr_tx_abrt;
+
+    // Outras transferências (ou outro dispositivo) podem ter trocado o endereço alvo; a troca
+    // exige o barramento ocioso, o que só acontece no primeiro quadro depois de outro uso
+    if ((hw->tar & 0x3FF) != address) {
+        while (!ssd1306_bus_pico_async_idle(i2c)) {
+            tight_loop_contents();
+        }
+        hw->enable = 0;
+        hw->tar = address;
+        hw->enable = 1;
+    }
+
+    dma_channel_transfer_from_buffer_now(dma_chan, words, n);
+}
+
+static void ssd1306_bus_pico_async_aguardar(i2c_inst_t *i2c) {
+    (void)i2c;
+    tight_loop_contents();
+}
+
+const ssd1306_bus_t ssd1306_bus_default = {
+    .write = ssd1306_bus_pico_write,
+    .async_init = ssd1306_bus_pico_async_init,
+    .async_start = ssd1306_bus_pico_async_start,
+    .async_idle = ssd1306_bus_pico_async_idle,
+    .async_aguardar = ssd1306_bus_pico_async_aguardar,
+};
@@ -0,0 +1,216 @@
+/**
+ * @file ssd1306_dma.c
+ * @brief Implementação do envio assíncrono do framebuffer do display SSD1306 (quadros duplos).
+ *
+ * As regiões alteradas do framebuffer (registradas pelo driver em `ssd1306_i2c.c`) são
+ * codificadas em palavras de 16 bits para o registrador `IC_DATA_CMD`: cada janela gera uma
+ * transação de comandos (prefixo 0x00) e uma de dados (prefixo 0x40), ambas terminadas com o
+ * bit de STOP. O controlador I²C gera o START da transação seguinte automaticamente.
+ *
+ * Este arquivo só cuida dos quadros (troca, fila e barreira); a transmissão em si é o transporte
+ * assíncrono do backend padrão (`ssd1306_bus.h`): DMA + interrupção no Pico, simulação com
+ * atraso no emulador do build host.
+ *
+ * Dependências:
+ * - `ssd1306.h` para `ssd1306_take_dirty_area()`.
+ * - `ssd1306_bus.h` para o transporte assíncrono e o backend `ssd1306_bus_dma`, que envia por
+ *   DMA todas as escritas do driver.
+ * - Pico SDK: `hardware/i2c.h`, `hardware/sync.h`.
+ */
+
+#include "pico/stdlib.h"
+#include "hardware/i2c.h"
+#include "hardware/sync.h"
+#include "ssd1306.h"
+#include "ssd1306_dma.h"
+#include "ssd1306_bus.h"
+
+// Instância atendida no fim de cada quadro (um display por projeto)
+static ssd1306_dma_t *instancia = NULL;
+
+// Espera o barramento ficar ocioso (nenhum quadro em andamento, STOP emitido)
+static void preparar_barramento(ssd1306_dma_t *dev) {
+    while (!dev->bus->async_idle(dev->i2c)) {
+        dev->bus->async_aguardar(dev->i2c);
+    }
+}
+
+static inline void iniciar_quadro(ssd1306_dma_t *dev, uint8_t indice) {
+    dev->bus->async_start(dev->i2c, dev->endereco[indice], dev->quadro[indice], dev->palavras[indice]);
+}
+
+// Espera o quadro da fila entrar em transmissão, liberando o outro para ser preenchido
+static void aguardar_pendente(ssd1306_dma_t *dev) {
+    while (dev->pendente) {
+        dev->bus->async_aguardar(dev->i2c);
+    }
+}
+
+// Fim de um quadro (no Pico, interrupção do DMA): dispara o pendente (se houver) e avisa o usuário
+static void ssd1306_dma_fim_quadro(void) {
+    ssd1306_dma_t *dev = instancia;
+
+    if (dev == NULL) {
+        return;
+    }
+
+    if (dev->pendente) {
+        iniciar_quadro(dev, dev->livre);
+        dev->livre ^= 1;
+        dev->pendente = false;
+    }
+    else {
+        dev->em_transmissao = false;
+    }
+
+    if (dev->callback) {
+        dev->callback(dev->contexto);
+    }
+}
+
+// Converte as janelas alteradas do framebuffer em palavras do IC_DATA_CMD
+static uint16_t codificar_quadro(uint16_t *quadro, const uint8_t *ssd) {
+    struct render_area janela;
+    uint16_t n = 0;
+
+    while (ssd1306_take_dirty_area(&janela)) {
+        quadro[n++] = 0x00;
+        quadro[n++] = ssd1306_set_column_address;
+        quadro[n++] = janela.start_column;
+        quadro[n++] = janela.end_column;
+        quadro[n++] = ssd1306_set_page_address;
+        quadro[n++] = janela.start_page;
+        quadro[n++] = janela.end_page | SSD1306_BUS_STOP;
+
+        // Uma única transação de dados: o ponteiro do SSD1306 percorre a janela página a página
+        quadro[n++] = 0x40;
+        int largura = janela.end_column - janela.start_column + 1;
+        for (int page = janela.start_page; page <= janela.end_page; page++) {
+            const uint8_t *origem = &ssd[page * ssd1306_width + janela.start_column];
+            for (int i = 0; i < largura; i++) {
+                quadro[n++] = origem[i];
+            }
+        }
+        quadro[n - 1] |= SSD1306_BUS_STOP;
+    }
+
+    return n;
+}
+
+/**
+ * @brief Prepara o transporte assíncrono (no Pico, o canal DMA) para alimentar o I²C do display.
+ *
+ * @param dev      Estrutura de controle (normalmente estática, contém os dois quadros).
+ * @param i2c      Instância I²C já inicializada com i2c_init().
+ * @param address  Endereço I²C do display (ex: ssd1306_i2c_address).
+ */
+void ssd1306_dma_init(ssd1306_dma_t *dev, i2c_inst_t *i2c, uint8_t address) {
+    dev->i2c = i2c;
+    dev->address = address;
+    dev->bus = &ssd1306_bus_default;
+    dev->livre = 0;
+    dev->palavras[0] = dev->palavras[1] = 0;
+    dev->em_transmissao = false;
+    dev->pendente = false;
+    dev->callback = NULL;
+    dev->contexto = NULL;
+
+    instancia = dev;
+    dev->bus->async_init(i2c, ssd1306_dma_fim_quadro);
+
+    preparar_barramento(dev);
+}
+
+// Define a função chamada (em contexto de interrupção) ao término de cada quadro
+void ssd1306_dma_set_callback(ssd1306_dma_t *dev, ssd1306_dma_callback_t callback, void *contexto) {
+    dev->callback = callback;
+    dev->contexto = contexto;
+}
+
+// Coloca o quadro recém-preenchido (dev->livre) em transmissão para address, ou na fila se o DMA
+// estiver ocupado
+static void enviar_quadro(ssd1306_dma_t *dev, uint8_t address, uint16_t n) {
+    dev->palavras[dev->livre] = n;
+    dev->endereco[dev->livre] = address;
+
+    // Sem DMA ativo nada mais inicia transferências, então o barramento pode ser preparado aqui
+    if (!dev->em_transmissao) {
+        preparar_barramento(dev);
+    }
+
+    uint32_t estado_irq = save_and_disable_interrupts();
+    if (dev->em_transmissao) {
+        dev->pendente = true;
+    }
+    else {
+        dev->em_transmissao = true;
+        iniciar_quadro(dev, dev->livre);
+        dev->livre ^= 1;
+    }
+    restore_interrupts(estado_irq);
+}
+
+/**
+ * @brief Entrega as regiões alteradas do framebuffer para transmissão via DMA.
+ *
+ * Retorna assim que o quadro é codificado; o framebuffer pode ser redesenhado em seguida.
+ * Se já houver um quadro em transmissão, o novo fica na fila e é iniciado pela interrupção.
+ * Só espera quando os dois quadros estão ocupados (um em transmissão e outro na fila).
+ *
+ * @return true se um quadro foi enfileirado, false se não havia nada alterado.
+ */
+bool ssd1306_dma_present(ssd1306_dma_t *dev, const uint8_t *ssd) {
+    aguardar_pendente(dev);
+
+    uint16_t n = codificar_quadro(dev->quadro[dev->livre], ssd);
+    if (n == 0) {
+        return false;
+    }
+
+    enviar_quadro(dev, dev->address, n);
+    return true;
+}
+
+// Backend de barramento (ssd1306_bus.h): cada transação do driver é copiada para um quadro
+// livre e enviada por DMA, então render_on_display() e afins retornam sem esperar o I²C.
+// Usa o canal configurado em ssd1306_dma_init(); sem ele, cai na escrita bloqueante. O quadro
+// vai para o endereço da transação, mas o DMA só alimenta a instância I²C do init.
+static void ssd1306_dma_bus_write(i2c_inst_t *i2c, uint8_t address, const uint8_t *data, size_t length) {
+    ssd1306_dma_t *dev = instancia;
+
+    if (dev == NULL) {
+        ssd1306_bus_default.write(i2c, address, data, length);
+        return;
+    }
+    if (length == 0) {
+        return;
+    }
+    assert(i2c == dev->i2c);
+    assert(length <= ssd1306_dma_max_words);
+
+    aguardar_pendente(dev);
+
+    uint16_t *quadro = dev->quadro[dev->livre];
+    for (size_t i = 0; i < length; i++) {
+        quadro[i] = data[i];
+    }
+    quadro[length - 1] |= SSD1306_BUS_STOP;
+
+    enviar_quadro(dev, address, (uint16_t)length);
+}
+
+const ssd1306_bus_t ssd1306_bus_dma = {
+    .write = ssd1306_dma_bus_write,
+};
+
+// Consulta (poll): verdadeiro enquanto houver quadro no DMA, na fila ou saindo pelo I²C
+bool ssd1306_dma_busy(ssd1306_dma_t *dev) {
+    return dev->em_transmissao || dev->pendente || !dev->bus->async_idle(dev->i2c);
+}
+
+// Barreira: aguarda o fim de todos os quadros antes de usar o barramento de forma bloqueante
+void ssd1306_dma_wait(ssd1306_dma_t *dev) {
+    while (ssd1306_dma_busy(dev)) {
+        dev->bus->async_aguardar(dev->i2c);
+    }
+}
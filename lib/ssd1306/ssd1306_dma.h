@@ -0,0 +1,66 @@
+/**
+ * @file ssd1306_dma.h
+ * @brief Envio assíncrono do framebuffer SSD1306 via DMA no barramento I²C.
+ *
+ * Este módulo permite atualizar o display OLED sem bloquear o laço principal dentro de
+ * `i2c_write_blocking()`. O desenho continua sendo feito no framebuffer comum (`uint8_t *ssd`),
+ * e `ssd1306_dma_present()` converte as regiões alteradas desse buffer para um dos dois
+ * quadros de transmissão e entrega o quadro ao transporte assíncrono do backend padrão
+ * (`ssd1306_bus.h`): no Pico, um canal DMA ligado ao registrador `IC_DATA_CMD`; no build host,
+ * o emulador, que conclui cada quadro depois do tempo simulado de I²C.
+ *
+ * Funcionamento:
+ * - O I²C do RP2040 exige palavras de 16 bits (dado + bits de STOP) no `IC_DATA_CMD`, por isso
+ *   os quadros de transmissão ficam no formato de palavra; o framebuffer de desenho é liberado
+ *   assim que `ssd1306_dma_present()` retorna.
+ * - Com dois quadros, um pode estar em transmissão enquanto o seguinte fica na fila; o fim de
+ *   cada quadro (interrupção do DMA) dispara o pendente e chama o callback de conclusão.
+ * - `ssd1306_dma_busy()` permite consulta (poll) e `ssd1306_dma_wait()` funciona como barreira
+ *   antes de usar novamente as funções bloqueantes (`render_on_display()` etc.).
+ *
+ * - Alternativamente, `ssd1306_set_bus(&ssd1306_bus_dma)` faz todas as funções do driver
+ *   (`render_on_display()`, `ssd1306_send_data()` etc.) enviarem por este canal DMA. Cada
+ *   transação vai para o endereço recebido do driver, mas sempre pela instância I²C passada
+ *   a `ssd1306_dma_init()`, à qual o canal DMA está ligado.
+ *
+ * Suporta um único display por projeto; no Pico a interrupção usada é a DMA_IRQ_1 (compartilhada).
+ */
+
+#ifndef SSD1306_DMA_H
+#define SSD1306_DMA_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "hardware/i2c.h"
+#include "ssd1306_i2c.h"
+#include "ssd1306_bus.h"
+
+// Pior caso: uma janela por página, cada uma com 7 palavras de comando, o byte 0x40 e 128 colunas
+#define ssd1306_dma_max_words (ssd1306_n_pages * (7 + 1 + ssd1306_width))
+
+typedef void (*ssd1306_dma_callback_t)(void *contexto);
+
+typedef struct {
+    i2c_inst_t *i2c;
+    uint8_t address;
+    const ssd1306_bus_t *bus;                   // transporte assíncrono (backend padrão)
+
+    uint16_t quadro[2][ssd1306_dma_max_words];  // quadros de transmissão (formato IC_DATA_CMD)
+    uint16_t palavras[2];                       // palavras válidas em cada quadro
+    uint8_t endereco[2];                        // endereço I²C de destino de cada quadro
+    uint8_t livre;                              // índice do quadro que recebe o próximo present
+
+    volatile bool em_transmissao;               // DMA ativo com um quadro
+    volatile bool pendente;                     // quadro aguardando o término do atual
+
+    ssd1306_dma_callback_t callback;            // chamado (em interrupção) ao fim de cada quadro
+    void *contexto;
+} ssd1306_dma_t;
+
+void ssd1306_dma_init(ssd1306_dma_t *dev, i2c_inst_t *i2c, uint8_t address);
+void ssd1306_dma_set_callback(ssd1306_dma_t *dev, ssd1306_dma_callback_t callback, void *contexto);
+bool ssd1306_dma_present(ssd1306_dma_t *dev, const uint8_t *ssd);
+bool ssd1306_dma_busy(ssd1306_dma_t *dev);
+void ssd1306_dma_wait(ssd1306_dma_t *dev);
+
+#endif
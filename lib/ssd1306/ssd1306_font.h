@@ -17,6 +17,14 @@
  * como `ssd1306_draw_char()` e `ssd1306_draw_string()`, possibilitando a exibição de textos
  * de forma simples e compacta em sistemas embarcados.
  *
+ * O vetor `font_index[]` associa cada código Latin-1 (0–255) ao índice do glifo em `font[]`;
+ * códigos sem glifo ficam em 0 (caractere vazio). Ao acrescentar um glifo em `font[]`,
+ * basta incluir a linha correspondente em `font_index[]`. As duas tabelas são `const` e ficam
+ * na flash, sem custo de inicialização.
+ *
+ * Para o texto proporcional, `font_span[]` guarda, para cada glifo de `font[]`, a primeira
+ * coluna com pixels e a largura útil (o glifo vazio, usado pelo espaço, tem 3 colunas).
+ *
  * Ideal para aplicações que requerem exibição básica de mensagens em telas pequenas, como no 
  * Raspberry Pi Pico com displays I²C SSD1306.
  */
@@ -25,7 +33,7 @@
 #ifndef SSD1306_FONT_H
 #define SSD1306_FONT_H
 
-static uint8_t font[] = {
+static const uint8_t font[] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //0: Nothing
     0x78, 0x14, 0x12, 0x11, 0x12, 0x14, 0x78, 0x00, //1: A
     0x7f, 0x49, 0x49, 0x49, 0x49, 0x49, 0x7f, 0x00, //2: B
@@ -122,5 +130,142 @@ static uint8_t font[] = {
 
 };
 
-#endif
+// Código Latin-1 -> índice do glifo em font[] (entradas omitidas valem 0: caractere vazio)
+static const uint8_t font_index[256] = {
+    ['A'] = 1,  ['B'] = 2,  ['C'] = 3,  ['D'] = 4,  ['E'] = 5,  ['F'] = 6,
+    ['G'] = 7,  ['H'] = 8,  ['I'] = 9,  ['J'] = 10, ['K'] = 11, ['L'] = 12,
+    ['M'] = 13, ['N'] = 14, ['O'] = 15, ['P'] = 16, ['Q'] = 17, ['R'] = 18,
+    ['S'] = 19, ['T'] = 20, ['U'] = 21, ['V'] = 22, ['W'] = 23, ['X'] = 24,
+    ['Y'] = 25, ['Z'] = 26,
+    ['0'] = 27, ['1'] = 28, ['2'] = 29, ['3'] = 30, ['4'] = 31, ['5'] = 32,
+    ['6'] = 33, ['7'] = 34, ['8'] = 35, ['9'] = 36,
+    ['a'] = 37, ['b'] = 38, ['c'] = 39, ['d'] = 40, ['e'] = 41, ['f'] = 42,
+    ['g'] = 43, ['h'] = 44, ['i'] = 45, ['j'] = 46, ['k'] = 47, ['l'] = 48,
+    ['m'] = 49, ['n'] = 50, ['o'] = 51, ['p'] = 52, ['q'] = 53, ['r'] = 54,
+    ['s'] = 55, ['t'] = 56, ['u'] = 57, ['v'] = 58, ['w'] = 59, ['x'] = 60,
+    ['y'] = 61, ['z'] = 62,
+    ['.'] = 63, [':'] = 64, ['#'] = 65, ['!'] = 66, ['?'] = 67,
+    [0xC3] = 68,  // Ã
+    [0xC2] = 69,  // Â
+    [0xC1] = 70,  // Á
+    [0xC0] = 71,  // À
+    [0xC9] = 72,  // É
+    [0xCA] = 73,  // Ê
+    [0xCD] = 74,  // Í
+    [0xD3] = 75,  // Ó
+    [0xD4] = 76,  // Ô
+    [0xD5] = 77,  // Õ
+    [0xDA] = 78,  // Ú
+    [0xC7] = 79,  // Ç
+    [0xE7] = 80,  // ç
+    [0xE3] = 81,  // ã
+    [0xE1] = 82,  // á
+    [0xE0] = 83,  // à
+    [0xE2] = 84,  // â
+    [0xE9] = 85,  // é
+    [0xEA] = 86,  // ê
+    [0xED] = 87,  // í
+    [0xF3] = 88,  // ó
+    [0xF4] = 89,  // ô
+    [0xFA] = 90,  // ú
+    [','] = 91, ['-'] = 92,
+};
 
+// Glifo de font[] -> {primeira coluna com pixels, largura em colunas} para o texto proporcional
+static const uint8_t font_span[][2] = {
+    {0, 3},  //0: Nothing
+    {0, 7},  //1: A
+    {0, 7},  //2: B
+    {0, 7},  //3: C
+    {0, 7},  //4: D
+    {0, 7},  //5: E
+    {0, 7},  //6: F
+    {0, 7},  //7: G
+    {0, 7},  //8: H
+    {3, 1},  //9: I
+    {0, 7},  //10: J
+    {1, 6},  //11: K
+    {0, 7},  //12: L
+    {0, 7},  //13: M
+    {0, 7},  //14: N
+    {0, 7},  //15: O
+    {0, 7},  //16: P
+    {0, 7},  //17: Q
+    {0, 7},  //18: R
+    {0, 6},  //19: S
+    {0, 7},  //20: T
+    {0, 7},  //21: U
+    {0, 7},  //22: V
+    {0, 7},  //23: W
+    {1, 6},  //24: X
+    {0, 7},  //25: Y
+    {0, 6},  //26: Z
+    {0, 7},  //27: 0
+    {2, 3},  //28: 1
+    {0, 6},  //29: 2
+    {2, 5},  //30: 3
+    {1, 6},  //31: 4
+    {0, 6},  //32: 5
+    {0, 7},  //33: 6
+    {0, 7},  //34: 7
+    {0, 7},  //35: 8
+    {0, 7},  //36: 9
+    {1, 5},  //37: a
+    {1, 5},  //38: b
+    {1, 4},  //39: c
+    {1, 5},  //40: d
+    {1, 5},  //41: e
+    {0, 5},  //42: f
+    {1, 5},  //43: g
+    {1, 5},  //44: h
+    {1, 3},  //45: i
+    {1, 5},  //46: j
+    {1, 4},  //47: k
+    {1, 3},  //48: l
+    {1, 5},  //49: m
+    {1, 5},  //50: n
+    {1, 5},  //51: o
+    {1, 5},  //52: p
+    {1, 5},  //53: q
+    {1, 5},  //54: r
+    {1, 5},  //55: s
+    {1, 5},  //56: t
+    {1, 6},  //57: u
+    {1, 5},  //58: v
+    {1, 5},  //59: w
+    {1, 5},  //60: x
+    {1, 5},  //61: y
+    {1, 5},  //62: z
+    {3, 2},  //63: .
+    {3, 2},  //64: :
+    {1, 6},  //65: #
+    {3, 2},  //66: !
+    {1, 6},  //67: ?
+    {1, 6},  //68: Ã
+    {1, 6},  //69: Â
+    {1, 6},  //70: Á
+    {1, 6},  //71: À
+    {1, 6},  //72: É
+    {1, 6},  //73: Ê
+    {3, 2},  //74: Í
+    {1, 6},  //75: Ó
+    {1, 6},  //76: Ô
+    {1, 6},  //77: Õ
+    {1, 6},  //78: Ú
+    {1, 6},  //79: Ç
+    {1, 6},  //80: ç
+    {2, 5},  //81: ã
+    {2, 5},  //82: á
+    {2, 5},  //83: à
+    {2, 5},  //84: â
+    {1, 5},  //85: é
+    {1, 5},  //86: ê
+    {1, 3},  //87: í
+    {1, 5},  //88: ó
+    {1, 5},  //89: ô
+    {1, 6},  //90: ú
+    {1, 2},  //91: , (vírgula)
+    {1, 4},  //92: -
+};
+
+#endif
@@ -0,0 +1,787 @@
+/**
+ * @file ssd1306_i2c.c
+ * @brief Implementação de funções para controle de displays OLED SSD1306 via interface I²C em sistemas embarcados.
+ *
+ * Este módulo provê uma implementação completa para comunicação e controle de displays OLED
+ * com o controlador SSD1306, utilizando a interface I²C. Abrange desde comandos de configuração,
+ * envio de dados, renderização de caracteres, até suporte parcial a strings em UTF-8 (convertidas para Latin-1).
+ *
+ * Funcionalidades principais:
+ * - Inicialização e configuração do display.
+ * - Escrita de comandos e dados no barramento I²C.
+ * - Renderização de caracteres e strings (com suporte a acentuação comum).
+ * - Desenho de linhas e bitmaps na tela.
+ * - Modo buffer (via `ssd1306_t`) para exibições completas.
+ * - Registro das regiões alteradas (dirty) para envio incremental com `render_dirty_on_display()`.
+ *
+ * Ideal para projetos com Raspberry Pi Pico W ou similares que utilizam telas OLED I²C.
+ *
+ * Dependências:
+ * - `ssd1306_font.h` para os bitmaps dos caracteres.
+ * - `ssd1306_i2c.h` para definições de registradores e estrutura `ssd1306_t`.
+ * - `ssd1306_bus.h` para o backend de barramento (I²C bloqueante, DMA ou emulador).
+ * - Pico SDK: `hardware/i2c.h`, `pico/stdlib.h`.
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <ctype.h>
+#include "pico/stdlib.h"
+#include "pico/binary_info.h"
+#include "hardware/i2c.h"
+#include "ssd1306_font.h"
+#include "ssd1306_i2c.h"
+#include "ssd1306_bus.h"
+
+// ------------------------------------------------------------
+// Regiões alteradas (dirty) por página
+// ------------------------------------------------------------
+// Para cada página guarda o intervalo de colunas [inicio, fim) modificado
+// desde o último envio. Página limpa quando dirty_fim == 0.
+static uint8_t dirty_inicio[ssd1306_n_pages];
+static uint8_t dirty_fim[ssd1306_n_pages];
+
+// Total de bytes entregues ao barramento I²C (após o byte de endereço)
+static uint32_t bytes_enviados = 0;
+
+// Backend de barramento em uso (ssd1306_bus.h); por padrão, I²C bloqueante
+static const ssd1306_bus_t *barramento = &ssd1306_bus_default;
+
+// Troca o backend usado por todas as funções do driver (ex: &ssd1306_bus_dma)
+void ssd1306_set_bus(const ssd1306_bus_t *bus) {
+    barramento = bus ? bus : &ssd1306_bus_default;
+}
+
+// Ponto único de escrita no barramento, contabilizando o tráfego
+static inline void ssd1306_i2c_write_to(i2c_inst_t *i2c, uint8_t address, const uint8_t *data, size_t length) {
+    barramento->write(i2c, address, data, length);
+    bytes_enviados += length;
+}
+
+static inline void ssd1306_i2c_write(const uint8_t *data, size_t length) {
+    ssd1306_i2c_write_to(ssd1306_i2c_port, ssd1306_i2c_address, data, length);
+}
+
+// Monta um fluxo de comandos (byte de controle 0x00 seguido dos comandos) e envia
+// cada bloco de até ssd1306_max_command_stream comandos numa única transação I²C
+static void ssd1306_send_command_stream(i2c_inst_t *i2c, uint8_t address, const uint8_t *commands, int number) {
+    uint8_t buffer[1 + ssd1306_max_command_stream];
+    buffer[0] = 0x00;
+
+    while (number > 0) {
+        int n = number < ssd1306_max_command_stream ? number : ssd1306_max_command_stream;
+        memcpy(buffer + 1, commands, n);
+        ssd1306_i2c_write_to(i2c, address, buffer, n + 1);
+        commands += n;
+        number -= n;
+    }
+}
+
+// Calcular quanto do buffer será destinado à área de renderização
+void calculate_render_area_buffer_length(struct render_area *area) {
+    area->buffer_length = (area->end_column - area->start_column + 1) * (area->end_page - area->start_page + 1);
+}
+
+// Processo de escrita do i2c espera um byte de controle, seguido por dados
+void ssd1306_send_command(uint8_t command) {
+    uint8_t buffer[2] = {0x80, command};
+    ssd1306_i2c_write(buffer, 2);
+}
+
+// Envia uma lista de comandos ao hardware numa única transação
+void ssd1306_send_command_list(uint8_t *ssd, int number) {
+    ssd1306_send_command_stream(ssd1306_i2c_port, ssd1306_i2c_address, ssd, number);
+}
+
+// Envia os dados sem cópia: o byte imediatamente anterior a ssd[0] recebe temporariamente
+// o byte de controle 0x40. O framebuffer precisa reservar esse byte (ssd1306_buffer_prefix);
+// em trechos no meio do buffer o byte emprestado é um pixel, restaurado após o envio.
+void ssd1306_send_buffer(uint8_t ssd[], int buffer_length) {
+    uint8_t *frame = ssd - 1;
+    uint8_t anterior = frame[0];
+
+    frame[0] = 0x40;
+    ssd1306_i2c_write(frame, buffer_length + 1);
+    frame[0] = anterior;
+}
+
+// Cria a lista de comandos (com base nos endereços definidos em ssd1306_i2c.h) para a inicialização do display
+void ssd1306_init() {
+    uint8_t commands[] = {
+        ssd1306_set_display, ssd1306_set_memory_mode, 0x00,
+        ssd1306_set_display_start_line, ssd1306_set_segment_remap | 0x01, 
+        ssd1306_set_mux_ratio, ssd1306_height - 1,
+        ssd1306_set_common_output_direction | 0x08, ssd1306_set_display_offset,
+        0x00, ssd1306_set_common_pin_configuration,
+    
+#if ((ssd1306_width == 128) && (ssd1306_height == 32))
+    0x02,
+#elif ((ssd1306_width == 128) && (ssd1306_height == 64))
+    0x12,
+#else
+    0x02,
+#endif
+        ssd1306_set_display_clock_divide_ratio, 0x80, ssd1306_set_precharge,
+        0xF1, ssd1306_set_vcomh_deselect_level, 0x30, ssd1306_set_contrast,
+        0xFF, ssd1306_set_entire_on, ssd1306_set_normal_display,
+        ssd1306_set_charge_pump, 0x14, ssd1306_set_scroll | 0x00,
+        ssd1306_set_display | 0x01,
+    };
+
+    ssd1306_send_command_list(commands, count_of(commands));
+}
+
+// Cria a lista de comandos para configurar o scrolling
+void ssd1306_scroll(bool set) {
+    uint8_t commands[] = {
+        ssd1306_set_horizontal_scroll | 0x00, 0x00, 0x00, 0x00, 0x03,
+        0x00, 0xFF, ssd1306_set_scroll | (set ? 0x01 : 0)
+    };
+
+    ssd1306_send_command_list(commands, count_of(commands));
+}
+
+// Atualiza uma parte do display com uma área de renderização
+// (ssd deve apontar para um framebuffer com o byte de prefixo reservado)
+void render_on_display(uint8_t *ssd, struct render_area *area) {
+    uint8_t commands[] = {
+        ssd1306_set_column_address, area->start_column, area->end_column,
+        ssd1306_set_page_address, area->start_page, area->end_page
+    };
+
+    ssd1306_send_command_list(commands, count_of(commands));
+    ssd1306_send_buffer(ssd, area->buffer_length);
+
+    // Páginas cujo intervalo alterado foi coberto pelo envio ficam limpas
+    for (int page = area->start_page; page <= area->end_page; page++) {
+        if (dirty_inicio[page] >= area->start_column && dirty_fim[page] <= area->end_column + 1) {
+            dirty_fim[page] = 0;
+        }
+    }
+}
+
+// Marca como alterado o retângulo (em pixels, inclusivo) para o próximo render_dirty_on_display()
+void ssd1306_mark_dirty(int x_0, int y_0, int x_1, int y_1) {
+    if (x_0 < 0) x_0 = 0;
+    if (y_0 < 0) y_0 = 0;
+    if (x_1 > ssd1306_width - 1) x_1 = ssd1306_width - 1;
+    if (y_1 > ssd1306_height - 1) y_1 = ssd1306_height - 1;
+    if (x_0 > x_1 || y_0 > y_1) {
+        return;
+    }
+
+    for (int page = y_0 / 8; page <= y_1 / 8; page++) {
+        if (dirty_fim[page] == 0) {
+            dirty_inicio[page] = x_0;
+            dirty_fim[page] = x_1 + 1;
+        }
+        else {
+            if (x_0 < dirty_inicio[page]) dirty_inicio[page] = x_0;
+            if (x_1 + 1 > dirty_fim[page]) dirty_fim[page] = x_1 + 1;
+        }
+    }
+}
+
+// Retira a próxima janela alterada: páginas consecutivas com o mesmo intervalo de colunas
+// viram uma única área, que é marcada como limpa. Retorna false quando não há mais alterações.
+bool ssd1306_take_dirty_area(struct render_area *area) {
+    uint page = 0;
+    while (page < ssd1306_n_pages && dirty_fim[page] == 0) {
+        page++;
+    }
+    if (page == ssd1306_n_pages) {
+        return false;
+    }
+
+    uint8_t col_inicio = dirty_inicio[page];
+    uint8_t col_fim = dirty_fim[page];
+    uint page_fim = page;
+
+    while (page_fim + 1 < ssd1306_n_pages &&
+           dirty_fim[page_fim + 1] == col_fim && dirty_inicio[page_fim + 1] == col_inicio) {
+        page_fim++;
+    }
+
+    for (uint p = page; p <= page_fim; p++) {
+        dirty_fim[p] = 0;
+    }
+
+    area->start_column = col_inicio;
+    area->end_column = col_fim - 1;
+    area->start_page = page;
+    area->end_page = page_fim;
+    calculate_render_area_buffer_length(area);
+    return true;
+}
+
+// Envia apenas as colunas alteradas de cada página, usando a janela de coluna/página do SSD1306.
+// Retorna a quantidade de bytes colocados no barramento I²C neste envio.
+int render_dirty_on_display(uint8_t *ssd) {
+    uint32_t inicio_envio = bytes_enviados;
+    struct render_area janela;
+
+    while (ssd1306_take_dirty_area(&janela)) {
+        uint8_t commands[] = {
+            ssd1306_set_column_address, janela.start_column, janela.end_column,
+            ssd1306_set_page_address, janela.start_page, janela.end_page
+        };
+        ssd1306_send_command_list(commands, count_of(commands));
+
+        // O ponteiro de escrita do SSD1306 avança dentro da janela entre transações,
+        // então cada página pode ser enviada separadamente; largura total é contígua no buffer.
+        int largura = janela.end_column - janela.start_column + 1;
+        if (largura == ssd1306_width) {
+            ssd1306_send_buffer(&ssd[janela.start_page * ssd1306_width], janela.buffer_length);
+        }
+        else {
+            for (int p = janela.start_page; p <= janela.end_page; p++) {
+                ssd1306_send_buffer(&ssd[p * ssd1306_width + janela.start_column], largura);
+            }
+        }
+    }
+
+    return (int)(bytes_enviados - inicio_envio);
+}
+
+// Total acumulado de bytes enviados ao display desde a inicialização
+uint32_t ssd1306_bytes_sent(void) {
+    return bytes_enviados;
+}
+
+// Determina o pixel a ser aceso (no display) de acordo com a coordenada fornecida
+void ssd1306_set_pixel(uint8_t *ssd, int x, int y, bool set) {
+    assert(x >= 0 && x < ssd1306_width && y >= 0 && y < ssd1306_height);
+
+    const int bytes_per_row = ssd1306_width;
+
+    int byte_idx = (y / 8) * bytes_per_row + x;
+    uint8_t byte = ssd[byte_idx];
+
+    if (set) {
+        byte |= 1 << (y % 8);
+    }
+    else {
+        byte &= ~(1 << (y % 8));
+    }
+
+    ssd[byte_idx] = byte;
+    ssd1306_mark_dirty(x, y, x, y);
+}
+
+// Algoritmo de Bresenham básico
+void ssd1306_draw_line(uint8_t *ssd, int x_0, int y_0, int x_1, int y_1, bool set) {
+    int dx = abs(x_1 - x_0); // Deslocamentos
+    int dy = -abs(y_1 - y_0);
+    int sx = x_0 < x_1 ? 1 : -1; // Direção de avanço
+    int sy = y_0 < y_1 ? 1 : -1;
+    int error = dx + dy; // Erro acumulado
+    int error_2;
+
+    while (true) {
+        ssd1306_set_pixel(ssd, x_0, y_0, set); // Acende pixel no ponto atual
+        if (x_0 == x_1 && y_0 == y_1) {
+            break; // Verifica se o ponto final foi alcançado
+        }
+
+        error_2 = 2 * error; // Ajusta o erro acumulado
+
+        if (error_2 >= dy) {
+            error += dy;
+            x_0 += sx; // Avança na direção x
+        }
+        if (error_2 <= dx) {
+            error += dx;
+            y_0 += sy; // Avança na direção y
+        }
+    }
+}
+
+// ------------------------------------------------------------
+// Função auxiliar para obter índice da fonte no array `font`
+// (consulta direta em `font_index`, gerada junto com a fonte)
+// ------------------------------------------------------------
+static inline int ssd1306_get_font(uint8_t character) {
+    return font_index[character];
+}
+
+// ------------------------------------------------------------
+// Decodifica o próximo caractere UTF-8 de `*utf8` e devolve o código Latin-1.
+// Consome a sequência inteira; sequências inválidas, truncadas ou fora do
+// Latin-1 (ex: emojis) viram 0 (caractere vazio) em vez de ler além do '\0'.
+// ------------------------------------------------------------
+static inline uint8_t ssd1306_utf8_next(const char **utf8) {
+    const uint8_t *s = (const uint8_t *)*utf8;
+    uint8_t c = *s++;
+    uint8_t latin1 = 0;
+
+    if (c < 0x80) {
+        latin1 = c;                                  // ASCII puro (0x00–0x7F)
+    }
+    else if ((c & 0xE0) == 0xC0 && (*s & 0xC0) == 0x80) {
+        // UTF-8 de 2 bytes (ex: ç, é, ã, ó): só C2/C3 caem no Latin-1
+        if (c <= 0xC3) {
+            latin1 = ((c & 0x1F) << 6) | (*s & 0x3F);
+        }
+        s++;
+    }
+    else {
+        // Byte de continuação solto ou UTF-8 de 3+ bytes: pula a sequência inteira
+        while ((*s & 0xC0) == 0x80) {
+            s++;
+        }
+    }
+
+    *utf8 = (const char *)s;
+    return latin1;
+}
+
+// Desenha um único caractere no display
+void ssd1306_draw_char(uint8_t *ssd, int16_t x, int16_t y, uint8_t character) {
+    if (x > ssd1306_width - 8 || y > ssd1306_height - 8) {
+        return;
+    }
+
+    y = y / 8;
+
+    //character = toupper(character);
+    int idx = ssd1306_get_font(character);
+    int fb_idx = y * 128 + x;
+
+    for (int i = 0; i < 8; i++) {
+        ssd[fb_idx++] = font[idx * 8 + i];
+    }
+
+    ssd1306_mark_dirty(x, y * 8, x + 7, y * 8 + 7);
+}
+
+// Desenha uma string, chamando a função de desenhar caractere várias vezes
+void ssd1306_draw_string(uint8_t *ssd, int16_t x, int16_t y, const char *string) {
+    if (x > ssd1306_width - 8 || y > ssd1306_height - 8) {
+        return;
+    }
+
+    while (*string) {
+        ssd1306_draw_char(ssd, x, y, *string++);
+        x += 8;
+    }
+}
+
+// Apaga o framebuffer inteiro e envia a tela limpa ao display
+void ssd1306_clear_display(uint8_t *ssd) {
+    struct render_area area = {
+        .start_column = 0,
+        .end_column = ssd1306_width - 1,
+        .start_page = 0,
+        .end_page = ssd1306_n_pages - 1
+    };
+
+    memset(ssd, 0, ssd1306_buffer_length);
+    calculate_render_area_buffer_length(&area);
+    render_on_display(ssd, &area);
+}
+
+// Comando de configuração com base na estrutura ssd1306_t
+void ssd1306_command(ssd1306_t *ssd, uint8_t command) {
+  ssd->port_buffer[1] = command;
+  ssd1306_i2c_write_to(ssd->i2c_port, ssd->address, ssd->port_buffer, 2);
+}
+
+// Função de configuração do display para o caso do bitmap
+void ssd1306_config(ssd1306_t *ssd) {
+    const uint8_t commands[] = {
+        ssd1306_set_display | 0x00,
+        ssd1306_set_memory_mode, 0x01,
+        ssd1306_set_display_start_line | 0x00,
+        ssd1306_set_segment_remap | 0x01,
+        ssd1306_set_mux_ratio, ssd1306_height - 1,
+        ssd1306_set_common_output_direction | 0x08,
+        ssd1306_set_display_offset, 0x00,
+        ssd1306_set_common_pin_configuration, 0x12,
+        ssd1306_set_display_clock_divide_ratio, 0x80,
+        ssd1306_set_precharge, 0xF1,
+        ssd1306_set_vcomh_deselect_level, 0x30,
+        ssd1306_set_contrast, 0xFF,
+        ssd1306_set_entire_on,
+        ssd1306_set_normal_display,
+        ssd1306_set_charge_pump, 0x14,
+        ssd1306_set_display | 0x01,
+    };
+
+    ssd1306_send_command_stream(ssd->i2c_port, ssd->address, commands, count_of(commands));
+}
+
+// Inicializa o display para o caso de exibição de bitmap
+void ssd1306_init_bm(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_vcc, uint8_t address, i2c_inst_t *i2c) {
+    ssd->width = width;
+    ssd->height = height;
+    ssd->pages = height / 8U;
+    ssd->address = address;
+    ssd->i2c_port = i2c;
+    ssd->bufsize = ssd->pages * ssd->width + 1;
+    ssd->ram_buffer = calloc(ssd->bufsize, sizeof(uint8_t));
+    ssd->ram_buffer[0] = 0x40;
+    ssd->port_buffer[0] = 0x80;
+}
+
+// Envia os dados ao display: uma transação para a janela e outra para o ram_buffer,
+// que já traz o byte de controle 0x40 na posição 0
+void ssd1306_send_data(ssd1306_t *ssd) {
+    const uint8_t commands[] = {
+        ssd1306_set_column_address, 0, ssd->width - 1,
+        ssd1306_set_page_address, 0, ssd->pages - 1
+    };
+
+    ssd1306_send_command_stream(ssd->i2c_port, ssd->address, commands, count_of(commands));
+    ssd1306_i2c_write_to(ssd->i2c_port, ssd->address, ssd->ram_buffer, ssd->bufsize);
+}
+
+// Desenha o bitmap (a ser fornecido em display_oled.c) no display
+// (uma única cópia para o ram_buffer seguida de um único envio)
+void ssd1306_draw_bitmap(ssd1306_t *ssd, const uint8_t *bitmap) {
+    memcpy(ssd->ram_buffer + 1, bitmap, ssd->bufsize - 1);
+    ssd1306_send_data(ssd);
+}
+
+// Aplica a operação raster apenas nos bits de `mask` do byte de destino
+static inline uint8_t ssd1306_rop_apply(uint8_t dst, uint8_t src, uint8_t mask, ssd1306_rop_t rop) {
+    src &= mask;
+    switch (rop) {
+        case SSD1306_ROP_OR:  return dst | src;
+        case SSD1306_ROP_AND: return dst & (src | (uint8_t)~mask);
+        case SSD1306_ROP_XOR: return dst ^ src;
+        default:              return (dst & (uint8_t)~mask) | src;
+    }
+}
+
+// Copia um sprite 1bpp de w x h pixels para o ram_buffer na posição (x, y), sem enviar ao display.
+// O sprite segue o layout do ram_buffer (modo de endereçamento vertical): para cada coluna,
+// (h + 7) / 8 bytes consecutivos, um por página, com o bit menos significativo no topo.
+// Posições parcial ou totalmente fora da tela são recortadas. Após compor a tela, chame
+// ssd1306_send_data() uma única vez.
+void ssd1306_blit(ssd1306_t *ssd, const uint8_t *sprite, int16_t x, int16_t y, uint8_t w, uint8_t h, ssd1306_rop_t rop) {
+    if (w == 0 || h == 0) {
+        return;
+    }
+
+    const int sprite_pages = (h + 7) / 8;
+    const uint8_t mask_final = (h % 8) ? (uint8_t)((1u << (h % 8)) - 1) : 0xFF; // bits válidos da última página
+
+    // Recorte horizontal
+    int col_inicio = x < 0 ? -x : 0;
+    int col_fim = (x + w > ssd->width) ? ssd->width - x : w;
+    if (col_inicio >= col_fim) {
+        return;
+    }
+
+    // Página e deslocamento de destino (divisão arredondando para baixo, válida para y < 0)
+    const int page0 = (y >= 0) ? y / 8 : -((-y + 7) / 8);
+    const int shift = y - page0 * 8;
+    const int pages = ssd->pages;
+    uint8_t *ram = ssd->ram_buffer + 1;
+
+    if (shift == 0) {
+        // Caminho alinhado: cada página do sprite cai inteira numa página da tela
+        const bool sem_recorte = page0 >= 0 && page0 + sprite_pages <= pages;
+
+        for (int c = col_inicio; c < col_fim; c++) {
+            const uint8_t *src = &sprite[c * sprite_pages];
+            uint8_t *dst = &ram[(x + c) * pages + page0];
+
+            if (sem_recorte && rop == SSD1306_ROP_COPY && mask_final == 0xFF) {
+                memcpy(dst, src, sprite_pages);
+                continue;
+            }
+
+            for (int k = 0; k < sprite_pages; k++) {
+                int page = page0 + k;
+                if (page < 0 || page >= pages) {
+                    continue;
+                }
+                uint8_t mask = (k == sprite_pages - 1) ? mask_final : 0xFF;
+                dst[k] = ssd1306_rop_apply(dst[k], src[k], mask, rop);
+            }
+        }
+        return;
+    }
+
+    // Caminho deslocado: cada byte do sprite se divide entre duas páginas consecutivas da tela
+    for (int c = col_inicio; c < col_fim; c++) {
+        const uint8_t *src = &sprite[c * sprite_pages];
+        uint8_t *dst = &ram[(x + c) * pages];
+
+        for (int k = 0; k < sprite_pages; k++) {
+            uint8_t mask = (k == sprite_pages - 1) ? mask_final : 0xFF;
+            uint16_t bits = (uint16_t)src[k] << shift;
+            uint16_t bits_mask = (uint16_t)mask << shift;
+            int page = page0 + k;
+
+            if (page >= 0 && page < pages) {
+                dst[page] = ssd1306_rop_apply(dst[page], bits & 0xFF, bits_mask & 0xFF, rop);
+            }
+            if (page + 1 >= 0 && page + 1 < pages && (bits_mask >> 8)) {
+                dst[page + 1] = ssd1306_rop_apply(dst[page + 1], bits >> 8, bits_mask >> 8, rop);
+            }
+        }
+    }
+}
+
+// Função que converte string UTF-8 para Latin-1 e imprime no OLED
+void ssd1306_draw_utf8_string(uint8_t *ssd, int16_t x, int16_t y, const char *utf8_string) {
+    if (x > ssd1306_width - 8 || y > ssd1306_height - 8) {
+        return;
+    }
+
+    while (*utf8_string) {
+        ssd1306_draw_char(ssd, x, y, ssd1306_utf8_next(&utf8_string));
+        x += 8; // Avança 8 pixels por caractere
+    }
+}
+
+void ssd1306_draw_utf8_multiline(uint8_t *ssd, int16_t x, int16_t y, const char *utf8_string) {
+    const int max_width = ssd1306_width;
+    const int max_height = ssd1306_height;
+    const int char_width = 8;
+    const int char_height = 8;
+
+    while (*utf8_string && y <= (max_height - char_height)) {
+        ssd1306_draw_char(ssd, x, y, ssd1306_utf8_next(&utf8_string));
+
+        x += char_width;
+
+        if (x > (max_width - char_width)) {
+            x = 0;
+            y += char_height;
+        }
+    }
+}
+
+// ------------------------------------------------------------
+// Texto proporcional: cada glifo ocupa só as colunas com pixels (font_span)
+// mais 1 coluna de espaçamento. Como em ssd1306_draw_char, y é arredondado
+// para a página (múltiplo de 8) e as linhas têm 8 pixels de altura.
+// ------------------------------------------------------------
+
+// Avanço horizontal de um caractere Latin-1: largura do glifo + espaçamento
+static inline int ssd1306_text_advance(uint8_t character) {
+    return font_span[font_index[character]][1] + 1;
+}
+
+// Copia as colunas do glifo (e a coluna de espaçamento) para a página, recortando nas bordas
+static inline int ssd1306_draw_glyph(uint8_t *row, int x, uint8_t character) {
+    int idx = font_index[character];
+    const uint8_t *glyph = &font[idx * 8 + font_span[idx][0]];
+    int width = font_span[idx][1];
+
+    for (int i = 0; i <= width; i++, x++) {
+        if (x >= 0 && x < ssd1306_width) {
+            row[x] = (i < width) ? glyph[i] : 0x00;
+        }
+    }
+    return width + 1;
+}
+
+// Desenha os caracteres de [utf8_string, end) a partir de x; retorna o x seguinte
+static int ssd1306_draw_text_run(uint8_t *ssd, int x, int y, const char *utf8_string, const char *end) {
+    int page = y / 8;
+    int x_0 = x;
+
+    while (utf8_string < end) {
+        x += ssd1306_draw_glyph(&ssd[page * ssd1306_width], x, ssd1306_utf8_next(&utf8_string));
+    }
+
+    if (x > x_0) {
+        ssd1306_mark_dirty(x_0, page * 8, x - 1, page * 8 + 7);
+    }
+    return x;
+}
+
+// Largura, em pixels, do texto proporcional até '\0' ou '\n' (sem o espaçamento final)
+int ssd1306_text_width(const char *utf8_string) {
+    int width = 0;
+
+    while (*utf8_string && *utf8_string != '\n') {
+        width += ssd1306_text_advance(ssd1306_utf8_next(&utf8_string));
+    }
+    return width > 0 ? width - 1 : 0;
+}
+
+// Desenha texto proporcional em (x, y) até '\0' ou '\n'; retorna o x após o último caractere
+int ssd1306_draw_text(uint8_t *ssd, int16_t x, int16_t y, const char *utf8_string) {
+    if (y < 0 || y > ssd1306_height - 8) {
+        return x;
+    }
+
+    const char *end = utf8_string;
+    while (*end && *end != '\n') {
+        end++;
+    }
+    return ssd1306_draw_text_run(ssd, x, y, utf8_string, end);
+}
+
+// Desenha uma linha de texto alinhada dentro da faixa [x, x + width)
+void ssd1306_draw_text_aligned(uint8_t *ssd, int16_t x, int16_t y, int16_t width, const char *utf8_string, ssd1306_align_t align) {
+    int text_width = ssd1306_text_width(utf8_string);
+
+    if (align == SSD1306_ALIGN_CENTER) {
+        x += (width - text_width) / 2;
+    }
+    else if (align == SSD1306_ALIGN_RIGHT) {
+        x += width - text_width;
+    }
+    ssd1306_draw_text(ssd, x, y, utf8_string);
+}
+
+// Quebra o texto em linhas de até `width` pixels (nos espaços, ou no meio da palavra se ela
+// não couber sozinha), respeitando '\n', e desenha cada linha com o alinhamento pedido.
+// Uma única passada pelo texto, sem alocação: cada linha é medida e desenhada em seguida.
+// Linhas acima da tela (y < 0) não são desenhadas, mas avançam o y, o que permite rolar o texto.
+// Retorna o y da linha seguinte à última desenhada.
+int16_t ssd1306_draw_text_wrapped(uint8_t *ssd, int16_t x, int16_t y, int16_t width, const char *utf8_string, ssd1306_align_t align) {
+    while (*utf8_string && y <= ssd1306_height - 8) {
+        const char *cursor = utf8_string;
+        const char *end = utf8_string;       // fim (exclusivo) da linha atual
+        const char *space = NULL;            // último espaço visto na linha
+        int line_width = 0;                  // soma dos avanços até `end`
+        int space_width = 0;                 // soma dos avanços antes de `space`
+
+        while (*cursor && *cursor != '\n') {
+            const char *start = cursor;
+            uint8_t character = ssd1306_utf8_next(&cursor);
+            int advance = ssd1306_text_advance(character);
+
+            if (character == ' ') {
+                space = start;
+                space_width = line_width;
+            }
+            if (line_width + advance - 1 > width && start != utf8_string) {
+                if (space) {
+                    end = space;
+                    line_width = space_width;
+                }
+                break;
+            }
+            line_width += advance;
+            end = cursor;
+        }
+
+        int offset = 0;
+        int text_width = line_width > 0 ? line_width - 1 : 0;
+        if (align == SSD1306_ALIGN_CENTER) {
+            offset = (width - text_width) / 2;
+        }
+        else if (align == SSD1306_ALIGN_RIGHT) {
+            offset = width - text_width;
+        }
+        if (y >= 0) {
+            ssd1306_draw_text_run(ssd, x + offset, y, utf8_string, end);
+        }
+
+        utf8_string = end;
+        if (*utf8_string == '\n') {
+            utf8_string++;
+        }
+        else {
+            while (*utf8_string == ' ') {
+                utf8_string++;
+            }
+        }
+        y += 8;
+    }
+    return y;
+}
+
+/**/
+
+// ------------------------------------------------------------
+// Retângulos no framebuffer de render_area (uint8_t *ssd)
+// ------------------------------------------------------------
+
+// Acesso em palavras de 32 bits ao framebuffer (que é um vetor de bytes)
+typedef uint32_t __attribute__((may_alias)) ssd1306_word_t;
+
+// Aplica ((byte & ~clr) | set) ^ inv em n bytes consecutivos de uma página.
+// O início do framebuffer não é alinhado (há o byte de prefixo), então os bytes
+// até o próximo endereço múltiplo de 4 são tratados um a um antes das palavras.
+static void ssd1306_span_apply(uint8_t *dst, int n, uint8_t clr, uint8_t set, uint8_t inv) {
+    while (n > 0 && ((uintptr_t)dst & 3)) {
+        *dst = (uint8_t)(((*dst & ~clr) | set) ^ inv);
+        dst++;
+        n--;
+    }
+
+    uint32_t clr32 = clr * 0x01010101u;
+    uint32_t set32 = set * 0x01010101u;
+    uint32_t inv32 = inv * 0x01010101u;
+    ssd1306_word_t *word = (ssd1306_word_t *)dst;
+    for (; n >= 4; n -= 4, word++) {
+        *word = ((*word & ~clr32) | set32) ^ inv32;
+    }
+
+    dst = (uint8_t *)word;
+    while (n-- > 0) {
+        *dst = (uint8_t)(((*dst & ~clr) | set) ^ inv);
+        dst++;
+    }
+}
+
+// Recorta o retângulo na tela e aplica a operação página a página, com a máscara
+// de bits de cada página calculada uma única vez para toda a faixa de colunas.
+// op: 0 = acende, 1 = apaga, 2 = inverte.
+static void ssd1306_rect_apply(uint8_t *ssd, int x, int y, int w, int h, int op) {
+    int x_1 = x + w - 1;
+    int y_1 = y + h - 1;
+
+    if (x < 0) x = 0;
+    if (y < 0) y = 0;
+    if (x_1 > ssd1306_width - 1) x_1 = ssd1306_width - 1;
+    if (y_1 > ssd1306_height - 1) y_1 = ssd1306_height - 1;
+    if (w <= 0 || h <= 0 || x > x_1 || y > y_1) {
+        return;
+    }
+
+    int first_page = y / 8;
+    int last_page = y_1 / 8;
+    int columns = x_1 - x + 1;
+
+    for (int page = first_page; page <= last_page; page++) {
+        uint8_t mask = 0xFF;
+        if (page == first_page) mask &= (uint8_t)(0xFF << (y & 7));
+        if (page == last_page)  mask &= (uint8_t)(0xFF >> (7 - (y_1 & 7)));
+
+        ssd1306_span_apply(&ssd[page * ssd1306_width + x], columns,
+                           op == 1 ? mask : 0, op == 0 ? mask : 0, op == 2 ? mask : 0);
+    }
+
+    ssd1306_mark_dirty(x, y, x_1, y_1);
+}
+
+// Acende todos os pixels do retângulo de w x h pixels a partir de (x, y)
+void ssd1306_fill_rect(uint8_t *ssd, int x, int y, int w, int h) {
+    ssd1306_rect_apply(ssd, x, y, w, h, 0);
+}
+
+// Apaga todos os pixels do retângulo de w x h pixels a partir de (x, y)
+void ssd1306_clear_rect(uint8_t *ssd, int x, int y, int w, int h) {
+    ssd1306_rect_apply(ssd, x, y, w, h, 1);
+}
+
+// Inverte todos os pixels do retângulo (ex: destacar um item de menu)
+void ssd1306_invert_rect(uint8_t *ssd, int x, int y, int w, int h) {
+    ssd1306_rect_apply(ssd, x, y, w, h, 2);
+}
+
+// Caixa com moldura de 1 pixel e interior apagado, pronta para receber texto
+void ssd1306_draw_box(uint8_t *ssd, int x, int y, int w, int h) {
+    ssd1306_clear_rect(ssd, x + 1, y + 1, w - 2, h - 2);
+    ssd1306_fill_rect(ssd, x, y, w, 1);
+    ssd1306_fill_rect(ssd, x, y + h - 1, w, 1);
+    ssd1306_fill_rect(ssd, x, y + 1, 1, h - 2);
+    ssd1306_fill_rect(ssd, x + w - 1, y + 1, 1, h - 2);
+}
+
+// Apaga a área entre (x_start, y_start) e (x_end, y_end), coordenadas inclusivas
+void ssd1306_clear_area(uint8_t *buffer, uint8_t x_start, uint8_t y_start, uint8_t x_end, uint8_t y_end) {
+    ssd1306_clear_rect(buffer, x_start, y_start, x_end - x_start + 1, y_end - y_start + 1);
+}
@@ -13,6 +13,10 @@
  * - Estrutura `render_area` para delimitar áreas específicas da tela a serem renderizadas.
  * - Estrutura `ssd1306_t` que encapsula propriedades da tela e ponteiros para buffers.
  * - Funções para desenhar texto UTF-8: `ssd1306_draw_utf8_string()` e `ssd1306_draw_utf8_multiline()`.
+ * - Retângulos no framebuffer (`ssd1306_fill_rect()`, `ssd1306_clear_rect()`, `ssd1306_invert_rect()`,
+ *   `ssd1306_draw_box()`), aplicados página a página com máscaras de bits e escritas de 32 bits.
+ * - Texto proporcional (`ssd1306_draw_text()`, `ssd1306_text_width()`), com alinhamento e quebra
+ *   de linha (`ssd1306_draw_text_aligned()`, `ssd1306_draw_text_wrapped()`).
  *
  * Este módulo é base para projetos gráficos embarcados com microcontroladores, como o Raspberry Pi Pico,
  * oferecendo controle direto e de baixo nível sobre o display OLED via comandos SSD1306 padronizados.
@@ -28,6 +32,10 @@
 void ssd1306_draw_utf8_string(uint8_t *ssd, int16_t x, int16_t y, const char *utf8_string);
 void ssd1306_draw_utf8_multiline(uint8_t *ssd, int16_t x, int16_t y, const char *utf8_string);
 void ssd1306_clear_area(uint8_t *buffer, uint8_t x_start, uint8_t y_start, uint8_t x_end, uint8_t y_end);
+void ssd1306_fill_rect(uint8_t *ssd, int x, int y, int w, int h);
+void ssd1306_clear_rect(uint8_t *ssd, int x, int y, int w, int h);
+void ssd1306_invert_rect(uint8_t *ssd, int x, int y, int w, int h);
+void ssd1306_draw_box(uint8_t *ssd, int x, int y, int w, int h);
 
 
 #ifndef ssd1306_inc_h
@@ -38,6 +46,10 @@ void ssd1306_clear_area(uint8_t *buffer, uint8_t x_start, uint8_t y_start, uint8
 
 #define ssd1306_i2c_address _u(0x3C) // Define o endereço do i2c do display
 
+#ifndef ssd1306_i2c_port
+#define ssd1306_i2c_port i2c1 // Instância I²C usada pelas funções sem ssd1306_t (pode ser redefinida no CMake)
+#endif
+
 #define ssd1306_i2c_clock 400 // Define o tempo do clock (pode ser aumentado)
 
 // Comandos de configuração (endereços)
@@ -72,6 +84,14 @@ void ssd1306_clear_area(uint8_t *buffer, uint8_t x_start, uint8_t y_start, uint8
 #define ssd1306_n_pages (ssd1306_height / ssd1306_page_height)
 #define ssd1306_buffer_length (ssd1306_n_pages * ssd1306_width)
 
+// Framebuffers reservam um byte antes dos pixels para o byte de controle 0x40,
+// permitindo que ssd1306_send_buffer() envie direto do buffer, sem cópia
+#define ssd1306_buffer_prefix 1
+#define ssd1306_framebuffer_length (ssd1306_buffer_prefix + ssd1306_buffer_length)
+
+// Máximo de comandos agrupados numa única transação I²C (prefixo 0x00)
+#define ssd1306_max_command_stream 32
+
 #define ssd1306_write_mode _u(0xFE)
 #define ssd1306_read_mode _u(0xFF)
 
@@ -84,6 +104,21 @@ struct render_area {
     int buffer_length;
 };
 
+// Operações raster usadas por ssd1306_blit()
+typedef enum {
+    SSD1306_ROP_COPY,   // substitui os pixels cobertos pelo sprite
+    SSD1306_ROP_OR,     // acende os pixels acesos do sprite
+    SSD1306_ROP_AND,    // apaga onde o sprite está apagado
+    SSD1306_ROP_XOR     // inverte onde o sprite está aceso
+} ssd1306_rop_t;
+
+// Alinhamento horizontal do texto proporcional
+typedef enum {
+    SSD1306_ALIGN_LEFT,
+    SSD1306_ALIGN_CENTER,
+    SSD1306_ALIGN_RIGHT
+} ssd1306_align_t;
+
 typedef struct {
   uint8_t width, height, pages, address;
   i2c_inst_t * i2c_port;
@@ -93,4 +128,10 @@ typedef struct {
   uint8_t port_buffer[2];
 } ssd1306_t;
 
+// Texto proporcional (largura de cada glifo em font_span[])
+int ssd1306_text_width(const char *utf8_string);
+int ssd1306_draw_text(uint8_t *ssd, int16_t x, int16_t y, const char *utf8_string);
+void ssd1306_draw_text_aligned(uint8_t *ssd, int16_t x, int16_t y, int16_t width, const char *utf8_string, ssd1306_align_t align);
+int16_t ssd1306_draw_text_wrapped(uint8_t *ssd, int16_t x, int16_t y, int16_t width, const char *utf8_string, ssd1306_align_t align);
+
 #endif
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include "pico/stdlib.h"
 #include "FreeRTOS.h"
 #include "task.h"
+#include "adc_varredura.h"
 
 #include "setup/setup.h"
 #include "setup/led/led.h"
@@ -11,6 +12,16 @@
 #define ADC_VRX_CHANNEL 1
 #define ADC_MICROPHONE_CHANNEL 2
 
+// Joystick e microfone são amostrados juntos pelo ADC em round-robin, 8 kHz por entrada (a taxa
+// que o microfone pede), num anel de 4096 amostras; cada bloco de 512 (21 ms) vira média,
+// mínimo e máximo por entrada
+#define ADC_SAMPLE_RATE_HZ 8000
+#define ADC_RING_LOG2 12
+#define ADC_BLOCK_LOG2 9
+
+ADC_ANEL_BUFFER(adc_buffer, ADC_RING_LOG2);
+adc_varredura_t adc_scan;
+
 // Handles das tarefas
 TaskHandle_t selfTest = NULL;
 TaskHandle_t aliveTask = NULL;
@@ -75,11 +86,8 @@ void test_buttons()
 
 void test_joystick()
 {
-    adc_select_input(ADC_VRY_CHANNEL);
-    uint16_t raw_y = adc_read();
-
-    adc_select_input(ADC_VRX_CHANNEL);
-    uint16_t raw_x = adc_read();
+    uint16_t raw_y = adc_varredura_valor(&adc_scan, ADC_VRY_CHANNEL);
+    uint16_t raw_x = adc_varredura_valor(&adc_scan, ADC_VRX_CHANNEL);
 
     printf("Joystick X: %4d\n", raw_x);
     printf("Joystick Y: %4d\n", raw_y);
@@ -87,10 +95,11 @@ void test_joystick()
 
 void test_microphone()
 {
-    adc_select_input(ADC_MICROPHONE_CHANNEL);
-    uint16_t mic_level = adc_read();
+    // Média e excursão (máximo - mínimo) do último bloco: uma amostra solta não diz o nível do som
+    adc_varredura_leitura_t mic;
+    adc_varredura_ler(&adc_scan, ADC_MICROPHONE_CHANNEL, &mic);
 
-    printf("Nível do microfone: %4d\n", mic_level);
+    printf("Nível do microfone: %4d (pico a pico: %4d)\n", mic.media, mic.max - mic.min);
 }
 
 // Task A
@@ -147,12 +156,10 @@ void joystick_monitor_alarm(void *parameter)
 
     while (true)
     {
-        adc_select_input(ADC_VRY_CHANNEL);
-        uint16_t raw_y = adc_read();
+        uint16_t raw_y = adc_varredura_valor(&adc_scan, ADC_VRY_CHANNEL);
         float voltage_y = (raw_y * VREF) / ADC_MAX;
 
-        adc_select_input(ADC_VRX_CHANNEL);
-        uint16_t raw_x = adc_read();
+        uint16_t raw_x = adc_varredura_valor(&adc_scan, ADC_VRX_CHANNEL);
         float voltage_x = (raw_x * VREF) / ADC_MAX;
 
         printf("Tarefa 3: Tensão -> X: %.3f V | Y: %.3f V\n", voltage_x, voltage_y);
@@ -174,6 +181,14 @@ int main()
 {
     setup();
 
+    if (!adc_varredura_iniciar(&adc_scan, adc_buffer, ADC_RING_LOG2, ADC_BLOCK_LOG2,
+                               ADC_VARREDURA_ENTRADA(ADC_VRY_CHANNEL) | ADC_VARREDURA_ENTRADA(ADC_VRX_CHANNEL) |
+                                   ADC_VARREDURA_ENTRADA(ADC_MICROPHONE_CHANNEL),
+                               ADC_SAMPLE_RATE_HZ))
+    {
+        printf("Sem canais DMA livres para o ADC\n");
+    }
+
     xTaskCreate(self_test, "Self-Test", 1024, NULL, 1, &selfTest);
     xTaskCreate(alive_task, "Alive Task", 256, NULL, 1, &aliveTask);
     xTaskCreate(joystick_monitor_alarm, "Monitor de Joystick e Alarme", 1024, NULL, 1, &joystickMonitorAlarm);
@@ -6,6 +6,7 @@
 #include "queue.h"
 #include "semphr.h"
 #include "hardware/adc.h"
+#include "adc_varredura.h"
 
 #include "setup/setup.h"
 #include "setup/buzzer/buzzer.h"
@@ -13,6 +14,15 @@
 #define ADC_VRY_CHANNEL 0
 #define ADC_VRX_CHANNEL 1
 
+// Os dois eixos são amostrados sem parar pelo ADC em round-robin (1 kHz cada) e o DMA guarda as
+// amostras num anel de 1024; cada bloco de 64 amostras (32 ms) vira uma média por eixo
+#define JOYSTICK_SAMPLE_RATE_HZ 1000
+#define ADC_RING_LOG2 10
+#define ADC_BLOCK_LOG2 6
+
+ADC_ANEL_BUFFER(adc_buffer, ADC_RING_LOG2);
+adc_varredura_t adc_scan;
+
 typedef enum
 {
   EVENT_JOYSTICK,
@@ -59,11 +69,9 @@ void joystick_task(void *param)
     Event joystick;
     joystick.type = EVENT_JOYSTICK;
 
-    adc_select_input(ADC_VRX_CHANNEL);
-    joystick.data.vrx = adc_read();
-
-    adc_select_input(ADC_VRY_CHANNEL);
-    joystick.data.vry = adc_read();
+    // Última média de cada eixo, já separada pela varredura: não mexe no ADC
+    joystick.data.vrx = adc_varredura_valor(&adc_scan, ADC_VRX_CHANNEL);
+    joystick.data.vry = adc_varredura_valor(&adc_scan, ADC_VRY_CHANNEL);
 
     xQueueSend(queue, &joystick, 0);
 
@@ -145,6 +153,13 @@ int main()
 {
   setup();
 
+  if (!adc_varredura_iniciar(&adc_scan, adc_buffer, ADC_RING_LOG2, ADC_BLOCK_LOG2,
+                             ADC_VARREDURA_ENTRADA(ADC_VRY_CHANNEL) | ADC_VARREDURA_ENTRADA(ADC_VRX_CHANNEL),
+                             JOYSTICK_SAMPLE_RATE_HZ))
+  {
+    printf("Sem canais DMA livres para o joystick\n");
+  }
+
   queue = xQueueCreate(5, sizeof(Event));
   usb_mutex = xSemaphoreCreateMutex();
   buzzer_semaphore = xSemaphoreCreateCounting(2, 0);
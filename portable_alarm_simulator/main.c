@@ -18,7 +18,7 @@
 #include "setup/setup.h"
 #include "setup/led/led.h"
 #include "buzzer/buzzer.h"
-#include "utils/ssd1306.h"
+#include "ssd1306.h"
 
 #define TCP_PORT 80
 #define DEBUG_printf printf
@@ -90,24 +90,22 @@ void turn_on_led(int pin)
 
 void clear_display()
 {
-    uint8_t ssd[ssd1306_buffer_length];
+    uint8_t framebuffer[ssd1306_framebuffer_length];
+    uint8_t *ssd = &framebuffer[ssd1306_buffer_prefix]; // byte 0 reservado ao controle I²C
     memset(ssd, 0, ssd1306_buffer_length);
     render_on_display(ssd, &frame_area);
 }
 
 void show_alert_on_display(char *alert)
 {
-    uint8_t ssd[ssd1306_buffer_length];
+    uint8_t framebuffer[ssd1306_framebuffer_length];
+    uint8_t *ssd = &framebuffer[ssd1306_buffer_prefix]; // byte 0 reservado ao controle I²C
     memset(ssd, 0, ssd1306_buffer_length);
 
     if (strcmp(alert, "Evacuar") == 0)
     {
-        // Centraliza o texto "Evacuar"
-        int text_len = strlen(alert);
-        int text_width = text_len * 6;
-        int x = (128 - text_width) / 2;
-
-        ssd1306_draw_string(ssd, x, 26, alert); // Linha única no meio da tela
+        // Centraliza o texto "Evacuar" (linha única no meio da tela)
+        ssd1306_draw_text_aligned(ssd, 0, 26, ssd1306_width, alert, SSD1306_ALIGN_CENTER);
     }
     else if (strcmp(alert, "Sistema em repouso") == 0)
     {
@@ -118,11 +116,7 @@ void show_alert_on_display(char *alert)
     else
     {
         // Caso genérico: centraliza o texto
-        int text_len = strlen(alert);
-        int text_width = text_len * 6;
-        int x = (128 - text_width) / 2;
-
-        ssd1306_draw_string(ssd, x, 28, alert);
+        ssd1306_draw_text_aligned(ssd, 0, 28, ssd1306_width, alert, SSD1306_ALIGN_CENTER);
     }
 
     render_on_display(ssd, &frame_area);